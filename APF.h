@@ -39,12 +39,41 @@ class APF {
   * @param maxDelayTime The maximum delay time in milliseconds
   */
   void setMaxTime(float maxDelayTime) {
-    delete[] delayBuffer; // remove any previous memory allocation
+    setMaxTime(maxDelayTime, powerOf2Size);
+  }
+
+  /** 
+  * Set the maximum delay time in milliseconds
+  * @param maxDelayTime The maximum delay time in milliseconds
+  * @param powerOf2 Round the buffer up to a power of two length, so read and write positions wrap with a mask
+  */
+  void setMaxTime(float maxDelayTime, bool powerOf2) {
+    powerOf2Size = powerOf2;
     maxDelayTime_ms = max(0.0f, maxDelayTime);
-    delayBufferSize_samples = maxDelayTime_ms * SAMPLE_RATE * 0.001 + 1;
-    delayBuffer = new int16_t[delayBufferSize_samples]; // create a new audio buffer
-    empty();
-    initialised = true;
+    unsigned int samples = maxDelayTime_ms * SAMPLE_RATE * 0.001 + 1;
+    if (powerOf2) samples = nextPowerOf2(samples);
+    if (!ownsBuffer || samples > bufferCapacity) { // only allocate when growing
+      if (ownsBuffer) audioFree(delayBuffer);
+      delayBuffer = (int16_t *)audioAlloc(samples * sizeof(int16_t)); // from the M16 audio arena
+      bufferCapacity = samples;
+      ownsBuffer = true;
+    }
+    initBuffer(samples);
+  }
+
+  /** 
+  * Use an externally allocated buffer for the filter, e.g. one region of a larger block.
+  * The buffer is not deleted by this filter.
+  * @param buffer The memory to use, at least samples long
+  * @param samples The length of the buffer. A power of two length wraps with a mask.
+  */
+  void setBuffer(int16_t * buffer, unsigned int samples) {
+    if (ownsBuffer) audioFree(delayBuffer);
+    delayBuffer = buffer;
+    ownsBuffer = false;
+    bufferCapacity = 0;
+    maxDelayTime_ms = (samples - 1) / (SAMPLE_RATE * 0.001f);
+    initBuffer(samples);
   }
 
   /** Retrieve the phase - 0.0 to 1.0 */
@@ -102,7 +131,11 @@ class APF {
   }
 
   private:
-    int16_t * delayBuffer;
+    int16_t * delayBuffer = nullptr;
+    bool ownsBuffer = false;
+    unsigned int bufferCapacity = 0; // samples allocated, which may be more than are in use
+    bool powerOf2Size = false;
+    unsigned int bufferMask = 0; // size - 1 when the buffer length is a power of two, else 0
     unsigned int writePos = 0;
     float maxDelayTime_ms = 0.0f;
     float delayTime_ms = 0.0f;
@@ -117,8 +150,7 @@ class APF {
     inline
     int16_t read() {
       int outValue = 0;
-      int readPos = writePos - delayTime_samples;
-      if (readPos < 0) readPos += delayBufferSize_samples;
+      unsigned int readPos = wrap(writePos - delayTime_samples);
       outValue = min(MAX_16, max(MIN_16, (int)delayBuffer[readPos]));
       return outValue;
     }
@@ -129,7 +161,25 @@ class APF {
     inline
     void write(int inValue) {
       delayBuffer[writePos] = min(MAX_16, max(MIN_16, inValue));
-      writePos = (writePos + 1) % delayBufferSize_samples;
+      writePos = wrap(writePos + 1);
+    }
+
+    /** Set up the size and wrap mask for a new buffer, and clear it */
+    void initBuffer(unsigned int samples) {
+      delayBufferSize_samples = samples;
+      bufferMask = (samples > 0 && (samples & (samples - 1)) == 0) ? samples - 1 : 0;
+      writePos = 0;
+      empty();
+      initialised = true;
+    }
+
+    /** Wrap a buffer position that may be up to one buffer length out of range */
+    inline
+    unsigned int wrap(int pos) {
+      if (bufferMask) return pos & bufferMask;
+      if (pos < 0) return pos + delayBufferSize_samples;
+      if (pos >= (int)delayBufferSize_samples) return pos - delayBufferSize_samples;
+      return pos;
     }
 
     /** Fill the delay with silence */
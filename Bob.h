@@ -21,6 +21,9 @@
 #ifndef BOB_H_
 #define BOB_H_
 
+#define BOB_SAT_TANH 0 // rational tanh approximation, the default
+#define BOB_SAT_POLY 1 // cubic soft clip, cheaper with no divide
+
 class Bob {
 
   public:
@@ -31,23 +34,56 @@ class Bob {
     }
 
     int16_t next(int32_t samp) {
-      float  input = samp * MAX_16_INV;
-      float total = 0.0f;
-      float interp = 0.0f;
-      for (size_t os = 0; os < kInterpolation; os++)
-      {
-          float u = (interp * oldinput_ + (1.0f - interp) * input)
-              - (z1_[3] - pbg_ * input) * K_ * Qadjust_;
-          u = fast_tanh(u);
-          float stage1 = LPF(u, 0);
-          float stage2 = LPF(stage1, 1);
-          float stage3 = LPF(stage2, 2);
-          float stage4 = LPF(stage3, 3);
-          total += stage4 * kInterpolationRecip;
-          interp += kInterpolationRecip;
+      int16_t out;
+      next(&samp, &out, 1);
+      return out;
+    }
+
+    /** Filter a block of samples.
+    * The oversampling and saturator choices are made once per block.
+    * @input The input samples
+    * @output The buffer to fill with filtered samples
+    * @n The number of samples to process
+    */
+    void next(const int32_t * input, int16_t * output, size_t n) {
+      if (saturator == BOB_SAT_POLY) {
+        if (oversample == 1) {
+          process<1, true>(input, output, n);
+        } else if (oversample == 4) {
+          process<4, true>(input, output, n);
+        } else process<2, true>(input, output, n);
+      } else {
+        if (oversample == 1) {
+          process<1, false>(input, output, n);
+        } else if (oversample == 4) {
+          process<4, false>(input, output, n);
+        } else process<2, false>(input, output, n);
       }
-      oldinput_ = input;
-      return max(MIN_16, min(MAX_16, (int)(total * ampComp)));
+    }
+
+    /** For compatability with SVF filter code. */
+    void nextLPF(const int32_t * input, int16_t * output, size_t n) {
+      next(input, output, n);
+    }
+
+    /** Set the oversampling factor
+    * @factor 1, 2 (the default) or 4. 1 halves the CPU load, 4 reduces aliasing at high resonance.
+    */
+    void setOversample(int factor) {
+      oversample = (factor >= 4) ? 4 : (factor <= 1) ? 1 : 2;
+      compute_coeffs(Fbase_);
+    }
+
+    /** Return the oversampling factor */
+    int getOversample() {
+      return oversample;
+    }
+
+    /** Set the saturation function in the feedback path
+    * @type BOB_SAT_TANH (the default) or BOB_SAT_POLY, a cheaper cubic with a slightly harder knee
+    */
+    void setSaturator(int type) {
+      saturator = type;
     }
 
     /** For compatability with SVF filter code. */
@@ -81,8 +117,8 @@ class Bob {
 
   private:
     float PI_F = 3.1415927410125732421875f;
-    static const uint8_t kInterpolation = 2;
-    static constexpr float kInterpolationRecip = 1.0f / kInterpolation;
+    uint8_t oversample = 2;
+    int saturator = BOB_SAT_TANH;
     static constexpr float kMaxResonance = 1.8f;
 
     float sample_rate_;
@@ -117,18 +153,55 @@ class Bob {
       setRes(0.2f);
     }
 
+    /** Cubic soft clip, x - 4/27 x^3, reaching +-1 at +-1.5 */
+    static inline float poly_sat(float x) {
+      if (x > 1.5f) return 1.0f;
+      if (x < -1.5f) return -1.0f;
+      return x - 0.148148148f * x * x * x;
+    }
+
+    /** Run the ladder over a block with the oversampling and saturator fixed at compile time */
+    template<int OS, bool POLY>
     inline
-    float LPF(float s, int i) {
-      float ft = s * (1.0f/1.3f) + (0.3f/1.3f) * z0_[i] - z1_[i];
-      ft = ft * alpha_ + z1_[i];
-      z1_[i] = ft;
-      z0_[i] = s;
-      return ft;
+    void process(const int32_t * input, int16_t * output, size_t n) {
+      const float recip = 1.0f / OS;
+      const float k = K_;
+      const float q = Qadjust_;
+      const float a = alpha_;
+      float z0[4] = {z0_[0], z0_[1], z0_[2], z0_[3]};
+      float z1[4] = {z1_[0], z1_[1], z1_[2], z1_[3]};
+      float prevInput = oldinput_;
+      for (size_t i=0; i<n; i++) {
+        float in = input[i] * MAX_16_INV;
+        float total = 0.0f;
+        float interp = 0.0f;
+        for (int os = 0; os < OS; os++) {
+          float u = (interp * prevInput + (1.0f - interp) * in) - (z1[3] - pbg_ * in) * k * q;
+          u = POLY ? poly_sat(u) : fast_tanh(u);
+          for (int s = 0; s < 4; s++) {
+            float ft = u * (1.0f/1.3f) + (0.3f/1.3f) * z0[s] - z1[s];
+            ft = ft * a + z1[s];
+            z0[s] = u;
+            z1[s] = ft;
+            u = ft;
+          }
+          total += u * recip;
+          interp += recip;
+        }
+        prevInput = in;
+        output[i] = max(MIN_16, min(MAX_16, (int)(total * ampComp)));
+      }
+      for (int s = 0; s < 4; s++) {
+        z0_[s] = z0[s];
+        z1_[s] = z1[s];
+      }
+      oldinput_ = prevInput;
     }
 
     void compute_coeffs(float freq) {
-      freq = max(5.0f, min(sample_rate_ * 0.425f,freq));
-      float wc = freq * (float)(2.0f * PI_F / ((float)kInterpolation * sample_rate_));
+      // the coefficient fits hold for wc up to that of 0.425 * sample_rate_ at 2x, so limit 1x to half that
+      freq = max(5.0f, min(sample_rate_ * 0.2125f * min((int)oversample, 2), freq));
+      float wc = freq * (float)(2.0f * PI_F / ((float)oversample * sample_rate_));
       float wc2 = wc * wc;
       alpha_ = 0.9892f * wc - 0.4324f * wc2 + 0.1381f * wc * wc2 - 0.0202f * wc2 * wc2;
       Qadjust_ = 1.006f + 0.0536f * wc - 0.095f * wc2 - 0.05f * wc2 * wc2;
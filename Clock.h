@@ -0,0 +1,244 @@
+/*
+ * Clock.h
+ *
+ * A sample accurate clock for stepping sequences and arpeggios,
+ * free running or following an external MIDI clock
+ *
+ * by Andrew R. Brown 2025
+ *
+ * Times are audio sample counts (audioSampleCount). Incoming MIDI clock ticks are
+ * timestamped by MIDI16, the tick interval is smoothed to estimate the tempo, and
+ * the tick phase is corrected gradually, so steps land at steady sample offsets
+ * within the audio block rather than whenever loop() gets around to them.
+ * Steps never run more than one tick ahead of the last tick recieved, so the clock
+ * stops with the external clock.
+ *
+ * Call handle() with each MIDI clock event from the audio or control task,
+ * then call process() from audioUpdateBlock() to render in pieces split at each step.
+ *
+ * This file is part of the M16 audio library. Relies on M16.h
+ *
+ * M16 is licensed under a Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International License.
+ */
+
+#ifndef CLOCK_H_
+#define CLOCK_H_
+
+#define CLOCK_PPQN 24 // MIDI clock ticks per beat
+
+class Clock {
+
+  public:
+    /** Constructor. */
+    Clock() {
+      setTempo(120);
+    }
+
+    /** Set the function called at each step
+    * It is called from the audio task, just before the first sample of the step is rendered.
+    * @callback A function taking the step count since start
+    */
+    void setStepCallback(void (*callback)(uint32_t)) {
+      stepCallback = callback;
+    }
+
+    /** Set the number of steps per beat, as for Seq::setStepDiv()
+    * @div 1 for quarter notes, 2 for eighths, 4 for sixteenths, etc. Must divide 24.
+    */
+    void setStepDiv(int div) {
+      div = max(1, min(CLOCK_PPQN, div));
+      ticksPerStep = CLOCK_PPQN / div;
+    }
+
+    /** Set the tempo used when free running, or the initial estimate for an external clock
+    * @bpm The tempo in beats per minute
+    */
+    void setTempo(float bpm) {
+      if (bpm > 0) tickSamples = SAMPLE_RATE * 60.0f / (bpm * CLOCK_PPQN);
+    }
+
+    /** Return the current tempo, as smoothed from the external clock if following one */
+    float getTempo() {
+      return SAMPLE_RATE * 60.0f / (tickSamples * CLOCK_PPQN);
+    }
+
+    /** Follow an external MIDI clock, or run from the tempo set with setTempo()
+    * @state true to follow MIDI clock ticks passed to handle()
+    */
+    void setExternal(bool state) {
+      external = state;
+    }
+
+    /** Set how quickly the tempo and phase follow the external clock
+    * @tempo The fraction of each tick interval error taken into the tempo, 0.0 - 1.0, default 0.05
+    * @phase The fraction of each tick timing error corrected, 0.0 - 1.0, default 0.2
+    */
+    void setSmoothing(float tempo, float phase) {
+      tempoSmoothing = max(0.001f, min(1.0f, tempo));
+      phaseSmoothing = max(0.001f, min(1.0f, phase));
+    }
+
+    /** Start from the first step
+    * Free running, the first step is due now. Following a MIDI clock, it is due at the next tick.
+    */
+    void start() {
+      running = true;
+      stepCount = 0;
+      nextStepTick = 0;
+      if (external) {
+        waitingForTick = true;
+      } else setAnchor(audioSampleCount, 0, 0);
+    }
+
+    /** Stop stepping */
+    void stop() {
+      running = false;
+    }
+
+    /** Carry on stepping from where the clock stopped */
+    void cont() {
+      running = true;
+      if (external) {
+        waitingForTick = true; // carry on at the next tick
+      } else setAnchor(audioSampleCount, 0, nextStepTick);
+    }
+
+    /** Return true if the clock is stepping */
+    bool isRunning() {
+      return running;
+    }
+
+    /** Pass on a MIDI clock tick
+    * @time The audio sample count when the tick arrived, e.g. MidiEvent.time
+    */
+    void tick(uint32_t time) {
+      if (!external) return;
+      if (haveTick) {
+        int32_t interval = time - lastTickTime;
+        // ignore gaps, such as after the clock is restarted
+        if (interval > 0 && interval < tickSamples * 4) tickSamples += (interval - tickSamples) * tempoSmoothing;
+      }
+      lastTickTime = time;
+      bool firstTick = !haveTick;
+      haveTick = true;
+      if (!running) return; // keep the tempo, the position waits for start or continue
+      if (waitingForTick || firstTick) {
+        waitingForTick = false;
+        setAnchor(time, 0, nextStepTick); // the first tick after start is the first step
+        tickCount = nextStepTick;
+        return;
+      }
+      tickCount++;
+      float predicted = tickTime(tickCount);
+      float error = (int32_t)(time - anchorTime) - predicted;
+      if (error > tickSamples * 4 || error < -tickSamples * 4) {
+        setAnchor(time, 0, tickCount); // lost sync, jump to the tick
+      } else {
+        float corrected = predicted + error * phaseSmoothing;
+        int32_t whole = floor(corrected);
+        setAnchor(anchorTime + whole, corrected - whole, tickCount);
+      }
+    }
+
+    /** Pass on a MIDI real time message, handling clock, start, continue and stop
+    * @status The MIDI status byte
+    * @time The audio sample count when the message arrived
+    */
+    void handle(uint8_t status, uint32_t time) {
+      if (status == 0xF8) {
+        tick(time);
+      } else if (status == 0xFA) {
+        start();
+      } else if (status == 0xFB) {
+        cont();
+      } else if (status == 0xFC) {
+        stop();
+      }
+    }
+
+    /** Return the sample offset of the next step within the next n samples, or -1 if none is due
+    * Steps due before the block, such as the first step after an external start, are due at 0.
+    * @n The number of samples from the current audioSampleCount
+    */
+    int stepOffset(size_t n) {
+      return stepOffsetFrom(audioSampleCount, n);
+    }
+
+    /** Advance to the next step and call the step callback */
+    void fireStep() {
+      if (!external) { // move the anchor along to keep the float offsets small
+        float t = tickTime(nextStepTick);
+        int32_t whole = floor(t);
+        setAnchor(anchorTime + whole, t - whole, nextStepTick);
+      }
+      nextStepTick += ticksPerStep;
+      uint32_t step = stepCount++;
+      if (stepCallback) stepCallback(step);
+    }
+
+    /** Render a block, split so that each step falls on its exact sample
+    * Call from audioUpdateBlock()
+    * @render The block render function
+    * @left The left channel block
+    * @right The right channel block
+    * @n The number of samples in each channel
+    */
+    void process(void (*render)(int16_t *, int16_t *, size_t), int16_t * left, int16_t * right, size_t n) {
+      size_t done = 0;
+      uint32_t blockStart = audioSampleCount;
+      while (done < n) {
+        int offset = stepOffsetFrom(blockStart + done, n - done);
+        if (offset < 0) break;
+        renderPiece(render, left, right, done, done + offset);
+        done += offset;
+        fireStep();
+      }
+      renderPiece(render, left, right, done, n);
+    }
+
+    /** Return the number of steps since start */
+    uint32_t getStepCount() {
+      return stepCount;
+    }
+
+  private:
+    void (*stepCallback)(uint32_t) = nullptr;
+    bool running = false;
+    bool external = false;
+    bool haveTick = false;
+    bool waitingForTick = false;
+    float tickSamples; // smoothed samples per tick
+    float tempoSmoothing = 0.05f;
+    float phaseSmoothing = 0.2f;
+    int ticksPerStep = CLOCK_PPQN / 4;
+    int32_t tickCount = 0; // ticks recieved since start
+    int32_t nextStepTick = 0;
+    uint32_t stepCount = 0;
+    uint32_t lastTickTime = 0;
+    // the clock position, anchorTick is at sample anchorTime + anchorFrac
+    uint32_t anchorTime = 0;
+    float anchorFrac = 0;
+    int32_t anchorTick = 0;
+
+    int stepOffsetFrom(uint32_t now, size_t n) {
+      if (!running || waitingForTick || (external && !haveTick)) return -1;
+      if (external && nextStepTick > tickCount + 1) return -1; // wait for the clock
+      float offset = tickTime(nextStepTick) - (int32_t)(now - anchorTime);
+      if (offset >= n) return -1;
+      return max(0, (int)ceil(offset));
+    }
+
+    void setAnchor(uint32_t time, float frac, int32_t tick) {
+      anchorTime = time;
+      anchorFrac = frac;
+      anchorTick = tick;
+    }
+
+    /** Return the time of a tick in samples after anchorTime */
+    inline
+    float tickTime(int32_t tick) {
+      return anchorFrac + (tick - anchorTick) * tickSamples;
+    }
+};
+
+#endif /* CLOCK_H_ */
@@ -18,7 +18,12 @@
 class Del {
 
 private:
-  int16_t * delayBuffer;
+  int16_t * delayBuffer = nullptr;
+  bool ownsBuffer = false;
+  unsigned int bufferCapacity = 0; // samples allocated, which may be more than are in use
+  bool usePSRAM = false;
+  bool powerOf2Size = false;
+  unsigned int bufferMask = 0; // size - 1 when the buffer length is a power of two, else 0
   unsigned int writePos = 0;
   float delayTime_ms = 0.0f;
   unsigned int delayTime_samples = 0;
@@ -56,11 +61,48 @@ public:
    * @param maxDelayTime The maximum delay time in milliseconds
    */
   void setMaxDelayTime(unsigned int maxDelayTime) {
-    delete[] delayBuffer; // remove any previous memory allocation
-    maxDelayTime_ms = max((unsigned int)0, maxDelayTime);
-    delayBufferSize_samples = maxDelayTime_ms * SAMPLE_RATE * 0.001;
-    delayBuffer = new int16_t[delayBufferSize_samples]; // create a new audio buffer
-    empty();
+    setMaxDelayTime(maxDelayTime, powerOf2Size);
+  }
+
+  /** 
+   * Set the maximum delay time in milliseconds
+   * Growing the buffer allocates, so set the longest time needed in setup(), not from the audio task.
+   * @param maxDelayTime The maximum delay time in milliseconds
+   * @param powerOf2 Round the buffer up to a power of two length, so read and write positions wrap with a mask
+   */
+  void setMaxDelayTime(unsigned int maxDelayTime, bool powerOf2) {
+    powerOf2Size = powerOf2;
+    unsigned int samples = max((unsigned int)0, maxDelayTime) * SAMPLE_RATE * 0.001;
+    if (powerOf2) samples = nextPowerOf2(samples);
+    if (!ownsBuffer || samples > bufferCapacity) { // only allocate when growing
+      if (ownsBuffer) audioFree(delayBuffer);
+      delayBuffer = (int16_t *)audioAlloc(samples * sizeof(int16_t), usePSRAM); // from the M16 audio arena
+      bufferCapacity = samples;
+      ownsBuffer = true;
+    }
+    initBuffer(samples);
+  }
+
+  /** Place the delay buffer in PSRAM, where available, the next time it is allocated.
+  * Suits long delays on ESP32 boards with PSRAM. Call before setMaxDelayTime().
+  * @param state true to use PSRAM
+  */
+  void setPSRAM(bool state) {
+    usePSRAM = state;
+  }
+
+  /** 
+   * Use an externally allocated buffer for the delay line, e.g. one region of a larger block.
+   * The buffer is not deleted by this delay.
+   * @param buffer The memory to use, at least samples long
+   * @param samples The length of the buffer. A power of two length wraps with a mask.
+   */
+  void setBuffer(int16_t * buffer, unsigned int samples) {
+    if (ownsBuffer) audioFree(delayBuffer);
+    delayBuffer = buffer;
+    ownsBuffer = false;
+    bufferCapacity = 0;
+    initBuffer(samples);
   }
 
   /** Constructor.
@@ -71,7 +113,7 @@ public:
   }
 
   ~Del() {
-    delete[] delayBuffer;
+    if (ownsBuffer) audioFree(delayBuffer);
   }
 
   /** Return the size of the delay buffer in ms */
@@ -158,13 +200,117 @@ public:
     return outValue;
   }
 
+  /** Input a block of values to the delay and retrieve the signal delayed by delayTime milliseconds.
+	* @param input The signal input samples.
+	* @param output The buffer to fill with delayed samples.
+	* @param n The number of samples to process.
+	*/
+	inline
+	void next(const int32_t * input, int16_t * output, size_t n) {
+    unsigned int wPos = writePos;
+    unsigned int rPos = wrap(wPos - delayTime_samples);
+    bool hasDelay = delayTime_samples > 0;
+    for (size_t i=0; i<n; i++) {
+      int32_t outValue = 0;
+      if (hasDelay) {
+        outValue = (smooth(delayBuffer[rPos]) * delayLevel)>>10;
+        if (outValue > MAX_16) outValue = MAX_16;
+        if (outValue < MIN_16) outValue = MIN_16;
+      }
+      int32_t inValue = input[i];
+      if (delayFeedback) {
+        inValue = (inValue + ((outValue * feedbackLevel)>>10)) * 0.9f;
+      }
+      if (inValue > MAX_16) inValue = MAX_16;
+      if (inValue < MIN_16) inValue = MIN_16;
+      delayBuffer[wPos] = inValue;
+      wPos = wrap(wPos + 1);
+      rPos = wrap(rPos + 1);
+      output[i] = outValue;
+    }
+    writePos = wPos;
+  }
+
   /** Read the buffer at the delayTime without incrementing read/write index */
   inline
 	int16_t read() {
-    int outValue = 0;
-    int readPos = writePos - delayTime_samples;
-    if (readPos < 0) readPos += delayBufferSize_samples;
-    outValue = min(MAX_16, max(MIN_16, (int)delayBuffer[readPos]));
+    unsigned int readPos = wrap(writePos - delayTime_samples);
+    return (smooth(delayBuffer[readPos]) * delayLevel)>>10;
+  }
+
+  /** Input a value to the delay and retrieve the signal at a fractional delay time.
+  * Suits modulated delays, such as chorus, flanger and vibrato, that change the delay time every sample.
+	* @param inValue The signal input.
+	* @param delayQ16 The delay time in samples as 16.16 fixed point, e.g. samples << 16
+	*/
+	inline
+	int16_t nextFrac(int32_t inValue, uint32_t delayQ16) {
+    int32_t outValue = readFrac(delayQ16);
+    if (outValue > MAX_16) outValue = MAX_16;
+    if (outValue < MIN_16) outValue = MIN_16;
+    if (delayFeedback) {
+      inValue = (inValue + ((outValue * feedbackLevel)>>10)) * 0.9f;
+    }
+    if (inValue > MAX_16) inValue =  MAX_16;
+    if (inValue < MIN_16) inValue = MIN_16;
+    write(inValue);
+    return outValue;
+  }
+
+  /** Read the buffer at a fractional delay time, linearly interpolating between samples,
+  * without incrementing read/write index.
+  * @param delayQ16 The delay time in samples as 16.16 fixed point, from 1 to the buffer length - 2
+  */
+  inline
+	int16_t readFrac(uint32_t delayQ16) {
+    unsigned int delaySamples = delayQ16 >> 16;
+    int32_t frac = (delayQ16 & 0xFFFF) >> 1; // Q15 so the multiply can't overflow
+    if (delaySamples < 1) {
+      delaySamples = 1;
+      frac = 0;
+    } else if (delaySamples > delayBufferSize_samples - 2) {
+      delaySamples = delayBufferSize_samples - 2;
+      frac = 0;
+    }
+    unsigned int readPos = wrap(writePos - delaySamples);
+    unsigned int nextPos = wrap(readPos - 1); // one sample older
+    int32_t a = delayBuffer[readPos];
+    int32_t outValue = a + (((delayBuffer[nextPos] - a) * frac)>>15);
+    return (smooth(outValue) * delayLevel)>>10;
+  }
+
+  /** Read the buffer at the delayTime and increment the read/write index
+  * @param inVal The signal input.
+  */
+  inline
+	void write(int inValue) {
+    delayBuffer[writePos] = min(MAX_16, max(MIN_16, inValue));
+    writePos = wrap(writePos + 1);
+  }
+
+private:
+  /** Set up the size and wrap mask for a new buffer, and clear it */
+  void initBuffer(unsigned int samples) {
+    delayBufferSize_samples = samples;
+    bufferMask = (samples > 0 && (samples & (samples - 1)) == 0) ? samples - 1 : 0;
+    maxDelayTime_ms = samples / (SAMPLE_RATE * 0.001f);
+    writePos = 0;
+    empty();
+  }
+
+  /** Wrap a buffer position that may be up to one buffer length out of range */
+  inline
+  unsigned int wrap(int pos) {
+    if (bufferMask) return pos & bufferMask;
+    if (pos < 0) return pos + delayBufferSize_samples;
+    if (pos >= (int)delayBufferSize_samples) return pos - delayBufferSize_samples;
+    return pos;
+  }
+
+  /** Apply the selected degree of filtering to a value read from the buffer */
+  inline
+  int smooth(int outValue) {
+    outValue = min(MAX_16, max(MIN_16, outValue));
     if(filtered > 0) {
       if (filtered == 1) {
         outValue = (outValue + outValue + outValue + prevOutValue)>>2; // smooth
@@ -176,16 +322,7 @@ public:
           prevOutValue + prevOutValue + prevOutValue + prevOutValue)>>3; // smooth
       prevOutValue = outValue;
     }
-    return (outValue * delayLevel)>>10;
-  }
-
-  /** Read the buffer at the delayTime and increment the read/write index
-  * @param inVal The signal input.
-  */
-  inline
-	void write(int inValue) {
-    delayBuffer[writePos] = min(MAX_16, max(MIN_16, inValue));
-    writePos = (writePos + 1) % delayBufferSize_samples;
+    return outValue;
   }
 };
 
@@ -74,6 +74,9 @@ class Env {
       if (val >= 0) {
         envRelease = max(10.0f, val) * 1000.0f;
         jitEnvRelease = envRelease;
+        jitEnvReleaseInv = 1.0f / jitEnvRelease;
+        releaseSamples = jitEnvRelease * SAMPLES_PER_MICRO;
+        releaseSamplesInv = 1.0f / max((uint32_t)1, releaseSamples);
       }
     }
 
@@ -93,9 +96,111 @@ class Env {
       jitEnvRelease = envRelease + rand(envRelease * 0.2);
       jitEnvAttack = envAttack + rand(envAttack * 0.2);
       jitEnvDecay = envDecay; // + rand(envDecay * 0.2);
+      // reciprocals so next() can multiply rather than divide
+      jitEnvAttackInv = (jitEnvAttack > 0) ? 1.0f / jitEnvAttack : 0;
+      jitEnvDecayInv = (jitEnvDecay > 0) ? 1.0f / jitEnvDecay : 0;
+      jitEnvReleaseInv = 1.0f / jitEnvRelease;
+      // segment lengths for sample mode
+      attackSamples = jitEnvAttack * SAMPLES_PER_MICRO;
+      holdSamples = envHold * SAMPLES_PER_MICRO;
+      decaySamples = max((uint32_t)1, (uint32_t)(jitEnvDecay * SAMPLES_PER_MICRO));
+      releaseSamples = jitEnvRelease * SAMPLES_PER_MICRO;
+      attackSamplesInv = (attackSamples > 0) ? 1.0f / attackSamples : 0;
+      decaySamplesInv = 1.0f / decaySamples;
+      releaseSamplesInv = 1.0f / max((uint32_t)1, releaseSamples);
+      segmentPos = 0;
       envStartTime = micros(); //millis();
       currDelayRepeats = delayRepeats;
-      next();
+      if (sampleMode) {
+        advance(0);
+      } else next();
+    }
+
+    /** Set the envelope to count samples rather than read micros().
+    * In sample mode each call to next() advances the envelope by one sample,
+    * advance(n) moves it on by n samples, and next(buffer, n) by one block,
+    * so the envelope should be updated from the audio callback.
+    * @state true for sample mode, false for the default micros() timing
+    */
+    void setSampleMode(bool state) {
+      sampleMode = state;
+    }
+
+    /** Return true if the envelope is counting samples */
+    bool getSampleMode() {
+      return sampleMode;
+    }
+
+    /** Advance a sample mode envelope by a number of samples and return its value.
+    * Segments are computed from the sample count and precomputed inverse
+    * segment lengths, so no clock is read. In micros() mode this is the same as next().
+    * @n The number of samples elapsed since the last update
+    */
+    inline
+    uint16_t advance(size_t n) {
+      if (!sampleMode) return next();
+      segmentPos += n;
+      switch (envState) {
+        case 0:
+          // env complete
+          return 0;
+        case 1:
+          // attack
+          if (segmentPos < attackSamples) {
+            envVal = max(envVal, min(JIT_MAX_ENV_LEVEL, (uint32_t)(JIT_MAX_ENV_LEVEL * (segmentPos * attackSamplesInv))));
+            return envVal;
+          }
+          segmentPos -= attackSamples;
+          envVal = JIT_MAX_ENV_LEVEL;
+          envState = 2; // go to hold
+          // fall through
+        case 2:
+          // hold
+          if (segmentPos < holdSamples) return envVal;
+          segmentPos -= holdSamples;
+          decayStartLevel = envVal;
+          envState = 3; // go to decay
+          // fall through
+        case 3:
+          // decay
+          if (segmentPos < decaySamples) {
+            float dPercent = 1.0f - segmentPos * decaySamplesInv;
+            dPercent = dPercent * dPercent * dPercent; // exp
+            envVal = decayStartLevel * dPercent;
+            if (envVal > sustainLevel) return envVal;
+          }
+          if (currDelayRepeats > 0) {
+            currDelayRepeats -= 1;
+            segmentPos = 0;
+            envVal = decayStartLevel;
+            return envVal;
+          }
+          segmentPos = 0;
+          envState = 4; // go to sustain
+          // fall through
+        case 4:
+          // sustain
+          if (sustainLevel > 0) {
+            envVal = sustainLevel;
+            return envVal;
+          }
+          releaseStartlevel = envVal;
+          segmentPos = 0;
+          envState = 5; // go to release
+          // fall through
+        case 5:
+          // release
+          if (segmentPos < releaseSamples) {
+            float rPercent = 1.0f - segmentPos * releaseSamplesInv;
+            rPercent = rPercent * rPercent * rPercent; // faster exp
+            envVal = releaseStartlevel * rPercent;
+            if (envVal > 10) return envVal;
+          }
+          envState = 0; // go to complete
+          envVal = 0;
+          return 0;
+      }
+      return 0;
     }
 
     /** Return the envelope's start time */
@@ -112,7 +217,8 @@ class Env {
       if (envState > 0 && envState < 5) {
         releaseStartLevelDiff = JIT_MAX_ENV_LEVEL - envVal;
         releaseStartlevel = envVal;
-        releaseStartTime = micros();
+        releaseStartTime = sampleMode ? 0 : micros();
+        segmentPos = 0;
         envState = 5; // release
       }
     }
@@ -126,6 +232,7 @@ class Env {
     /** Compute and return the next envelope value */
     inline
     uint16_t next() {
+      if (sampleMode) return advance(1);
       // unsigned long msTime = millis();
       unsigned long microsTime = micros();
       unsigned long elapsedTime = microsTime - envStartTime;
@@ -141,7 +248,7 @@ class Env {
             envVal = JIT_MAX_ENV_LEVEL;
             return envVal;
           } else if (elapsedTime <= jitEnvAttack) {
-            double attackPortion = elapsedTime / (double)jitEnvAttack;
+            float attackPortion = elapsedTime * jitEnvAttackInv;
             envVal = max(envVal, min(JIT_MAX_ENV_LEVEL, (uint32_t)(JIT_MAX_ENV_LEVEL * attackPortion)));
             return envVal;
           } else {
@@ -166,7 +273,7 @@ class Env {
           // decay
           // if (jitEnvDecay > 0 && microsTime < decayStartTime + jitEnvDecay && envVal > sustainLevel && abs((int)envVal) > 1) { // decay
           if (jitEnvDecay > 0 && envVal > sustainLevel) { // decay
-            float dPercent = max(0.0f, 1.0f - (microsTime - decayStartTime) / (float)jitEnvDecay);
+            float dPercent = max(0.0f, 1.0f - (microsTime - decayStartTime) * jitEnvDecayInv);
             dPercent = dPercent * dPercent * dPercent; // exp
             // envVal = sustainTriggerLevel + decayStartLevelDiff * dPercent;
             // envVal *= dPercent;
@@ -201,7 +308,7 @@ class Env {
           // if (microsTime < releaseStartTime + jitEnvRelease && envVal > 10) {
           if (envVal > 10) {
             // float rPercent = pow(1.0f - (microsTime - releaseStartTime) / (float)jitEnvRelease, 4); // exp
-            float rPercent = max(0.0f, 1.0f - (microsTime - releaseStartTime) / (float)jitEnvRelease);
+            float rPercent = max(0.0f, 1.0f - (microsTime - releaseStartTime) * jitEnvReleaseInv);
             rPercent = rPercent * rPercent * rPercent; // faster exp
             envVal = releaseStartlevel * rPercent;
             return envVal;
@@ -216,6 +323,25 @@ class Env {
     }
 
 
+    /** Fill a buffer with envelope values for an audio block.
+    * The envelope is computed once per block and linearly interpolated across it.
+    * In sample mode the envelope is advanced by n samples.
+    * @out The buffer to fill
+    * @n The number of samples in the block
+    */
+    inline
+    void next(uint16_t * out, size_t n) {
+      int32_t startVal = blockEnvVal;
+      int32_t endVal = sampleMode ? advance(n) : next();
+      int32_t step = ((endVal - startVal) << 8) / (int32_t)n;
+      int32_t val = startVal << 8;
+      for (size_t i=0; i<n; i++) {
+        val += step;
+        out[i] = val >> 8;
+      }
+      blockEnvVal = endVal;
+    }
+
     /** Return the current envelope value - from 0 to MAX_16 */
     inline
     uint16_t getValue() {
@@ -245,19 +371,28 @@ class Env {
   private:
     uint32_t MAX_ENV_LEVEL = MAX_16 * 2 - 1;
     uint32_t JIT_MAX_ENV_LEVEL = MAX_ENV_LEVEL;
-    uint32_t jitEnvAttack, envAttack, envHold, envDecay, jitEnvDecay, sustainLevel, sustainTriggerLevel;
+    uint32_t jitEnvAttack = 0, envAttack = 0, envHold = 0, envDecay = 0, jitEnvDecay = 0, sustainLevel = 0, sustainTriggerLevel = 0;
     float envSustain = 0.0f;
     uint32_t envRelease = 600 * 1000; // ms to micros
     uint32_t jitEnvRelease = envRelease;
+    float jitEnvAttackInv = 0, jitEnvDecayInv = 0, jitEnvReleaseInv = 1.0f / envRelease;
     bool peaked = false;
-    unsigned long envStartTime, releaseStartTime, decayStartTime;
+    unsigned long envStartTime = 0, releaseStartTime = 0, decayStartTime = 0;
     uint32_t envVal = 0;
+    int32_t blockEnvVal = 0; // envVal at the end of the previous block
     uint32_t releaseStartLevelDiff = MAX_ENV_LEVEL;
-    uint32_t decayStartLevel, decayStartLevelDiff, releaseStartlevel;
+    uint32_t decayStartLevel = 0, decayStartLevelDiff = 0, releaseStartlevel = 0;
     int delayRepeats = 0;
     int currDelayRepeats = 0;
     int delayExp = 4;
 
+    // sample mode
+    const float SAMPLES_PER_MICRO = SAMPLE_RATE * 0.000001f;
+    bool sampleMode = false;
+    uint32_t segmentPos = 0; // samples since the current segment began
+    uint32_t attackSamples = 0, holdSamples = 0, decaySamples = 1, releaseSamples = 1;
+    float attackSamplesInv = 0, decaySamplesInv = 1, releaseSamplesInv = 1;
+
     int envState = 0; // complete = 0, attack = 1, hold = 2, decay = 3, sustain = 4, release = 5
 
 };
@@ -0,0 +1,186 @@
+/*
+ * EventQueue.h
+ *
+ * A sample accurate event scheduler, so notes and parameter changes posted from loop()
+ * or other tasks are applied at an exact sample, rather than wherever a block happens to be
+ *
+ * by Andrew R. Brown 2025
+ *
+ * Times are audio sample counts (audioSampleCount). Any task may post() events ahead of time,
+ * through a lock-free queue that the audio task drains into a list sorted by time.
+ * process() then renders each block in pieces split at the event times, as Clock does,
+ * and calls each event's function just before its sample is rendered.
+ * Events that arrive late are applied at the start of the next block.
+ *
+ * Call process() from audioUpdateBlock(). Post a little ahead of time, at least one block
+ * (dmaBufferLength samples), so events are waiting when their block is rendered.
+ *
+ * This file is part of the M16 audio library. Relies on M16.h
+ *
+ * M16 is licensed under a Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International License.
+ */
+
+#ifndef EVENTQUEUE_H_
+#define EVENTQUEUE_H_
+
+#ifndef EVENT_QUEUE_SIZE
+  #define EVENT_QUEUE_SIZE 64 // events waiting to be taken by the audio task, a power of 2
+#endif
+#ifndef EVENT_PENDING_SIZE
+  #define EVENT_PENDING_SIZE 64 // events taken by the audio task and waiting for their time
+#endif
+
+class EventQueue {
+
+  public:
+    /** A function to call at a sample time, with an int and a float value, e.g. a pitch and a level */
+    struct TimedEvent {
+      uint32_t time;
+      void (*action)(int, float);
+      int intValue;
+      float floatValue;
+    };
+
+    /** Constructor. */
+    EventQueue() {}
+
+    /** Return the sample count now, to post events relative to */
+    uint32_t now() {
+      return audioSampleCount;
+    }
+
+    /** Post an event to happen at a sample time
+    * Safe to call from loop(), a Wi-Fi or other task, and more than one at once.
+    * @time The audio sample count to apply it at, e.g. now() + SAMPLE_RATE / 2
+    * @action The function to call from the audio task, taking intValue and floatValue
+    * @intValue Passed to the action, e.g. a MIDI pitch
+    * @floatValue Passed to the action, e.g. a velocity or parameter value
+    * @return false if the queue was full and the event was dropped
+    */
+    bool post(uint32_t time, void (*action)(int, float), int intValue = 0, float floatValue = 0) {
+      if (action == nullptr) return false;
+      uint32_t slot;
+      if (!reserve(slot)) return false;
+      Slot &s = slots[slot & (EVENT_QUEUE_SIZE - 1)];
+      s.event.time = time;
+      s.event.action = action;
+      s.event.intValue = intValue;
+      s.event.floatValue = floatValue;
+      __sync_synchronize(); // finish writing the slot before publishing it
+      s.ready = slot + 1;
+      return true;
+    }
+
+    /** Post an event to happen a number of milliseconds from now
+    * @ms The time from now in milliseconds
+    * @action The function to call from the audio task
+    * @intValue Passed to the action
+    * @floatValue Passed to the action
+    * @return false if the queue was full and the event was dropped
+    */
+    bool postIn(float ms, void (*action)(int, float), int intValue = 0, float floatValue = 0) {
+      return post(audioSampleCount + (uint32_t)(max(0.0f, ms) * SAMPLE_RATE * 0.001f), action, intValue, floatValue);
+    }
+
+    /** Return the number of events waiting in the queue or for their time */
+    int available() {
+      return (int)(slotsReserved - slotsRead) + numPending;
+    }
+
+    /** Return the number of events lost because the queue was full */
+    uint32_t getDropped() {
+      return droppedEvents;
+    }
+
+    /** Drop every event waiting for its time, call from the audio task like process() */
+    void clear() {
+      take();
+      numPending = 0;
+    }
+
+    /** Render a block, split so that each event falls on its exact sample
+    * Call from audioUpdateBlock()
+    * @render The block render function
+    * @left The left channel block
+    * @right The right channel block
+    * @n The number of samples in each channel
+    */
+    void process(void (*render)(int16_t *, int16_t *, size_t), int16_t * left, int16_t * right, size_t n) {
+      take();
+      size_t done = 0;
+      uint32_t blockStart = audioSampleCount;
+      while (numPending > 0) {
+        int32_t offset = (int32_t)(pending[numPending - 1].time - blockStart);
+        if (offset >= (int32_t)n) break;
+        if (offset > (int32_t)done) {
+          renderPiece(render, left, right, done, offset);
+          done = offset;
+        }
+        TimedEvent e = pending[--numPending]; // late events land here, at the current piece
+        e.action(e.intValue, e.floatValue);
+      }
+      renderPiece(render, left, right, done, n);
+    }
+
+  private:
+    struct Slot {
+      TimedEvent event;
+      volatile uint32_t ready; // the reservation count + 1 once the event is written
+    };
+    Slot slots[EVENT_QUEUE_SIZE] = {};
+    volatile uint32_t slotsReserved = 0; // changed by producers
+    volatile uint32_t slotsRead = 0; // only changed by the audio task
+    volatile uint32_t droppedEvents = 0;
+    TimedEvent pending[EVENT_PENDING_SIZE]; // latest first, so the next event is at the end
+    int numPending = 0;
+
+    /** Claim the next queue slot for one producer, or count a dropped event if the queue is full */
+    bool reserve(uint32_t &slot) {
+      #if IS_ESP32()
+      uint32_t current = __atomic_load_n(&slotsReserved, __ATOMIC_RELAXED);
+      do {
+        if (current - slotsRead >= EVENT_QUEUE_SIZE) {
+          __atomic_fetch_add(&droppedEvents, 1, __ATOMIC_RELAXED);
+          return false;
+        }
+      } while (!__atomic_compare_exchange_n(&slotsReserved, &current, current + 1, true, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+      slot = current;
+      return true;
+      #else
+      noInterrupts(); // the audio ISR is the only thing that can run between these on one core
+      bool ok = (slotsReserved - slotsRead < EVENT_QUEUE_SIZE);
+      if (ok) {
+        slot = slotsReserved++;
+      } else droppedEvents++;
+      interrupts();
+      return ok;
+      #endif
+    }
+
+    /** Move posted events into the time sorted list, stopping at one still being written */
+    void take() {
+      while (slotsRead != slotsReserved && numPending < EVENT_PENDING_SIZE) {
+        Slot &s = slots[slotsRead & (EVENT_QUEUE_SIZE - 1)];
+        if (s.ready != slotsRead + 1) break;
+        __sync_synchronize(); // read the event only after seeing it published
+        insert(s.event);
+        __sync_synchronize(); // finish reading the slot before releasing it
+        slotsRead = slotsRead + 1;
+      }
+    }
+
+    /** Add an event to the pending list, keeping equal times in the order they were posted */
+    void insert(const TimedEvent &e) {
+      uint32_t base = audioSampleCount;
+      int32_t t = (int32_t)(e.time - base);
+      int i = numPending;
+      while (i > 0 && (int32_t)(pending[i - 1].time - base) <= t) {
+        pending[i] = pending[i - 1];
+        i--;
+      }
+      pending[i] = e;
+      numPending++;
+    }
+};
+
+#endif /* EVENTQUEUE_H_ */
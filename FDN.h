@@ -0,0 +1,285 @@
+/*
+ * FDN.h
+ *
+ * A feedback delay network reverb with N delay lines (4, 8 or 16)
+ *
+ * by Andrew R. Brown 2025
+ *
+ * The inputs pass through allpass diffusers into N delay lines of mutually prime lengths.
+ * Each line output is damped by a one pole lowpass and scaled for the decay time, then the
+ * lines are mixed with a fast Walsh-Hadamard transform and fed back. Even lines make up the
+ * left output and odd lines the right.
+ * The core is integer only and all lines share one buffer from the M16 audio arena,
+ * so memory grows with N times the size, and CPU time grows with N log N.
+ *
+ * This file is part of the M16 audio library. Relies on M16.h
+ *
+ * M16 is licensed under a Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International License.
+ */
+
+#ifndef FDN_H_
+#define FDN_H_
+
+#define FDN_DIFFUSERS 2 // allpass diffusers per input channel
+
+template <int N>
+class FDN {
+  static_assert(N == 4 || N == 8 || N == 16, "FDN size must be 4, 8 or 16");
+
+  public:
+    /** Constructor. */
+    FDN() {}
+
+    /** Set the length of the longest delay line, which sets the room size and memory used
+    * Lines are spread between about half this and this length.
+    * Allocates the lines, so call from setup() rather than the audio task.
+    * @ms Time in milliseconds, the default is 60
+    */
+    void setSize(float ms) {
+      sizeMs = max(5.0f, ms);
+      init();
+    }
+
+    /** Set the line lengths and allocate their buffer now, rather than on the first next() call from the audio task
+    * Call from setup(). setSize() also does this.
+    * @return false if there was no memory for the lines, next() then passes audio through dry
+    */
+    bool init() {
+      const float msToSamples = SAMPLE_RATE * 0.001f;
+      unsigned int total = 0;
+      unsigned int sizes[N + numDiffusers];
+      for (int i=0; i<N; i++) { // spread exponentially from 0.45 to 1.0 of the size
+        float ms = sizeMs * pow(0.45f, 1.0f - (float)i / (N - 1));
+        lineLen[i] = primeFrom(max(2, (int)(ms * msToSamples)), lineLen, i);
+        sizes[i] = nextPowerOf2(lineLen[i] + 1);
+        total += sizes[i];
+      }
+      const float apfMs[4] = {1.1f, 3.7f, 1.3f, 4.1f};
+      for (int a=0; a<numDiffusers; a++) {
+        apfLen[a] = primeFrom(max(2, (int)(apfMs[a % 4] * (1 + a / 4) * msToSamples)), apfLen, a);
+        sizes[N + a] = nextPowerOf2(apfLen[a] + 1);
+        total += sizes[N + a];
+      }
+      initiated = true; // set even on failure, so the audio task doesn't retry
+      if (total > bufferSize) { // only allocate when growing
+        audioFree(buffer); // taken back by the arena when it was the latest allocation
+        buffer = (int16_t *)audioAlloc(total * sizeof(int16_t)); // from the M16 audio arena
+        bufferSize = (buffer != nullptr) ? total : 0;
+        if (buffer == nullptr) {
+          Serial.println("FDN: not enough memory, try a smaller setSize()");
+          return false;
+        }
+      }
+      int16_t * line = buffer;
+      for (int i=0; i<N; i++) {
+        lineBuf[i] = line;
+        lineMask[i] = sizes[i] - 1;
+        line += sizes[i];
+      }
+      for (int a=0; a<numDiffusers; a++) {
+        apfBuf[a] = line;
+        apfMask[a] = sizes[N + a] - 1;
+        line += sizes[N + a];
+      }
+      clear();
+      updateGains();
+      return true;
+    }
+
+    /** Set the decay time
+    * @seconds The time for the reverb tail to fall by 60 dB, the default is 1.5
+    */
+    void setDecay(float seconds) {
+      decayTime = max(0.05f, seconds);
+      if (initiated) updateGains();
+    }
+
+    /** Set the amount of high frequency damping in the tail
+    * @amount 0.0 (bright) to 1.0 (dark), the default is 0.3
+    */
+    void setDamping(float amount) {
+      amount = max(0.0f, min(0.99f, amount));
+      dampCoeff = (1.0f - amount) * 32767;
+    }
+
+    /** Set how much the input is smeared before entering the lines
+    * @amount 0.0 to 1.0, the default is 0.6
+    */
+    void setDiffusion(float amount) {
+      diffuseCoeff = max(0.0f, min(0.9f, amount * 0.75f)) * 32767;
+    }
+
+    /** Set the balance between dry and wet signal
+    * @mix The amount of wet signal, from 0.0 to 1.0, the default is 0.3
+    */
+    void setMix(float mix) {
+      wetMix = max(0, min(1024, (int)(mix * 1024)));
+    }
+
+    /** Return the balance between dry and wet signal, 0.0 - 1.0 */
+    float getMix() {
+      return wetMix * 0.0009765625f;
+    }
+
+    /** Return the bytes of delay memory used, allocated by init(), setSize() or the first call to next() */
+    unsigned int getMemory() {
+      return bufferSize * sizeof(int16_t);
+    }
+
+    /** Clear the reverb tail */
+    void clear() {
+      if (buffer) memset(buffer, 0, bufferSize * sizeof(int16_t));
+      for (int i=0; i<N; i++) damped[i] = 0;
+    }
+
+    /** Process a block of stereo samples
+    * @inLeft The left input samples
+    * @inRight The right input samples, can be the same as inLeft
+    * @outLeft The buffer to fill with left output
+    * @outRight The buffer to fill with right output
+    * @n The number of samples to process
+    */
+    void next(const int32_t * inLeft, const int32_t * inRight, int16_t * outLeft, int16_t * outRight, size_t n) {
+      if (!initiated) init();
+      if (buffer == nullptr) { // no memory for the lines
+        for (size_t s=0; s<n; s++) {
+          outLeft[s] = clip16(inLeft[s]);
+          outRight[s] = clip16(inRight[s]);
+        }
+        return;
+      }
+      const int32_t dry = 1024 - wetMix;
+      const int32_t wet = wetMix;
+      const int32_t damp = dampCoeff;
+      const int32_t diffuse = diffuseCoeff;
+      uint32_t p = pos;
+      for (size_t s=0; s<n; s++) {
+        int32_t inL = clip16(inLeft[s]);
+        int32_t inR = clip16(inRight[s]);
+        // pre-diffusion
+        int32_t dL = inL, dR = inR;
+        for (int a=0; a<FDN_DIFFUSERS; a++) {
+          dL = allpass(a, dL, diffuse, p);
+          dR = allpass(FDN_DIFFUSERS + a, dR, diffuse, p);
+        }
+        dL >>= 1;
+        dR >>= 1;
+        // read, damp and scale each line
+        int32_t v[N];
+        int32_t wetL = 0, wetR = 0;
+        for (int i=0; i<N; i++) {
+          int32_t y = lineBuf[i][(p - lineLen[i]) & lineMask[i]];
+          damped[i] += ((y - damped[i]) * damp) / 32768; // truncate toward zero, so the tail dies away
+          if (i & 2) {
+            if (i & 1) wetR -= damped[i]; else wetL -= damped[i]; // alternate signs decorrelate the outputs
+          } else {
+            if (i & 1) wetR += damped[i]; else wetL += damped[i];
+          }
+          v[i] = (damped[i] * gain[i]) / 32768;
+        }
+        // fast Walsh-Hadamard mix
+        for (int h=1; h<N; h<<=1) {
+          for (int i=0; i<N; i+=h*2) {
+            for (int j=i; j<i+h; j++) {
+              int32_t a = v[j];
+              int32_t b = v[j + h];
+              v[j] = a + b;
+              v[j + h] = a - b;
+            }
+          }
+        }
+        // feed back with the input, even lines left and odd lines right
+        for (int i=0; i<N; i++) {
+          lineBuf[i][p & lineMask[i]] = clip16(v[i] / (1 << mixShift) + ((i & 1) ? dR : dL));
+        }
+        p++;
+        wetL >>= outShift;
+        wetR >>= outShift;
+        outLeft[s] = clip16(((inL * dry) + (wetL * wet))>>10);
+        outRight[s] = clip16(((inR * dry) + (wetR * wet))>>10);
+      }
+      pos = p;
+    }
+
+    /** Process one stereo sample
+    * @inLeft The left input sample
+    * @inRight The right input sample
+    * @outLeft Set to the left output
+    * @outRight Set to the right output
+    */
+    inline
+    void next(int32_t inLeft, int32_t inRight, int16_t &outLeft, int16_t &outRight) {
+      next(&inLeft, &inRight, &outLeft, &outRight, 1);
+    }
+
+    /** Process one mono sample, returning the left output */
+    inline
+    int16_t next(int32_t input) {
+      int16_t outLeft, outRight;
+      next(&input, &input, &outLeft, &outRight, 1);
+      return outLeft;
+    }
+
+  private:
+    static const int numDiffusers = FDN_DIFFUSERS * 2;
+    bool initiated = false;
+    float sizeMs = 60;
+    float decayTime = 1.5f;
+    int32_t dampCoeff = 0.7f * 32767;
+    int32_t diffuseCoeff = 0.45f * 32767;
+    int32_t wetMix = 307;
+    int16_t * buffer = nullptr;
+    unsigned int bufferSize = 0;
+    uint32_t pos = 0; // one write position for all lines, masked per line
+    int16_t * lineBuf[N];
+    uint32_t lineLen[N];
+    uint32_t lineMask[N];
+    int32_t gain[N]; // Q15 decay gain per line, including the Hadamard normalisation
+    int32_t damped[N];
+    int16_t * apfBuf[numDiffusers];
+    uint32_t apfLen[numDiffusers];
+    uint32_t apfMask[numDiffusers];
+    // the Hadamard transform grows the signal by sqrt(N), shifts take out whole powers of 2
+    static const int mixShift = (N == 4) ? 1 : (N == 8) ? 1 : 2;
+    static const int outShift = (N == 4) ? 0 : (N == 8) ? 1 : 2;
+
+    /** Schroeder allpass, w = x + g * d, y = d - g * w */
+    inline
+    int32_t allpass(int a, int32_t x, int32_t g, uint32_t p) {
+      int32_t d = apfBuf[a][(p - apfLen[a]) & apfMask[a]];
+      int32_t w = clip16(x + ((d * g)>>15));
+      apfBuf[a][p & apfMask[a]] = w;
+      return d - ((w * g)>>15);
+    }
+
+    static bool isPrime(unsigned int v) {
+      if (v < 2) return false;
+      for (unsigned int d=2; d*d<=v; d++) {
+        if (v % d == 0) return false;
+      }
+      return true;
+    }
+
+    /** Return the nearest prime at or above v, not already used */
+    static unsigned int primeFrom(unsigned int v, const uint32_t * used, int numUsed) {
+      for (;;) {
+        bool taken = false;
+        for (int i=0; i<numUsed; i++) {
+          if (used[i] == v) taken = true;
+        }
+        if (!taken && isPrime(v)) return v;
+        v++;
+      }
+    }
+
+    /** Set each line's gain so the tail falls by 60 dB in the decay time */
+    void updateGains() {
+      float norm = (N == 8) ? 0.70710678f : 1.0f; // the part of 1/sqrt(N) not done by mixShift
+      for (int i=0; i<N; i++) {
+        float g = pow(10.0f, -3.0f * lineLen[i] / (decayTime * SAMPLE_RATE));
+        gain[i] = g * norm * 32767;
+      }
+    }
+};
+
+#endif /* FDN_H_ */
@@ -231,6 +231,7 @@ class FX {
       if (!reverbInitiated) {
         initReverb(reverbSize);
       }
+      if (reverbBuffer == nullptr) return clip(audioIn); // no memory for the reverb lines
       processReverb(audioIn, audioIn);
       return clip(((audioIn * (1024 - reverbMix))>>10) + ((revP1 * reverbMix)>>12) + ((revP2 * reverbMix)>>12));
     }
@@ -249,12 +250,49 @@ class FX {
       if (!reverbInitiated) {
         initReverb(reverbSize);
       }
+      if (reverbBuffer == nullptr) { // no memory for the reverb lines
+        audioOutLeft = clip(audioInLeft);
+        audioOutRight = clip(audioInRight);
+        return;
+      }
       processReverb(clip(audioInLeft), clip(audioInRight));
       // processReverb(apf1.next(audioInLeft), apf2.next(audioInRight));
       audioOutLeft = clip(((audioInLeft * (1024 - reverbMix))>>10) + ((revP1 * reverbMix)>>11));
       audioOutRight = clip(((audioInRight * (1024 - reverbMix))>>10) + ((revP2 * reverbMix)>>11));
     }
 
+    /** A simple reverb using recursive delay lines, processing a block of samples.
+    * Stereo version that takes two input blocks (can be the same) and fills left and right output blocks
+    * @audioInLeft The left input samples
+    * @audioInRight The right input samples
+    * @audioOutLeft The buffer to fill with left channel output
+    * @audioOutRight The buffer to fill with right channel output
+    * @n The number of samples to process
+    */
+    inline
+    void reverbStereo(const int32_t * audioInLeft, const int32_t * audioInRight, int16_t * audioOutLeft, int16_t * audioOutRight, size_t n) {
+      // set up first time called
+      if (!reverbInitiated) {
+        initReverb(reverbSize);
+      }
+      if (reverbBuffer == nullptr) { // no memory for the reverb lines
+        for (size_t i=0; i<n; i++) {
+          audioOutLeft[i] = clip(audioInLeft[i]);
+          audioOutRight[i] = clip(audioInRight[i]);
+        }
+        return;
+      }
+      int32_t dryMix = 1024 - reverbMix;
+      int32_t wetMix = reverbMix;
+      for (size_t i=0; i<n; i++) {
+        int32_t inL = audioInLeft[i];
+        int32_t inR = audioInRight[i];
+        processReverb(clip(inL), clip(inR));
+        audioOutLeft[i] = clip(((inL * dryMix)>>10) + ((revP1 * wetMix)>>11));
+        audioOutRight[i] = clip(((inR * dryMix)>>10) + ((revP2 * wetMix)>>11));
+      }
+    }
+
     /** Set the reverb length
     * @rLen The amount of feedback that effects reverb decay time. Values from 0.0 to 1.0.
     */
@@ -300,14 +338,25 @@ class FX {
       if (!chorusInitiated) {
         initChorus();
       }
-      float chorusLfoVal = chorusLfo.next() * MAX_16_INV;
-      chorusDelay.setTime(chorusDelayTime + chorusLfoVal * chorusLfoWidth);
-      int32_t delVal = chorusDelay.next(audioIn);
+      int64_t chorusLfoVal = chorusLfo.next();
+      int32_t delVal = chorusDelay.nextFrac(audioIn, chorusDelayQ16 + ((chorusLfoVal * chorusLfoWidthQ16)>>15));
       int32_t inVal = (audioIn * (chorusMixInput))>>10;
       delVal = (delVal * chorusMixDelay)>>10;
       return clip(inVal + delVal);
     }
 
+    /** A mono chorus using a modulated delay line, processing a block of samples.
+    * @audioIn The input samples
+    * @audioOut The buffer to fill with output samples
+    * @n The number of samples to process
+    */
+    inline
+    void chorus(const int32_t * audioIn, int16_t * audioOut, size_t n) {
+      for (size_t i=0; i<n; i++) {
+        audioOut[i] = chorus(audioIn[i]);
+      }
+    }
+
     /** A stereo chorus using two modulated delay lines.
     * @audioInLeft An audio signal
     * @audioInRight An audio signal
@@ -320,11 +369,9 @@ class FX {
       if (!chorusInitiated) {
         initChorus();
       }
-      float chorusLfoVal = chorusLfo.next() * MAX_16_INV;
-      chorusDelay.setTime(chorusDelayTime + chorusLfoVal * chorusLfoWidth);
-      chorusDelay2.setTime(chorusDelayTime2 + chorusLfoVal * chorusLfoWidth);
-      int32_t delVal = chorusDelay.next(audioInLeft);
-      int32_t delVal2 = chorusDelay2.next(audioInRight);
+      int32_t chorusLfoOffset = ((int64_t)chorusLfo.next() * chorusLfoWidthQ16)>>15;
+      int32_t delVal = chorusDelay.nextFrac(audioInLeft, chorusDelayQ16 + chorusLfoOffset);
+      int32_t delVal2 = chorusDelay2.nextFrac(audioInRight, chorusDelay2Q16 + chorusLfoOffset);
       int32_t inVal = (audioInLeft * (chorusMixInput))>>10;
       int32_t inVal2 = (audioInRight * (chorusMixInput))>>10;
       delVal = (delVal * chorusMixDelay)>>10;
@@ -349,6 +396,7 @@ class FX {
     inline
     void setChorusWidth(float depth) {
       chorusLfoWidth = pow(max(0.0f, depth), 1.5) * 3.0d;
+      updateChorusTimes();
     }
 
     /** Set the chorus rate
@@ -379,8 +427,54 @@ class FX {
     void setChorusDelayTime(float time) {
       chorusDelayTime = min(40.0f, max(0.0f, time));
       chorusDelayTime2 = min(40.0f, max(0.0f, time * 0.74f));
+      updateChorusTimes();
+    }
+
+
+    /** Allocate the pluck buffer now, rather than on the first pluck() call from the audio task
+    * Call from setup().
+    */
+    void initPluckBuffer() {
+      if (pluckBufferEstablished) return;
+      pluckBuffer = (int *)audioAlloc(PLUCK_BUFFER_SIZE * sizeof(int)); // from the M16 audio arena
+      for(int i=0; i<PLUCK_BUFFER_SIZE; i++) {
+        pluckBuffer[i] = 0;
+      }
+      pluckBufferEstablished = true;
+    }
+
+    /** Allocate the chorus delays now, rather than on the first chorus() call from the audio task
+    * Call from setup().
+    */
+    void initChorus() {
+      if (chorusInitiated) return;
+      chorusLfo.setTable(Osc::getTable(OSC_SIN, chorusTableSize), chorusTableSize); // shared, in flash on ESP32
+      chorusLfo.setFixedPhase(true);
+      chorusLfo.setInterpolate(true); // smooth delay sweeps from the small table
+      chorusLfo.setFreq(chorusLfoRate);
+      chorusDelay.setMaxDelayTime(chorusDelayTime + 3);
+      chorusDelay2.setMaxDelayTime(chorusDelayTime2 + 3);
+      setChorusFeedback(chorusFeedback);
+      updateChorusTimes();
+      chorusInitiated = true;
     }
 
+    /** Allocate the reverb lines now, rather than on the first reverb call from the audio task
+    * Call from setup(). setReverbSize() and setReverbLength() also allocate them.
+    * @return false if there was no memory for them, the reverb then passes audio through dry
+    */
+    bool initReverb() {
+      return initReverb(reverbSize);
+    }
+
+    /** Round each reverb line up to a power of two length, so it wraps with a mask rather than a compare
+    * Uses up to twice the memory, e.g. 117 KB rather than 75 KB at size 16, so best with PSRAM or small sizes.
+    * @state true for power of two lengths, false for exact lengths (the default)
+    */
+    void setReverbPowerOf2(bool state) {
+      reverbPowerOf2 = state;
+      if (reverbInitiated) initReverb(reverbSize);
+    }
 
   private:
     const static int16_t PLUCK_BUFFER_SIZE = 500;
@@ -395,6 +489,9 @@ class FX {
     // float reverbTime = 0.49999; // 0 to 0.5
     Del delay1, delay2, delay3, delay4;
     APF apf1, apf2, apf3, apf4;
+    int16_t * reverbBuffer = nullptr; // shared memory for the reverb delay and allpass lines
+    bool reverbPowerOf2 = false;
+    unsigned int reverbBufferSize = 0;
     // APF apf1 = APF(0.4494, 0.9);
     // APF apf2 = APF(0.7214, 0.9);
     // APF apf3 = APF(3.875, 0.9);
@@ -411,29 +508,60 @@ class FX {
     int chorusMixInput = 600; // 0 - 1024
     int chorusMixDelay = 800; // 0 - 1024
     float chorusFeedback = 0.4; // 0.0 to 1.0
-    int16_t * chorusLfoTable;
+    static const int chorusTableSize = 256; // an interpolated LFO needs only a small table
     Osc chorusLfo;
     Del chorusDelay, chorusDelay2;
-
-    void initPluckBuffer() {
-      pluckBuffer = new int[PLUCK_BUFFER_SIZE]; // create a new array
-      for(int i=0; i<PLUCK_BUFFER_SIZE; i++) {
-        pluckBuffer[i] = 0;
-      }
-      pluckBufferEstablished = true;
-    }
-
-    /** Set the reverb params */
-    void initReverb() {
-      initReverb(reverbSize);
+    // chorus delay times and LFO width in samples, as 16.16 fixed point
+    uint32_t chorusDelayQ16, chorusDelay2Q16;
+    int32_t chorusLfoWidthQ16;
+
+    /** Convert chorus times from ms to fixed point samples, once per change rather than every sample */
+    void updateChorusTimes() {
+      const float msToQ16 = SAMPLE_RATE * 0.001f * 65536.0f;
+      chorusDelayQ16 = chorusDelayTime * msToQ16;
+      chorusDelay2Q16 = chorusDelayTime2 * msToQ16;
+      chorusLfoWidthQ16 = chorusLfoWidth * msToQ16;
     }
 
     /** Set the reverb params
     * @size Bigger sizes increase delay line times for better quality but use more memory (x2, x3, x4, etc.)
     */
-    void initReverb(float size) { // 1/8 of Pd values
-      delay1.setMaxDelayTime(8 * size); delay2.setMaxDelayTime(9 * size);
-      delay3.setMaxDelayTime(11 * size); delay4.setMaxDelayTime(13 * size);
+    bool initReverb(float size) { // 1/8 of Pd values
+      // all eight lines share one contiguous block, each exactly as long as it needs to be,
+      // or a power of two long to wrap with a mask after setReverbPowerOf2(true)
+      const float msToSamples = SAMPLE_RATE * 0.001f;
+      unsigned int lengths[8] = {
+        (unsigned int)(8 * size * msToSamples), (unsigned int)(9 * size * msToSamples),
+        (unsigned int)(11 * size * msToSamples), (unsigned int)(13 * size * msToSamples),
+        (unsigned int)(0.4494 * size * msToSamples + 1), (unsigned int)(2.875 * size * msToSamples + 1),
+        (unsigned int)(0.5964 * size * msToSamples + 1), (unsigned int)(3.875 * size * msToSamples + 1)};
+      unsigned int total = 0;
+      for (int i=0; i<8; i++) {
+        if (reverbPowerOf2) lengths[i] = nextPowerOf2(lengths[i]);
+        total += lengths[i];
+      }
+      reverbInitiated = true; // set even on failure, so the audio task doesn't retry
+      if (total > reverbBufferSize) { // only allocate when growing
+        audioFree(reverbBuffer); // taken back by the arena when it was the latest allocation
+        int16_t * newBuffer = (int16_t *)audioAlloc(total * sizeof(int16_t)); // from the M16 audio arena
+        if (newBuffer == nullptr) {
+          reverbBuffer = nullptr;
+          reverbBufferSize = 0;
+          Serial.println("FX reverb: not enough memory, try a smaller setReverbSize()");
+          return false;
+        }
+        reverbBuffer = newBuffer;
+        reverbBufferSize = total;
+      }
+      int16_t * line = reverbBuffer;
+      delay1.setBuffer(line, lengths[0]); line += lengths[0];
+      delay2.setBuffer(line, lengths[1]); line += lengths[1];
+      delay3.setBuffer(line, lengths[2]); line += lengths[2];
+      delay4.setBuffer(line, lengths[3]); line += lengths[3];
+      apf1.setBuffer(line, lengths[4]); line += lengths[4];
+      apf2.setBuffer(line, lengths[5]); line += lengths[5];
+      apf3.setBuffer(line, lengths[6]); line += lengths[6];
+      apf4.setBuffer(line, lengths[7]);
       delay1.setTime(7.5 * size); delay1.setLevel(reverbFeedbackLevel); delay1.setFeedback(true);
       delay2.setTime(8.993 * size); delay2.setLevel(reverbFeedbackLevel); delay2.setFeedback(true);
       delay3.setTime(10.844 * size); delay3.setLevel(reverbFeedbackLevel); delay3.setFeedback(true);
@@ -446,7 +574,7 @@ class FX {
       // apf2.setTime(11.125 * size); apf2.setLevel(0.9);
       apf2.setTime(2.875 * size); apf2.setPhase(0.2); // apf2.setLevel(0.8);
       // apf4.setTime(7.5 * size); apf4.setLevel(0.9);
-      reverbInitiated = true;
+      return true;
     }
 
     /** Compute reverb */
@@ -465,17 +593,6 @@ class FX {
       delay1.write(revP5); delay2.write(revP6); delay3.write(revM5); delay4.write(revM6);
       // delay1.write(revP5 * reverbTime); delay2.write(revP6 * reverbTime); delay3.write(revM5 * reverbTime); delay4.write(revM6 * reverbTime);
     }
-
-    void initChorus() {
-      chorusLfoTable = new int16_t[TABLE_SIZE]; // create a new array
-      Osc::sinGen(chorusLfoTable); // fill the wavetable
-      chorusLfo.setTable(chorusLfoTable);
-      chorusLfo.setFreq(chorusLfoRate);
-      chorusDelay.setMaxDelayTime(chorusDelayTime + 3);
-      chorusDelay2.setMaxDelayTime(chorusDelayTime2 + 3);
-      setChorusFeedback(chorusFeedback);
-      chorusInitiated = true;
-    }
 };
 
 #endif /* FX_H_ */
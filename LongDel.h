@@ -0,0 +1,235 @@
+/*
+ * LongDel.h
+ *
+ * A long audio delay line class, for tape delays and loopers.
+ * The buffer is kept in PSRAM, where available, and the read and write heads
+ * work on small blocks cached in internal RAM.
+ *
+ * by Andrew R. Brown 2025
+ *
+ * This file is part of the M16 audio library. Relies on M16.h
+ *
+ * M16 is licensed under a Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International License.
+ */
+
+#ifndef LONGDEL_H_
+#define LONGDEL_H_
+
+// samples per cache block, the delay time must be at least 3 blocks
+#ifndef LONGDEL_BLOCK_SIZE
+  #define LONGDEL_BLOCK_SIZE 128
+#endif
+
+class LongDel {
+
+private:
+  static const unsigned int BLOCK = LONGDEL_BLOCK_SIZE;
+  int16_t * delayBuffer = nullptr; // in PSRAM where available
+  unsigned int delayBufferSize_samples = 0; // a whole number of blocks
+  int16_t writeCache[BLOCK];
+  int16_t readCache[2][BLOCK]; // the block being read and the next one, prefetched
+  int readCacheBlock[2] = {-1, -1};
+  int currReadCache = 0;
+  unsigned int writePos = 0;
+  float maxDelayTime_ms = 0;
+  float delayTime_ms = 0;
+  unsigned int delayTime_samples = 0;
+  int16_t delayLevel = 1024; // 0 to 1024
+  bool delayFeedback = false;
+  int16_t feedbackLevel = 512; // 0 to 1024
+  bool hold = false;
+
+public:
+  /** Constructor.
+	* Create but don't setup delay.
+  * To use, setMaxDelayTime() must be called to initiate the audio buffer.
+	*/
+	LongDel() {};
+
+  /** Constructor.
+	* Create and setup delay.
+  * @param maxDelayTime The maximum delay time in milliseconds
+  * @param msDur The initial delay time in milliseconds, up to maxDelayTime
+	*/
+	LongDel(unsigned long maxDelayTime, float msDur) {
+    setMaxDelayTime(maxDelayTime);
+    setTime(msDur);
+  }
+
+  ~LongDel() {
+    audioFree(delayBuffer);
+  }
+
+  /**
+   * Set the maximum delay time in milliseconds, allocating the buffer in PSRAM where available.
+   * At 48kHz each second of delay uses 96 KB.
+   * @param maxDelayTime The maximum delay time in milliseconds
+   */
+  void setMaxDelayTime(unsigned long maxDelayTime) {
+    audioFree(delayBuffer); // remove any previous memory allocation
+    unsigned long samples = (uint64_t)maxDelayTime * SAMPLE_RATE / 1000; // multiply first, 44100 / 1000 is not whole
+    samples = max((unsigned long)BLOCK * 4, ((samples + BLOCK - 1) / BLOCK) * BLOCK); // whole blocks
+    delayBuffer = (int16_t *)audioAlloc(samples * sizeof(int16_t), true);
+    delayBufferSize_samples = (delayBuffer != nullptr) ? samples : 0;
+    maxDelayTime_ms = delayBufferSize_samples / (SAMPLE_RATE * 0.001f);
+    empty();
+  }
+
+  /** Return the size of the delay buffer in ms */
+  float getBufferSize() {
+    return maxDelayTime_ms;
+  }
+
+  /** Return the size of the delay buffer in samples */
+  unsigned int getBufferLength() {
+    return delayBufferSize_samples;
+  }
+
+  /** Specify the delay duration in milliseconds
+  * The shortest delay is three cache blocks, 8ms by default
+  */
+  void setTime(float msDur) {
+    delayTime_ms = min(maxDelayTime_ms, max(0.0f, msDur));
+    delayTime_samples = min(delayBufferSize_samples, max(BLOCK * 3, (unsigned int)(delayTime_ms * SAMPLE_RATE * 0.001f)));
+  }
+
+  /** Return the delay duration in milliseconds */
+  float getTime() {
+    return delayTime_ms;
+  }
+
+  /** Return the delay length in samples */
+  unsigned int getDelayLength() {
+    return delayTime_samples;
+  }
+
+  /** Specify the delay output level, from 0.0 to 1.0 */
+  void setLevel(float level) {
+    delayLevel = min(1024, max(0, (int)(pow(level, 0.8) * 1024.0f)));
+  }
+
+  /** Return the delay level, from 0.0 to 1.0 */
+  float getLevel() {
+    return delayLevel * 0.0009765625f;
+  }
+
+  /** Turn delay feedback on or off */
+  void setFeedback(bool state) {
+    delayFeedback = state;
+  }
+
+  /** Specify the delay feedback level, from 0.0 to 1.0 */
+  void setFeedbackLevel(float level) {
+    setFeedback(true); // ensure feedback is on
+    feedbackLevel = min(1024, max(0, (int)(pow(level, 0.8) * 1024.0f)));
+  }
+
+  /** Return the delay feedback level, from 0.0 to 1.0 */
+  float getFeedbackLevel() {
+    return feedbackLevel * 0.0009765625f;
+  }
+
+  /** Hold the current contents of the delay as a loop.
+  * While held, input is ignored and the delayed signal is recirculated unchanged.
+  * @param state true to loop, false to record
+  */
+  void setHold(bool state) {
+    hold = state;
+  }
+
+  /** Return true if the delay is looping its contents */
+  bool getHold() {
+    return hold;
+  }
+
+  /** Fill the delay with silence */
+  void empty() {
+    for (unsigned int i=0; i<delayBufferSize_samples; i++) {
+      delayBuffer[i] = 0;
+    }
+    for (unsigned int i=0; i<BLOCK; i++) {
+      writeCache[i] = 0;
+    }
+    readCacheBlock[0] = readCacheBlock[1] = -1;
+    writePos = 0;
+  }
+
+  /** Input a value to the delay and retrieve the signal delayed by delayTime milliseconds.
+	* @param inValue The signal input.
+	*/
+	inline
+	int16_t next(int32_t inValue) {
+    if (delayBufferSize_samples == 0) return 0;
+    int32_t delayedValue = readRaw();
+    int32_t outValue = (delayedValue * delayLevel)>>10;
+    if (hold) {
+      inValue = delayedValue;
+    } else if (delayFeedback) {
+      inValue = inValue + ((delayedValue * feedbackLevel)>>10);
+    }
+    write(inValue);
+    return outValue;
+  }
+
+  /** Input a block of values to the delay and retrieve the signal delayed by delayTime milliseconds.
+	* @param input The signal input samples.
+	* @param output The buffer to fill with delayed samples.
+	* @param n The number of samples to process.
+	*/
+	inline
+	void next(const int32_t * input, int16_t * output, size_t n) {
+    for (size_t i=0; i<n; i++) {
+      output[i] = next(input[i]);
+    }
+  }
+
+  /** Read the buffer at the delayTime without incrementing read/write index */
+  inline
+	int16_t read() {
+    if (delayBufferSize_samples == 0) return 0;
+    return (readRaw() * delayLevel)>>10;
+  }
+
+  /** Write a value to the delay and increment the write index
+  * @param inVal The signal input.
+  */
+  inline
+	void write(int32_t inValue) {
+    writeCache[writePos % BLOCK] = min(MAX_16, max(MIN_16, (int)inValue));
+    writePos++;
+    if (writePos % BLOCK == 0) { // flush the full block to the main buffer
+      memcpy(delayBuffer + writePos - BLOCK, writeCache, BLOCK * sizeof(int16_t));
+      if (writePos >= delayBufferSize_samples) writePos = 0;
+    }
+  }
+
+private:
+  /** Return the unscaled sample at the delay time, from the read cache */
+  inline
+  int16_t readRaw() {
+    int readPos = writePos - delayTime_samples;
+    if (readPos < 0) readPos += delayBufferSize_samples;
+    int block = readPos / BLOCK;
+    if (block != readCacheBlock[currReadCache]) {
+      int nextCache = currReadCache ^ 1;
+      if (block == readCacheBlock[nextCache]) {
+        currReadCache = nextCache; // moved on to the prefetched block
+      } else {
+        loadBlock(currReadCache, block); // delay time changed, reload
+      }
+      int nextBlock = block + 1;
+      if (nextBlock * BLOCK >= delayBufferSize_samples) nextBlock = 0;
+      loadBlock(currReadCache ^ 1, nextBlock); // prefetch the next block
+    }
+    return readCache[currReadCache][readPos % BLOCK];
+  }
+
+  /** Copy a block from the main buffer into a read cache */
+  inline
+  void loadBlock(int cache, int block) {
+    memcpy(readCache[cache], delayBuffer + block * BLOCK, BLOCK * sizeof(int16_t));
+    readCacheBlock[cache] = block;
+  }
+};
+
+#endif /* LONGDEL_H_ */
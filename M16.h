@@ -21,43 +21,364 @@
 #define IS_ESP32C3() (defined(CONFIG_IDF_TARGET_ESP32C3))
 
 // globals
+// define SAMPLE_RATE before including M16.h to change it, e.g. 22050 for a lighter load on ESP8266
+#ifndef SAMPLE_RATE
 #define SAMPLE_RATE 48000
+#endif
 const float SAMPLE_RATE_INV  = 1.0f / SAMPLE_RATE;
 #define MAX_16 32767
 #define MIN_16 -32767
 #define MAX_16_INV 0.00003052
 
-const int16_t TABLE_SIZE = 4096; //8192; // 2048 // 4096 // 8192 // 16384 //32768 // 65536 //uint16_t
+// define M16_TABLE_BITS before including M16.h to change the wavetable size, e.g. 11 for 2048 samples
+#ifndef M16_TABLE_BITS
+#define M16_TABLE_BITS 12
+#endif
+#if M16_TABLE_BITS < 8 || M16_TABLE_BITS > 14
+#error "M16_TABLE_BITS must be from 8 to 14"
+#endif
+
+const int16_t TABLE_SIZE = 1 << M16_TABLE_BITS; // 4096 by default
 const float TABLE_SIZE_INV = 1.0f / TABLE_SIZE;
-const int16_t HALF_TABLE_SIZE = 2048; //TABLE_SIZE / 2;
+const int16_t HALF_TABLE_SIZE = TABLE_SIZE / 2;
+const int16_t TABLE_BITS = M16_TABLE_BITS; // log2(TABLE_SIZE), used by fixed point phase accumulators
+const int MIPMAP_SIZE = TABLE_SIZE * 2; // space for band limited tables at one level per octave
 
 int16_t prevWaveVal = 0;
 int16_t leftAudioOuputValue = 0;
 int16_t rightAudioOuputValue = 0;
 
+// define M16_FAST_MATH before including M16.h to replace pow() and cos() in
+// mtof(), panLeft(), panRight() and sigmoid() with interpolated lookup tables
+const int MTOF_TABLE_SIZE = 130; // one entry per MIDI pitch 0 - 129
+const int CURVE_TABLE_SIZE = 257; // 256 steps across 0.0 - 1.0
+#ifdef M16_FAST_MATH
+  float mtofTable[MTOF_TABLE_SIZE];
+  float panLeftTable[CURVE_TABLE_SIZE];
+  float panRightTable[CURVE_TABLE_SIZE];
+  float sigmoidTable[CURVE_TABLE_SIZE];
+#endif
+bool fastMathReady = false;
+
+/** Fill the fast math lookup tables.
+* Called by audioStart(), or on first use if that is earlier.
+*/
+void fastMathInit() {
+  #ifdef M16_FAST_MATH
+    for (int i=0; i<MTOF_TABLE_SIZE; i++) {
+      mtofTable[i] = 8.1757989156 * pow(2.0, i * 0.083333);
+    }
+    for (int i=0; i<CURVE_TABLE_SIZE; i++) {
+      float x = i / (CURVE_TABLE_SIZE - 1.0f);
+      panLeftTable[i] = max(0.0, min(1.0, cos(6.291 * x * 0.25)));
+      panRightTable[i] = max(0.0, min(1.0, cos(6.291 * (x * 0.25 + 0.75))));
+      if (x > 0.5) {
+        sigmoidTable[i] = 0.5 + pow((x - 0.5)* 2, 4) * 0.5f;
+      } else sigmoidTable[i] = max(0.0, pow(x * 2, 0.25) * 0.5f);
+    }
+    panLeftTable[0] = 1; panLeftTable[CURVE_TABLE_SIZE - 1] = 0;
+    panRightTable[0] = 0; panRightTable[CURVE_TABLE_SIZE - 1] = 1;
+  #endif
+  fastMathReady = true;
+}
+
+// Audio memory arena
+// Delay lines and effect buffers are handed out from one block reserved by audioStart(),
+// or by the first audioAlloc(), keeping them together and out of the fragmented heap.
+// Define M16_ARENA_SIZE before including M16.h to change the size in bytes.
+// ESP8266 has little heap to spare, so there the arena is off (0) unless a size is defined,
+// and audioAlloc() uses the heap.
+// Buffers are allocated when an object is created or sized, so do that in setup().
+// Growing a buffer from the audio task, e.g. with Del::setMaxDelayTime(), allocates there,
+// from the heap once the arena is full.
+#ifndef M16_ARENA_SIZE
+  #if IS_ESP8266()
+    #define M16_ARENA_SIZE 0
+  #else
+    #define M16_ARENA_SIZE 32768
+  #endif
+#endif
+#if IS_ESP32()
+  #include "esp_heap_caps.h"
+#endif
+uint8_t * audioArena = nullptr;
+size_t audioArenaSize = 0;
+size_t audioArenaUsed = 0;
+size_t audioArenaLast = 0; // offset of the latest allocation, which audioFree() can take back
+bool audioArenaReady = false;
+
+/** Reserve memory for the audio arena.
+* Called by audioStart(), call earlier to use a different size. Only the first call has an effect.
+* @bytes The size of the arena
+*/
+void audioArenaInit(size_t bytes = M16_ARENA_SIZE) {
+  if (audioArenaReady) return;
+  audioArenaReady = true;
+  audioArena = (bytes > 0) ? (uint8_t *)malloc(bytes) : nullptr;
+  audioArenaSize = (audioArena != nullptr) ? bytes : 0;
+  audioArenaUsed = 0;
+}
+
+/** Return the number of bytes left in the audio arena */
+size_t audioArenaFree() {
+  return audioArenaSize - audioArenaUsed;
+}
+
+/** Allocate audio memory
+* Taken from the arena when there is room, otherwise from the heap.
+* Arena memory is never returned, so size buffers for their largest use.
+* @bytes The size required
+* @psram Place the memory in PSRAM, if available, e.g. for long delays. ESP32 only.
+*/
+void * audioAlloc(size_t bytes, bool psram = false) {
+  bytes = (bytes + 3) & ~(size_t)3; // keep 32 bit alignment
+  #if IS_ESP32()
+    if (psram && psramFound()) {
+      void * mem = heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+      if (mem != nullptr) return mem;
+    }
+  #endif
+  if (!audioArenaReady) audioArenaInit();
+  if (audioArenaUsed + bytes <= audioArenaSize) {
+    void * mem = audioArena + audioArenaUsed;
+    audioArenaLast = audioArenaUsed;
+    audioArenaUsed += bytes;
+    return mem;
+  }
+  return malloc(bytes); // arena full, fall back to the heap
+}
+
+/** Release memory from audioAlloc()
+* Heap and PSRAM memory is freed. Arena memory is only taken back when it was the
+* latest allocation, as when the last buffer made is regrown, otherwise it is left in place.
+*/
+void audioFree(void * mem) {
+  if (mem == nullptr) return;
+  if (audioArena != nullptr && (uint8_t *)mem >= audioArena && (uint8_t *)mem < audioArena + audioArenaSize) {
+    if ((uint8_t *)mem == audioArena + audioArenaLast) audioArenaUsed = audioArenaLast;
+    return;
+  }
+  free(mem);
+}
+
+/** Return an interpolated value from a CURVE_TABLE_SIZE lookup table
+* @table The curve to read
+* @x The position along the curve, 0.0 - 1.0
+*/
+inline
+float curveLookup(float * table, float x) {
+  float pos = max(0.0f, min(1.0f, x)) * (CURVE_TABLE_SIZE - 1);
+  int index = min(CURVE_TABLE_SIZE - 2, (int)pos);
+  float frac = pos - index;
+  return table[index] + (table[index + 1] - table[index]) * frac;
+}
+
 // ESP32 - GPIO 25 -> BCLK, GPIO 12 -> DIN, and GPIO 27 -> LRCLK (WS)
 // ESP8266 I2S interface (D1 mini pins) BCLK->BCK (D8 GPIO15), I2SO->DOUT (RX GPIO3), and LRCLK(WS)->LCK (D4 GPIO2) [SCK to GND on some boards]
 
+// Control rate scheduler
+// Define a void controlUpdate() function to have it called every M16_CONTROL_PERIOD samples
+// from the audio task, e.g. to update envelopes and modulation at a fixed rate.
+#ifndef M16_CONTROL_PERIOD
+  #define M16_CONTROL_PERIOD 32
+#endif
+const float CONTROL_RATE = (float)SAMPLE_RATE / M16_CONTROL_PERIOD; // controlUpdate() calls per second
+void controlUpdate() __attribute__((weak)); // optional, overridden by function in program code
+volatile uint32_t audioSampleCount = 0; // samples rendered since audioStart()
+uint32_t controlCountdown = 0; // samples until the next controlUpdate()
+size_t audioBlockPos = 0; // offset of the part of the DMA block being rendered, when it is split
+
+/** Count rendered samples and call controlUpdate() when it is due, for per sample rendering
+* @n The number of samples just rendered
+*/
+inline
+void controlTick(size_t n) {
+  audioSampleCount = audioSampleCount + n;
+  if (!controlUpdate) return;
+  if (controlCountdown <= n) {
+    controlUpdate();
+    controlCountdown = M16_CONTROL_PERIOD;
+  } else controlCountdown -= n;
+}
+
+/** Render one piece of a block that is split, e.g. at control ticks, clock steps or timed events
+* Sets audioBlockPos for the piece, so Mic input blocks line up with it, then restores it.
+* @render The block render function
+* @left The left channel block
+* @right The right channel block
+* @from The offset of the piece in the block
+* @to The offset just after the piece
+*/
+inline
+void renderPiece(void (*render)(int16_t *, int16_t *, size_t), int16_t * left, int16_t * right, size_t from, size_t to) {
+  if (to <= from) return;
+  size_t blockPos = audioBlockPos;
+  audioBlockPos = blockPos + from;
+  render(left + from, right + from, to - from);
+  audioBlockPos = blockPos;
+}
+
+/** Render a block, split into sub-blocks that end on control ticks so controlUpdate() is called on time
+* @render The block render function
+* @left The left channel block
+* @right The right channel block
+* @n The number of samples in each channel
+*/
+inline
+void renderBlock(void (*render)(int16_t *, int16_t *, size_t), int16_t * left, int16_t * right, size_t n) {
+  if (!controlUpdate) {
+    render(left, right, n);
+    audioSampleCount = audioSampleCount + n;
+    return;
+  }
+  size_t done = 0;
+  while (done < n) {
+    if (controlCountdown == 0) {
+      controlUpdate();
+      controlCountdown = M16_CONTROL_PERIOD;
+    }
+    size_t len = min(n - done, (size_t)controlCountdown);
+    renderPiece(render, left, right, done, done + len);
+    done += len;
+    controlCountdown -= len;
+    audioSampleCount = audioSampleCount + len;
+  }
+}
+
+// Audio task profiling, using the CPU cycle counter
+// The audio task is busy except while it waits for space in the I2S DMA buffer,
+// so the load is the share of cycles not spent waiting, over windows of about 100 ms.
+struct AudioProfile {
+  uint32_t last = 0; // cycle count at the end of the last wait
+  uint32_t busy = 0;
+  uint32_t total = 0;
+  volatile float load = 0;
+  volatile float peak = 0;
+};
+AudioProfile audioProfile[2]; // one per core
+volatile uint32_t audioUnderruns = 0; // times the DMA buffer ran out of samples
+volatile uint32_t audioProfileWindows = 0; // counts core 0 load updates
+uint32_t audioProfileWindowCycles = 0; // the length of the last core 0 window
+uint32_t audioCyclesPerWindow = 16000000; // set by audioStart()
+uint32_t audioCyclesPerSample = 1000; // set by audioStart()
+
+/** Return the CPU cycle count */
+inline
+uint32_t audioCycles() {
+  return ESP.getCycleCount();
+}
+
+/** Set the cycle budgets from the CPU clock, called by audioStart() */
+void audioProfileInit() {
+  uint32_t mhz = ESP.getCpuFreqMHz();
+  audioCyclesPerSample = mhz * 1000000 / SAMPLE_RATE;
+  audioCyclesPerWindow = mhz * 100000; // 100 ms
+}
+
+/** Record a wait by the audio task, updating the load when a window is complete
+* @core The core the audio task runs on
+* @waitStart The cycle count when the wait began
+* @waitEnd The cycle count when the wait ended
+*/
+inline
+void audioProfileWait(int core, uint32_t waitStart, uint32_t waitEnd) {
+  AudioProfile &p = audioProfile[core];
+  if (p.last == 0) {
+    p.last = waitEnd;
+    return;
+  }
+  p.busy += waitStart - p.last;
+  p.total += waitEnd - p.last;
+  p.last = waitEnd;
+  if (p.total >= audioCyclesPerWindow) {
+    float load = (float)p.busy / p.total;
+    p.load = load;
+    if (load > p.peak) p.peak = load;
+    if (core == 0) {
+      audioProfileWindowCycles = p.total;
+      audioProfileWindows = audioProfileWindows + 1;
+    }
+    p.busy = p.total = 0;
+  }
+}
+
+/** Return the audio task CPU load as a percentage, averaged over about 100 ms
+* @core The core, 0 or 1. On ESP32 in per sample or dual core block mode there is an audio task on each.
+*/
+float audioCpuLoad(int core = 0) {
+  return audioProfile[max(0, min(1, core))].load * 100;
+}
+
+/** Return the highest audio task CPU load as a percentage since the last reset
+* @core The core, 0 or 1
+*/
+float audioCpuPeak(int core = 0) {
+  return audioProfile[max(0, min(1, core))].peak * 100;
+}
+
+/** Clear the highest audio task CPU load on both cores */
+void audioCpuPeakReset() {
+  audioProfile[0].peak = audioProfile[1].peak = 0;
+}
+
+/** Return the number of times the I2S DMA buffer has run out of samples since audioStart()
+* Counted in block mode on ESP32 and in both modes on ESP8266.
+*/
+uint32_t audioUnderrunCount() {
+  return audioUnderruns;
+}
+
 #if IS_ESP8266()
   // to flash Wemos D1 R1 with I2S board connected, seems you need to disconnect D4 & RX???
   #include <I2S.h>
 
-  void audioUpdate(); // overridden by function in program code
+  void audioUpdate() __attribute__((weak)); // overridden by function in program code
+  void audioUpdateBlock(int16_t * left, int16_t * right, size_t n) __attribute__((weak)); // optional block version
+
+  static const int dmaBufferLength = 64; // samples per audioUpdateBlock() call
+  int16_t audioBlockLeft[dmaBufferLength];
+  int16_t audioBlockRight[dmaBufferLength];
 
   /** Setup audio output callback for ESP8266*/
   // void ICACHE_RAM_ATTR onTimerISR() { //Code needs to be in IRAM because its a ISR
+  uint32_t audioISRExit = 0; // cycle count as the last ISR finished
+
   void IRAM_ATTR onTimerISR() { //Code needs to be in IRAM because its a ISR
-    while (!(i2s_is_full())) { //Don’t block the ISR if the buffer is full
-      audioUpdate();
+    audioProfileWait(0, audioISRExit, audioCycles()); // idle between ISRs
+    if (audioSampleCount > 0 && i2s_is_empty()) audioUnderruns = audioUnderruns + 1;
+    if (audioUpdateBlock) {
+      size_t n = min((size_t)i2s_available(), (size_t)dmaBufferLength);
+      while (n > 0) { //Only render what fits, so the ISR never blocks
+        renderBlock(audioUpdateBlock, audioBlockLeft, audioBlockRight, n);
+        for (size_t i=0; i<n; i++) {
+          i2s_write_lr(audioBlockLeft[i] * 0.98, audioBlockRight[i] * 0.98); // * 0.98 to avoid DAC distortion at extremes
+        }
+        leftAudioOuputValue = audioBlockLeft[n - 1];
+        rightAudioOuputValue = audioBlockRight[n - 1];
+        n = min((size_t)i2s_available(), (size_t)dmaBufferLength);
+      }
+    } else {
+      while (!(i2s_is_full())) { //Don’t block the ISR if the buffer is full
+        audioUpdate();
+        controlTick(1);
+      }
     }
     timer1_write(2000);//Next callback in 2mS
+    audioISRExit = audioCycles();
   }
 
   /** Start the audio callback
    *  This function is typically called in setup() in the main file
    */
   void audioStart() {
+    if (!audioUpdate && !audioUpdateBlock) { // the ISR would call a function that isn't there
+      Serial.println("M16 not started: define audioUpdate() or audioUpdateBlock()");
+      return;
+    }
+    if (!fastMathReady) fastMathInit(); // before the ISR can run audio code that uses them
+    audioArenaInit();
     I2S.begin(I2S_PHILIPS_MODE, SAMPLE_RATE, 16);
+    audioProfileInit();
     timer1_attachInterrupt(onTimerISR); //Attach our sampling ISR
     timer1_enable(TIM_DIV16, TIM_EDGE, TIM_SINGLE);
     timer1_write(2000); //Service at 2mS intervall
@@ -154,41 +475,222 @@ int16_t rightAudioOuputValue = 0;
   i2s_channel_enable(tx_handle);
   i2s_channel_write(tx_handle, src_buf, bytes_to_write, bytes_written, ticks_to_wait);
 */
-  void audioUpdate();
+  void audioUpdate() __attribute__((weak)); // overridden by function in program code
+  void audioUpdateBlock(int16_t * left, int16_t * right, size_t n) __attribute__((weak)); // optional block version
+
+  void audioUpdateBlockCore1(int16_t * left, int16_t * right, size_t n) __attribute__((weak)); // optional part of the render for core 1
+
+  int16_t audioBlockLeft[dmaBufferLength];
+  int16_t audioBlockRight[dmaBufferLength];
+  uint32_t audioBlockOut[dmaBufferLength];
 
-  /** Function for RTOS tasks to fill audio buffer */
+  // Full duplex input, read from the I2S RX DMA once per output block when a Mic is used in block mode
+  bool audioInputEnabled = false;
+  uint32_t audioBlockIn[dmaBufferLength];
+  int16_t audioInputLeft[dmaBufferLength];
+  int16_t audioInputRight[dmaBufferLength];
+
+  TaskHandle_t audioCallback1Handle = NULL;
+  TaskHandle_t audioCallback2Handle = NULL;
+
+  /** Lock-free single producer (core 1), single consumer (core 0) queue of audio blocks.
+  * Core 1 renders ahead by up to audioBlockQueueLength blocks.
+  */
+  static const int audioBlockQueueLength = 2;
+  int16_t core1BlockLeft[audioBlockQueueLength][dmaBufferLength];
+  int16_t core1BlockRight[audioBlockQueueLength][dmaBufferLength];
+  volatile uint32_t core1BlocksWritten = 0; // only changed by core 1
+  volatile uint32_t core1BlocksRead = 0; // only changed by core 0
+
+  uint32_t controlNextCount = 0; // audioSampleCount of the next per sample mode controlUpdate()
+
+  /** Call controlUpdate() for each control period written by either per sample task since the last call */
+  inline
+  void controlCatchUp() {
+    if (!controlUpdate) return;
+    while ((int32_t)(audioSampleCount - controlNextCount) >= 0) {
+      controlUpdate();
+      controlNextCount += M16_CONTROL_PERIOD;
+    }
+  }
+
+  /** Function for RTOS tasks to fill audio buffer
+  * Both tasks write samples, which i2s_write_samples() counts, and only one runs controlUpdate().
+  */
   void audioCallback(void * paramRequiredButNotUsed) {
+    bool controlTask = xPortGetCoreID() == 0;
     for(;;) { // Looks ugly, but necesary. RTOS manages thread
       audioUpdate();
+      if (controlTask) controlCatchUp();
       yield();
     }
   }
 
+  uint32_t dmaQueuedCycles = 0; // estimated audio left in the DMA buffer, in cycles
+  uint32_t dmaLastWrite = 0; // cycle count at the end of the last block write
+
+  /** Estimate the DMA buffer level across block writes and count underruns.
+  * A write that waits leaves the buffer full. Between writes it drains in real time,
+  * so a gap longer than the audio it held means it ran dry.
+  */
+  inline
+  void checkUnderrun(uint32_t waitStart, uint32_t waitEnd, size_t n) {
+    uint32_t blockCycles = n * audioCyclesPerSample;
+    uint32_t fullCycles = i2s_config.dma_buf_count * dmaBufferLength * audioCyclesPerSample;
+    if (dmaLastWrite != 0) {
+      uint32_t gap = waitStart - dmaLastWrite;
+      if (gap > dmaQueuedCycles) {
+        audioUnderruns = audioUnderruns + 1;
+        dmaQueuedCycles = 0;
+      } else dmaQueuedCycles -= gap;
+    }
+    uint32_t waited = waitEnd - waitStart;
+    if (waited > blockCycles / 4) {
+      dmaQueuedCycles = fullCycles;
+    } else dmaQueuedCycles = min(fullCycles, dmaQueuedCycles - min(dmaQueuedCycles, waited) + blockCycles);
+    dmaLastWrite = waitEnd;
+  }
+
+  /** Write a block of left and right samples to the DMA buffer with a single i2s_write() 
+  * @left The left channel samples
+  * @right The right channel samples
+  * @n The number of samples in each channel, up to dmaBufferLength
+  */
+  bool i2s_write_block(int16_t * left, int16_t * right, size_t n) {
+    for (size_t i=0; i<n; i++) {
+      audioBlockOut[i] = (left[i] << 16) | (right[i] & 0xffff); // Combine both left and right channels
+    }
+    leftAudioOuputValue = left[n - 1];
+    rightAudioOuputValue = right[n - 1];
+    size_t bytesWritten = 0;
+    uint32_t waitStart = audioCycles();
+    i2s_write(i2s_num, audioBlockOut, n * 4, &bytesWritten, portMAX_DELAY); // blocks until DMA space is free
+    uint32_t waitEnd = audioCycles();
+    audioProfileWait(0, waitStart, waitEnd);
+    checkUnderrun(waitStart, waitEnd, n);
+    return bytesWritten > 0;
+  }
+
+  volatile uint32_t audioInputShortReads = 0; // times a block of input was not all there
+  size_t audioInputFramesOwed = 0; // frames still in the RX DMA from a short read, which belong to a past block
+
+  /** Return the number of input blocks that arrived short and were padded with silence since audioStart() */
+  uint32_t audioInputShortCount() {
+    return audioInputShortReads;
+  }
+
+  /** Read one block of input from the I2S RX DMA and split it into audioInputLeft and audioInputRight.
+  * RX and TX share the I2S clock, so a block has arrived each time a block has been written.
+  * After a short read the rest of that block is dropped on the next call, keeping input aligned with output.
+  * @n The number of samples in each channel, up to dmaBufferLength
+  */
+  void i2s_read_block(size_t n) {
+    size_t bytesIn = 0;
+    while (audioInputFramesOwed > 0) { // drain the late frames from the last short read
+      i2s_read(i2s_num, audioBlockIn, min(audioInputFramesOwed, (size_t)dmaBufferLength) * 4, &bytesIn, 0);
+      if (bytesIn == 0) break;
+      audioInputFramesOwed -= min(audioInputFramesOwed, bytesIn / 4);
+    }
+    bytesIn = 0;
+    i2s_read(i2s_num, audioBlockIn, n * 4, &bytesIn, 1); // rarely waits, never for longer than a tick
+    size_t framesIn = bytesIn / 4;
+    if (framesIn < n) {
+      audioInputShortReads = audioInputShortReads + 1;
+      audioInputFramesOwed += n - framesIn;
+    }
+    for (size_t i=0; i<framesIn; i++) {
+      audioInputLeft[i] = audioBlockIn[i] >> 16; // left in the high half, as i2s_write_block() packs it
+      audioInputRight[i] = audioBlockIn[i] & 0xffff;
+    }
+    for (size_t i=framesIn; i<n; i++) {
+      audioInputLeft[i] = audioInputRight[i] = 0; // silence if the input fell behind
+    }
+  }
+
+  /** Mix the oldest block rendered on core 1 into the left and right blocks, waiting for it if required */
+  void mixCore1Block(int16_t * left, int16_t * right, size_t n) {
+    while (core1BlocksRead == core1BlocksWritten) {
+      ulTaskNotifyTake(pdTRUE, 1); // woken by core 1 when a block is ready
+    }
+    int slot = core1BlocksRead % audioBlockQueueLength;
+    for (size_t i=0; i<n; i++) {
+      left[i] = max(-MAX_16, min(MAX_16, left[i] + core1BlockLeft[slot][i]));
+      right[i] = max(-MAX_16, min(MAX_16, right[i] + core1BlockRight[slot][i]));
+    }
+    __sync_synchronize(); // finish reading the slot before releasing it
+    core1BlocksRead = core1BlocksRead + 1;
+    xTaskNotifyGive(audioCallback2Handle);
+  }
+
+  /** Function for the RTOS task to fill the audio buffer a whole DMA buffer at a time */
+  void audioBlockCallback(void * paramRequiredButNotUsed) {
+    for(;;) {
+      if (audioInputEnabled) i2s_read_block(dmaBufferLength);
+      renderBlock(audioUpdateBlock, audioBlockLeft, audioBlockRight, dmaBufferLength);
+      if (audioUpdateBlockCore1) mixCore1Block(audioBlockLeft, audioBlockRight, dmaBufferLength);
+      i2s_write_block(audioBlockLeft, audioBlockRight, dmaBufferLength);
+    }
+  }
+
+  /** Function for the RTOS task on core 1 to render its part of each block into the queue */
+  void audioCore1Callback(void * paramRequiredButNotUsed) {
+    for(;;) {
+      uint32_t waitStart = audioCycles();
+      while (core1BlocksWritten - core1BlocksRead >= audioBlockQueueLength) {
+        ulTaskNotifyTake(pdTRUE, 1); // woken by core 0 when a slot is free
+      }
+      audioProfileWait(1, waitStart, audioCycles());
+      int slot = core1BlocksWritten % audioBlockQueueLength;
+      audioUpdateBlockCore1(core1BlockLeft[slot], core1BlockRight[slot], dmaBufferLength);
+      __sync_synchronize(); // finish writing the slot before publishing it
+      core1BlocksWritten = core1BlocksWritten + 1;
+      xTaskNotifyGive(audioCallback1Handle);
+    }
+  }
+
   bool i2s_write_samples(int16_t leftSample, int16_t rightSample) {
     leftAudioOuputValue = leftSample;
     rightAudioOuputValue = rightSample;
-    static size_t bytesWritten = 0;
+    size_t bytesWritten = 0; // per call, both per sample tasks write
     uint32_t value32Bit = (leftSample << 16) | (rightSample & 0xffff); // Combine both left and right channels
+    uint32_t waitStart = audioCycles();
     i2s_write(i2s_num, &value32Bit, 4, &bytesWritten, portMAX_DELAY); 
+    audioProfileWait(xPortGetCoreID(), waitStart, audioCycles());
+    if (bytesWritten > 0) __atomic_fetch_add(&audioSampleCount, 1, __ATOMIC_RELAXED); // count frames from both tasks
     yield();
     if (bytesWritten > 0) {
         return true;
     } else return false;
   }
 
-  TaskHandle_t audioCallback1Handle = NULL;
-  TaskHandle_t audioCallback2Handle = NULL;
-
   /** Start the audio callback
    *  This function is typically called in setup() in the main file
    */
   void audioStart() {
+    if (audioUpdateBlockCore1 && !audioUpdateBlock) { // core 1 only renders part of a block started by core 0
+      Serial.println("M16 not started: audioUpdateBlockCore1() also needs audioUpdateBlock()");
+      return;
+    }
+    if (!audioUpdate && !audioUpdateBlock) { // the audio tasks would call a function that isn't there
+      Serial.println("M16 not started: define audioUpdate() or audioUpdateBlock()");
+      return;
+    }
+    if (!fastMathReady) fastMathInit();
+    audioArenaInit();
+    audioProfileInit();
     i2s_driver_install(i2s_num, &i2s_config, 0, NULL);        // ESP32 will allocated resources to run I2S
     i2s_set_pin(i2s_num, &pin_config);                        // Tell it the pins you will be using
     i2s_start(i2s_num); // not explicity necessary, called by install
     // RTOS callback
-    xTaskCreatePinnedToCore(audioCallback, "FillAudioBuffer0", 2048, NULL, configMAX_PRIORITIES - 1, &audioCallback1Handle, 0); // 1024 = memory, 1 = priorty, 0 = core
-    xTaskCreatePinnedToCore(audioCallback, "FillAudioBuffer1", 2048, NULL, 2, &audioCallback2Handle, 1);
+    if (audioUpdateBlock) { // block mode, one task writes whole DMA buffers
+      xTaskCreatePinnedToCore(audioBlockCallback, "FillAudioBlock0", 4096, NULL, configMAX_PRIORITIES - 1, &audioCallback1Handle, 0);
+      if (audioUpdateBlockCore1) { // dual core mode, core 1 renders part of each block for core 0 to mix
+        xTaskCreatePinnedToCore(audioCore1Callback, "FillAudioBlock1", 4096, NULL, configMAX_PRIORITIES - 2, &audioCallback2Handle, 1);
+      }
+    } else {
+      xTaskCreatePinnedToCore(audioCallback, "FillAudioBuffer0", 2048, NULL, configMAX_PRIORITIES - 1, &audioCallback1Handle, 0); // 1024 = memory, 1 = priorty, 0 = core
+      xTaskCreatePinnedToCore(audioCallback, "FillAudioBuffer1", 2048, NULL, 2, &audioCallback2Handle, 1);
+    }
     Serial.println("M16 is running");
   }
 #endif
@@ -201,6 +703,14 @@ inline
 float mtof(float midival) {
   midival = max(0.0f, midival);
   float f = 0.0;
+  #ifdef M16_FAST_MATH
+    if (midival > 0 && midival < MTOF_TABLE_SIZE - 1) {
+      if (!fastMathReady) fastMathInit();
+      int index = (int)midival;
+      float frac = midival - index;
+      return mtofTable[index] + (mtofTable[index + 1] - mtofTable[index]) * frac;
+    }
+  #endif
   if (midival) f = 8.1757989156 * pow(2.0, midival * 0.083333); // / 12.0);
   return f;
 }
@@ -258,6 +768,10 @@ float intervalFreq(float freqVal, int interval) {
 float panLeft(float panVal) {
   if (panVal == 0) return 1;
   if (panVal == 1) return 0;
+  #ifdef M16_FAST_MATH
+    if (!fastMathReady) fastMathInit();
+    return curveLookup(panLeftTable, panVal);
+  #endif
   return max(0.0, min(1.0, cos(6.291 * panVal * 0.25)));
 }
 
@@ -265,6 +779,10 @@ float panLeft(float panVal) {
 float panRight(float panVal) {
   if (panVal == 0) return 0;
   if (panVal == 1) return 1;
+  #ifdef M16_FAST_MATH
+    if (!fastMathReady) fastMathInit();
+    return curveLookup(panRightTable, panVal);
+  #endif
   return max(0.0, min(1.0, cos(6.291 * (panVal * 0.25 + 0.75))));
 }
 
@@ -278,6 +796,10 @@ float floatMap(float x, float in_min, float in_max, float out_min, float out_max
 /** Return sigmond distributed value for value between 0.0-1.0 */
 inline
 float sigmoid(float inVal) { // 0.0 to 1.0
+  #ifdef M16_FAST_MATH
+    if (!fastMathReady) fastMathInit();
+    return curveLookup(sigmoidTable, inVal);
+  #endif
   if (inVal > 0.5) {
     return 0.5 + pow((inVal - 0.5)* 2, 4) * 0.5f;
   } else {
@@ -297,6 +819,17 @@ float slew(float curr, float target, float amt) {
   return curr + dist * amt;
 }
 
+/** Return the smallest power of two that is >= val
+* Used to size ring buffers that wrap with a mask
+* @val The minimum size required
+*/
+inline
+unsigned int nextPowerOf2(unsigned int val) {
+  unsigned int size = 1;
+  while (size < val) size <<= 1;
+  return size;
+}
+
 /** Constrain values to a 16bit range
 * @input The value to be clipped
 */
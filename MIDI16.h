@@ -2,6 +2,8 @@
  * by Andrew R. Brown 2023
  *
  * Light weight MIDI message send and recieve functionalty for M16
+ * Incoming bytes are parsed without blocking, with running status, into a queue
+ * of timestamped events that read() or getEvent() take from.
  * 
  * M16 is inspired by the 8-bit Mozzi audio library by Tim Barrass 2012
  *
@@ -13,6 +15,19 @@
 #ifndef MIDI16_H_
 #define MIDI16_H_
 
+#ifndef MIDI_QUEUE_SIZE
+  #define MIDI_QUEUE_SIZE 128 // decoded events waiting to be read, a power of 2
+#endif
+#ifndef MIDI_RX_BUFFER_SIZE
+  #define MIDI_RX_BUFFER_SIZE 1024 // ESP32 serial recieve buffer in bytes
+#endif
+
+#if IS_ESP32()
+  #define MIDI_SERIAL Serial2
+#else
+  #define MIDI_SERIAL Serial
+#endif
+
 class MIDI16 {
 
 public:
@@ -28,11 +43,19 @@ public:
   static const uint8_t cont = 0xFB;
   static const uint8_t stop = 0xFC;
 
+  /** A decoded MIDI message and the audio sample count when its last byte arrived */
+  struct MidiEvent {
+    uint32_t time;
+    uint8_t status; // including the channel
+    uint8_t data1;
+    uint8_t data2;
+  };
+
   /** Constructor */
-  MIDI16() {
+  MIDI16() : MIDI16(37, 38) {
     // Uses sProject PCB pins for ESP32-S3 hardware serial
     // ESP8266 ignores this and uses default Serial pins (GPIO 3 for rx and 1 for tx)
-    MIDI16(37, 38);  // 34, 35 sProject board v3
+    // 34, 35 sProject board v3
   }
 
   /** Constructor 
@@ -40,12 +63,12 @@ public:
    * @param tx The ESP32 pin to transmit MIDI data on
   */
   MIDI16(int rx, int tx):recievePin(rx), transmitPin(tx) {
-    delete[] message; // remove any previous memory allocation
-    message = new uint8_t[3]; // create a new MIDI message buffer
     #if IS_ESP32()
     // handle MIDI on a separate Serial bus to keep the main Serial availible for println debugging
     #include <HardwareSerial.h>
+    Serial2.setRxBufferSize(MIDI_RX_BUFFER_SIZE); // room for chord dumps between UART events
     Serial2.begin(31250, SERIAL_8N1, rx, tx);
+    Serial2.onReceive([this]() { poll(); }); // parse bytes in the UART event task as they arrive
     #endif
     #if IS_ESP8266()
     // use default Serial bus and pins (GPIO 3 for rx and 1 for tx), may mess with debug printing
@@ -89,19 +112,57 @@ public:
   }
 
   // recieve MIDI messages
+  /** Return the status of the next MIDI message and make it the current message, or 0 if there is none
+   * Channel messages return the status as ch 0, clock messages return their status byte.
+   */
   uint16_t read() {
-    while(Serial2.available() > 0) { // 2
-      int inByte = readByte();
-      // handle clock data
-      if (inByte >= 248 && inByte <= 252) { 
-        return inByte;
-      }
-      // handle channel message data
-      if ((inByte > 127 && inByte < 240)) { 
-        return handleChannelRead(inByte);
-      }
+    #if IS_ESP8266()
+    poll();
+    #endif
+    MidiEvent e;
+    if (!getEvent(e)) return 0;
+    message[0] = e.status;
+    message[1] = e.data1;
+    message[2] = e.data2;
+    messageTime = e.time;
+    if (e.status < 240) {
+      return e.status - (e.status & 0x0F); // return the status byte as ch 0
+    } else return e.status; // return non-channel status byte
+  }
+
+  /** Take the next event from the queue
+   * Call from the audio or control task, e.g. once per block, and use the event time
+   * with audioSampleCount to place it within the block.
+   * @e The event to fill
+   * @return true if there was an event
+   */
+  bool getEvent(MidiEvent &e) {
+    if (eventsRead == eventsWritten) return false;
+    e = events[eventsRead & (MIDI_QUEUE_SIZE - 1)];
+    __sync_synchronize(); // finish reading the slot before releasing it
+    eventsRead = eventsRead + 1;
+    return true;
+  }
+
+  /** Return the number of events waiting in the queue */
+  int available() {
+    return eventsWritten - eventsRead;
+  }
+
+  /** Return the number of events lost because the queue was full */
+  uint32_t getDropped() {
+    return droppedEvents;
+  }
+
+  /** Parse all recieved bytes into the event queue without waiting.
+   * On ESP32 this is called by the serial recieve event, so don't call it as well,
+   * that would add a second producer to the single producer event queue.
+   * On ESP8266 it is called by read(), or call it regularly from loop() when using getEvent().
+   */
+  void poll() {
+    while(MIDI_SERIAL.available() > 0) {
+      parse(readByte());
     }
-    return 0;
   }
 
   // access current MIDI message data
@@ -121,44 +182,77 @@ public:
     return message[2];
   }
 
+  /** Return the audio sample count when the current message arrived */
+  uint32_t getTime() {
+    return messageTime;
+  }
+
 private:
   int recievePin;
   int transmitPin;
-  uint8_t * message;
+  uint8_t message[3] = {0, 0, 0};
+  uint32_t messageTime = 0;
+  MidiEvent events[MIDI_QUEUE_SIZE];
+  volatile uint32_t eventsWritten = 0; // only changed by the parser
+  volatile uint32_t eventsRead = 0; // only changed by the reader
+  volatile uint32_t droppedEvents = 0;
+  uint8_t runningStatus = 0;
+  uint8_t dataBytes[2];
+  uint8_t dataCount = 0;
+  uint8_t dataNeeded = 0;
+  bool inSysEx = false;
 
   uint8_t readByte() {
-    return Serial2.read();
+    return MIDI_SERIAL.read();
   }
 
   void writeByte(uint8_t val) {
-    Serial2.write(val);
+    MIDI_SERIAL.write(val);
   }
 
-  uint8_t handleChannelRead(uint8_t inByte) { 
-    message[0] = inByte;
-    inByte = readByte();
-    while (inByte > 127) {
-      inByte = readByte();
-      if (inByte >= 248 && inByte <= 252) {
-        return inByte;
-      }
+  /** Add one incoming byte to the message being assembled, with running status */
+  void parse(uint8_t inByte) {
+    if (inByte >= 248) { // real time messages can arrive between any bytes
+      if (inByte <= 252) pushEvent(inByte, 0, 0);
+      return;
+    }
+    if (inByte >= 240) { // system common messages cancel running status
+      inSysEx = (inByte == 0xF0);
+      runningStatus = 0;
+      return;
     }
-    message[1] = inByte;
-    inByte = readByte();
-    while (inByte > 127) {
-      inByte = readByte();
-      if (inByte >= 248 && inByte <= 252) {
-        return inByte;
-      }
+    if (inByte > 127) { // channel status
+      inSysEx = false;
+      runningStatus = inByte;
+      uint8_t type = inByte & 0xF0;
+      dataNeeded = (type == programChange || type == channelAfterTouch) ? 1 : 2;
+      dataCount = 0;
+      return;
     }
-    message[2] = inByte;
+    if (inSysEx || runningStatus == 0) return; // data for a message we don't handle
+    dataBytes[dataCount++] = inByte;
+    if (dataCount < dataNeeded) return;
+    dataCount = 0;
+    uint8_t status = runningStatus;
+    uint8_t data2 = (dataNeeded == 2) ? dataBytes[1] : 0;
+    if ((status & 0xF0) == noteOn && data2 == 0) {
+      status = noteOff | (status & 0x0F); // Convert to note off
+    }
+    pushEvent(status, dataBytes[0], data2);
+  }
 
-    if (message[0] >= 0x90 && message[0] <= 0x9F && message[2] == 0) {
-      message[0] = 0x80 | (message[0] & 0x0F); // Convert to note off
+  void pushEvent(uint8_t status, uint8_t data1, uint8_t data2) {
+    if (eventsWritten - eventsRead >= MIDI_QUEUE_SIZE) {
+      droppedEvents = droppedEvents + 1;
+      return;
     }
-    if (message[0] < 240) {
-      return message[0] - (message[0] & 0x0F); // return the status byte as ch 0
-    } else return message[0]; // return non-channel status byte
+    MidiEvent &e = events[eventsWritten & (MIDI_QUEUE_SIZE - 1)];
+    e.time = audioSampleCount;
+    e.status = status;
+    e.data1 = data1;
+    e.data2 = data2;
+    __sync_synchronize(); // finish writing the slot before publishing it
+    eventsWritten = eventsWritten + 1;
   }
 
 };
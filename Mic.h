@@ -19,62 +19,111 @@ class Mic {
   public:
     /** Constructor
     * Start a new i2s input stream.
+    * In block mode M16 then reads one input block for each output block, and
+    * next(), nextLeft() and nextRight() return samples from that block rather than
+    * reading the I2S input themselves, so only one reader takes from the RX DMA.
     */
-    Mic() {}
+    Mic() {
+      #if IS_ESP32()
+        audioInputEnabled = true;
+      #endif
+    }
 
     /** 
     * Get the next left samples from the I2S audio input buffer
     */
     inline
     int16_t nextLeft() {
-      if (mBufIndex == 0) {
-        readMic();
-      }
-      int16_t val = inputBuf[mBufIndex * 2];
-      mBufIndex++;
-      if (mBufIndex >= samples_read/2) {
-        mBufIndex = 0;
-      }
-      return val;
+      return inputBuf[nextFrame(leftIndex, leftRead) * 2 + 1];
     }
 
     /** 
-    * Get the next left samples from the I2S audio input buffer
+    * Get the next right samples from the I2S audio input buffer
     */
     inline
     int16_t nextRight() {
-      if (mBufIndex == 0) {
-        readMic();
-      }
-      int16_t val = inputBuf[mBufIndex * 2 + 1];
-      mBufIndex++;
-      if (mBufIndex >= samples_read/2) {
-        mBufIndex = 0;
-      }
-      return val;
+      return inputBuf[nextFrame(rightIndex, rightRead) * 2];
     }
 
+    /** 
+    * Get the next left and right samples from the I2S audio input buffer
+    */
+    inline
+    void next(int16_t &left, int16_t &right) {
+      int frame = nextFrame(leftIndex, leftRead);
+      rightIndex = leftIndex;
+      rightRead = leftRead;
+      left = inputBuf[frame * 2 + 1];
+      right = inputBuf[frame * 2];
+    }
+
+    #if IS_ESP32()
+    /** Return the left input samples for the block being rendered in audioUpdateBlock()
+    * Read with the same indexes as the output block, input[i] arrived as left[i] is being played.
+    */
+    inline
+    const int16_t * getLeftBlock() {
+      return audioInputLeft + audioBlockPos;
+    }
+
+    /** Return the right input samples for the block being rendered in audioUpdateBlock()
+    * Read with the same indexes as the output block, input[i] arrived as right[i] is being played.
+    */
+    inline
+    const int16_t * getRightBlock() {
+      return audioInputRight + audioBlockPos;
+    }
+    #endif
 
   private:
     int samples_read = 0;
     int micGain = 32; // 0 - 64
     static const int16_t bufferLen = dmaBufferLength * 4;
-    uint16_t inputBuf[bufferLen];
-    int mBufIndex = 0;
+    uint16_t inputBuf[bufferLen]; // frames as read from the DMA, right then left in each 32 bit word, as output packs them
+    // each channel keeps its own frame index, so using both doesn't skip frames
+    int leftIndex = 0;
+    int rightIndex = 0;
+    uint32_t leftRead = 0; // the buffer read each channel is up to
+    uint32_t rightRead = 0;
+    uint32_t buffersRead = 0;
+
+    /** Return the frame for a channel to use and advance its index,
+    * reading a new buffer when the channel that is furthest ahead reaches the end
+    */
+    inline
+    int nextFrame(int &index, uint32_t &bufferRead) {
+      if (bufferRead != buffersRead || index >= samples_read/2) {
+        if (bufferRead == buffersRead) readMic();
+        bufferRead = buffersRead;
+        index = 0;
+      }
+      return index++;
+    }
 
     #if IS_ESP8266()
-      System.println("Mic class not yet implemented for ESP8266");
+      // Mic class not yet implemented for ESP8266
       void readMic() {
         // TBC
+        buffersRead++;
       }
     #elif IS_ESP32()
       inline
       void readMic() {
+        if (audioUpdateBlock) { // block mode, share the block M16 has read
+          for (int i=0; i<dmaBufferLength; i++) {
+            inputBuf[i * 2] = audioInputRight[i];
+            inputBuf[i * 2 + 1] = audioInputLeft[i];
+          }
+          samples_read = dmaBufferLength * 2;
+          buffersRead++;
+          return;
+        }
         size_t bytesIn = 0;
         esp_err_t result = i2s_read(I2S_NUM_0, inputBuf, bufferLen, &bytesIn, portMAX_DELAY);
         if (result == ESP_OK && bytesIn > 0) {
           samples_read = bytesIn / 2; // stereo 16 bit samples
         }
+        buffersRead++;
       }
     #endif
 };
@@ -0,0 +1,324 @@
+/*
+ * ModMatrix.h
+ *
+ * A modulation matrix class, routing LFOs, envelopes, sequences, controller values
+ * and functions to the settings of oscillators, filters, delays and effects.
+ *
+ * by Andrew R. Brown 2025
+ *
+ * Call update() from controlUpdate(), which M16 calls every M16_CONTROL_PERIOD samples,
+ * so all modulation runs at a fixed rate rather than from loop().
+ * Each destination is set to its base value plus the sum of depth * source for every route to it.
+ * Setters are only called when a destination value changes.
+ *
+ * This file is part of the M16 audio library. Relies on M16.h
+ *
+ * M16 is licensed under a Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International License.
+ */
+
+#ifndef MODMATRIX_H_
+#define MODMATRIX_H_
+
+#include "Osc.h"
+#include "Env.h"
+#include "Seq.h"
+#include "SVF.h"
+#include "Del.h"
+#include "FX.h"
+
+#ifndef MOD_MAX_SOURCES
+  #define MOD_MAX_SOURCES 8
+#endif
+#ifndef MOD_MAX_DESTINATIONS
+  #define MOD_MAX_DESTINATIONS 8
+#endif
+#ifndef MOD_MAX_ROUTES
+  #define MOD_MAX_ROUTES 16
+#endif
+
+// destination parameters
+#define MOD_FREQ 0 // Osc, SVF - in Hz
+#define MOD_PITCH 1 // Osc - MIDI pitch
+#define MOD_PULSE_WIDTH 2 // Osc - 0.0 to 1.0
+#define MOD_CUTOFF 3 // SVF - 0.0 to 1.0
+#define MOD_RES 4 // SVF - 0.0 to 1.0
+#define MOD_TIME 5 // Del - in ms
+#define MOD_LEVEL 6 // Del - 0.0 to 1.0
+#define MOD_CHORUS_DEPTH 7 // FX - 0.0 to 1.0
+#define MOD_REVERB_MIX 8 // FX - 0.0 to 1.0
+
+class ModMatrix {
+
+  public:
+    /** Constructor. */
+    ModMatrix() {}
+
+    /** Add an oscillator as an LFO source, from -1.0 to 1.0.
+    * The matrix calls next() on it once per update, so set its frequency with setLfoFreq().
+    * @return the source index, or -1 if there are no free sources
+    */
+    int addSource(Osc * lfo) {
+      return addSource(SRC_OSC, lfo);
+    }
+
+    /** Add an envelope as a source, from 0.0 to 1.0.
+    * The matrix advances it once per update, so don't also update it elsewhere.
+    * @return the source index, or -1 if there are no free sources
+    */
+    int addSource(Env * env) {
+      return addSource(SRC_ENV, env);
+    }
+
+    /** Add a sequence as a source, the value of its current step.
+    * @return the source index, or -1 if there are no free sources
+    */
+    int addSource(Seq * seq) {
+      return addSource(SRC_SEQ, seq);
+    }
+
+    /** Add a controller value as a source, such as a MIDI CC value updated from loop().
+    * @value The variable to read
+    * @range The value that maps to 1.0, e.g. 127 for MIDI CC
+    * @return the source index, or -1 if there are no free sources
+    */
+    int addSource(volatile int * value, float range = 127) {
+      int index = addSource(SRC_VALUE, (void *)value);
+      if (index >= 0) sourceScale[index] = 1.0f / range;
+      return index;
+    }
+
+    /** Add a function returning a float as a source.
+    * @return the source index, or -1 if there are no free sources
+    */
+    int addSource(float (*func)()) {
+      if (numSources >= MOD_MAX_SOURCES) return -1;
+      sourceFunc[numSources] = func;
+      return addSource(SRC_FUNC, nullptr);
+    }
+
+    /** Add an oscillator setting as a destination
+    * @osc The oscillator
+    * @param MOD_FREQ, MOD_PITCH or MOD_PULSE_WIDTH
+    * @base The value when there is no modulation
+    * @return the destination index, or -1 if there are no free destinations
+    */
+    int addDestination(Osc * osc, int param, float base) {
+      return addDestination(DST_OSC, osc, param, base);
+    }
+
+    /** Add a filter setting as a destination
+    * @filter The filter
+    * @param MOD_FREQ, MOD_CUTOFF or MOD_RES
+    * @base The value when there is no modulation
+    * @return the destination index, or -1 if there are no free destinations
+    */
+    int addDestination(SVF * filter, int param, float base) {
+      return addDestination(DST_SVF, filter, param, base);
+    }
+
+    /** Add a delay setting as a destination
+    * @delay The delay
+    * @param MOD_TIME or MOD_LEVEL
+    * @base The value when there is no modulation
+    * @return the destination index, or -1 if there are no free destinations
+    */
+    int addDestination(Del * delay, int param, float base) {
+      return addDestination(DST_DEL, delay, param, base);
+    }
+
+    /** Add an effect setting as a destination
+    * @fx The effects object
+    * @param MOD_CHORUS_DEPTH or MOD_REVERB_MIX
+    * @base The value when there is no modulation
+    * @return the destination index, or -1 if there are no free destinations
+    */
+    int addDestination(FX * fx, int param, float base) {
+      return addDestination(DST_FX, fx, param, base);
+    }
+
+    /** Add a function taking a float as a destination, for any other setting
+    * @func The function to call with the modulated value
+    * @base The value when there is no modulation
+    * @return the destination index, or -1 if there are no free destinations
+    */
+    int addDestination(void (*func)(float), float base) {
+      if (numDestinations >= MOD_MAX_DESTINATIONS) return -1;
+      destFunc[numDestinations] = func;
+      return addDestination(DST_FUNC, nullptr, 0, base);
+    }
+
+    /** Route a source to a destination
+    * @source The source index from addSource()
+    * @destination The destination index from addDestination()
+    * @depth The amount of the source added to the destination, in destination units
+    * @return the route index, or -1 if there are no free routes
+    */
+    int addRoute(int source, int destination, float depth) {
+      if (numRoutes >= MOD_MAX_ROUTES || source < 0 || source >= numSources ||
+          destination < 0 || destination >= numDestinations) return -1;
+      routeSource[numRoutes] = source;
+      routeDest[numRoutes] = destination;
+      routeDepth[numRoutes] = depth;
+      return numRoutes++;
+    }
+
+    /** Change the depth of a route
+    * @route The route index from addRoute()
+    * @depth The amount of the source added to the destination
+    */
+    void setDepth(int route, float depth) {
+      if (route >= 0 && route < numRoutes) routeDepth[route] = depth;
+    }
+
+    /** Change the unmodulated value of a destination
+    * @destination The destination index from addDestination()
+    * @base The value when there is no modulation
+    */
+    void setBase(int destination, float base) {
+      if (destination >= 0 && destination < numDestinations) destBase[destination] = base;
+    }
+
+    /** Return the most recent value of a source */
+    float getSourceValue(int source) {
+      return (source >= 0 && source < numSources) ? sourceValue[source] : 0;
+    }
+
+    /** Set the frequency of an LFO source, allowing for it being advanced once per update
+    * @lfo The oscillator
+    * @freq The LFO frequency in Hz
+    */
+    static void setLfoFreq(Osc * lfo, float freq) {
+      lfo->setFreq(freq * M16_CONTROL_PERIOD);
+    }
+
+    /** Advance the sources and apply the routes to the destinations
+    * Call once from controlUpdate()
+    */
+    void update() {
+      for (int i=0; i<numSources; i++) {
+        sourceValue[i] = readSource(i);
+      }
+      for (int d=0; d<numDestinations; d++) {
+        float val = destBase[d];
+        for (int r=0; r<numRoutes; r++) {
+          if (routeDest[r] == d) val += routeDepth[r] * sourceValue[routeSource[r]];
+        }
+        if (val != destValue[d]) {
+          destValue[d] = val;
+          applyDestination(d, val);
+        }
+      }
+    }
+
+  private:
+    enum { SRC_OSC, SRC_ENV, SRC_SEQ, SRC_VALUE, SRC_FUNC };
+    enum { DST_OSC, DST_SVF, DST_DEL, DST_FX, DST_FUNC };
+    int numSources = 0, numDestinations = 0, numRoutes = 0;
+    int sourceType[MOD_MAX_SOURCES];
+    void * sourcePtr[MOD_MAX_SOURCES];
+    float (*sourceFunc[MOD_MAX_SOURCES])();
+    float sourceScale[MOD_MAX_SOURCES];
+    float sourceValue[MOD_MAX_SOURCES];
+    int destType[MOD_MAX_DESTINATIONS];
+    void * destPtr[MOD_MAX_DESTINATIONS];
+    void (*destFunc[MOD_MAX_DESTINATIONS])(float);
+    int destParam[MOD_MAX_DESTINATIONS];
+    float destBase[MOD_MAX_DESTINATIONS];
+    float destValue[MOD_MAX_DESTINATIONS];
+    int routeSource[MOD_MAX_ROUTES];
+    int routeDest[MOD_MAX_ROUTES];
+    float routeDepth[MOD_MAX_ROUTES];
+
+    int addSource(int type, void * ptr) {
+      if (numSources >= MOD_MAX_SOURCES) return -1;
+      sourceType[numSources] = type;
+      sourcePtr[numSources] = ptr;
+      sourceScale[numSources] = 1.0f;
+      sourceValue[numSources] = 0;
+      return numSources++;
+    }
+
+    int addDestination(int type, void * ptr, int param, float base) {
+      if (numDestinations >= MOD_MAX_DESTINATIONS) return -1;
+      destType[numDestinations] = type;
+      destPtr[numDestinations] = ptr;
+      destParam[numDestinations] = param;
+      destBase[numDestinations] = base;
+      destValue[numDestinations] = base - 1; // so the first update applies it
+      return numDestinations++;
+    }
+
+    /** Advance a source by one update and return its value */
+    inline
+    float readSource(int i) {
+      switch (sourceType[i]) {
+        case SRC_OSC:
+          return ((Osc *)sourcePtr[i])->next() * (float)MAX_16_INV;
+        case SRC_ENV: {
+          Env * env = (Env *)sourcePtr[i];
+          uint16_t val = env->getSampleMode() ? env->advance(M16_CONTROL_PERIOD) : env->next();
+          return val * 0.0000152590219f; // / 65535
+        }
+        case SRC_SEQ:
+          return ((Seq *)sourcePtr[i])->again();
+        case SRC_VALUE:
+          return *(volatile int *)sourcePtr[i] * sourceScale[i];
+        case SRC_FUNC:
+          return sourceFunc[i]();
+      }
+      return 0;
+    }
+
+    /** Pass a destination value to its setter */
+    inline
+    void applyDestination(int d, float val) {
+      int param = destParam[d];
+      switch (destType[d]) {
+        case DST_OSC: {
+          Osc * osc = (Osc *)destPtr[d];
+          if (param == MOD_FREQ) {
+            osc->setFreq(max(0.0f, val));
+          } else if (param == MOD_PITCH) {
+            osc->setPitch(max(0.0f, val));
+          } else if (param == MOD_PULSE_WIDTH) {
+            osc->setPulseWidth(max(0.0f, min(1.0f, val)));
+          }
+          break;
+        }
+        case DST_SVF: {
+          SVF * filter = (SVF *)destPtr[d];
+          if (param == MOD_FREQ) {
+            filter->setFreq(max(0.0f, val));
+          } else if (param == MOD_CUTOFF) {
+            filter->setCutoff(val);
+          } else if (param == MOD_RES) {
+            filter->setRes(val);
+          }
+          break;
+        }
+        case DST_DEL: {
+          Del * delay = (Del *)destPtr[d];
+          if (param == MOD_TIME) {
+            delay->setTime(val);
+          } else if (param == MOD_LEVEL) {
+            delay->setLevel(max(0.0f, min(1.0f, val)));
+          }
+          break;
+        }
+        case DST_FX: {
+          FX * fx = (FX *)destPtr[d];
+          if (param == MOD_CHORUS_DEPTH) {
+            fx->setChorusDepth(max(0.0f, min(1.0f, val)));
+          } else if (param == MOD_REVERB_MIX) {
+            fx->setReverbMix(max(0.0f, min(1.0f, val)));
+          }
+          break;
+        }
+        case DST_FUNC:
+          destFunc[d](val);
+          break;
+      }
+    }
+};
+
+#endif /* MODMATRIX_H_ */
@@ -0,0 +1,140 @@
+/*
+ * Noise.h
+ *
+ * White, pink and brown noise, generated directly rather than read from a wavetable
+ *
+ * by Andrew R. Brown 2025
+ *
+ * Each Noise has its own xorshift32 generator, so instances on the two ESP32 audio
+ * tasks do not share the state of the global xorshift96() used by rand().
+ * White noise costs a few instructions per sample, pink noise uses the Voss-McCartney
+ * method of summing rows of white noise updated at halving rates, and brown noise is
+ * leaky integrated white noise. None of them repeat like a noise table does.
+ *
+ * This file is part of the M16 audio library. Relies on M16.h
+ *
+ * M16 is licensed under a Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International License.
+ */
+
+#ifndef NOISE_H_
+#define NOISE_H_
+
+#define NOISE_WHITE 0
+#define NOISE_PINK 1
+#define NOISE_BROWN 2
+#define NOISE_PINK_ROWS 12 // Voss-McCartney rows, the lowest row updates every 2^12 samples, about 10 Hz
+
+class Noise {
+
+  public:
+    /** Constructor.
+    * @seed The generator start value, or 0 to pick one from rand()
+    */
+    Noise(uint32_t seed = 0) {
+      setSeed(seed);
+    }
+
+    /** Restart the generator, to repeat a noise sequence
+    * @seed Any value, 0 picks one from the global xorshift96()
+    */
+    void setSeed(uint32_t seed) {
+      if (seed == 0) seed = xorshift96() | 1;
+      state = seed;
+      pinkCount = 0;
+      pinkSum = 0;
+      brown = 0;
+      for (int i=0; i<NOISE_PINK_ROWS; i++) {
+        pinkRows[i] = nextWhite() >> 3;
+        pinkSum += pinkRows[i];
+      }
+    }
+
+    /** Set the colour of noise returned by next()
+    * @type NOISE_WHITE, NOISE_PINK or NOISE_BROWN
+    */
+    void setType(int type) {
+      noiseType = max(NOISE_WHITE, min(NOISE_BROWN, type));
+    }
+
+    /** Return the colour of noise returned by next() */
+    int getType() {
+      return noiseType;
+    }
+
+    /** Return the next random 32 bit value */
+    inline
+    uint32_t nextRandom() {
+      uint32_t x = state;
+      x ^= x << 13;
+      x ^= x >> 17;
+      x ^= x << 5;
+      state = x;
+      return x;
+    }
+
+    /** Return the next white noise sample, evenly spread over the 16 bit range */
+    inline
+    int16_t nextWhite() {
+      return (int16_t)(nextRandom() >> 16);
+    }
+
+    /** Return the next pink noise sample, falling 3 dB per octave */
+    inline
+    int16_t nextPink() {
+      pinkCount++;
+      int row = pinkCount ? __builtin_ctz(pinkCount) : NOISE_PINK_ROWS; // row r updates every 2^(r+1) samples
+      if (row < NOISE_PINK_ROWS) {
+        int32_t val = nextWhite() >> 3;
+        pinkSum += val - pinkRows[row];
+        pinkRows[row] = val;
+      }
+      return clip16(pinkSum + (nextWhite() >> 3));
+    }
+
+    /** Return the next brown noise sample, falling 6 dB per octave */
+    inline
+    int16_t nextBrown() {
+      brown += (nextWhite() >> 6) - (brown >> 10); // the leak keeps it centred, below about 7 Hz
+      brown = clip16(brown);
+      return brown;
+    }
+
+    /** Return the next sample of the type set with setType() */
+    inline
+    int16_t next() {
+      if (noiseType == NOISE_PINK) return nextPink();
+      if (noiseType == NOISE_BROWN) return nextBrown();
+      return nextWhite();
+    }
+
+    /** Fill a buffer with noise of the type set with setType()
+    * @out The buffer to fill
+    * @n The number of samples to generate
+    */
+    void next(int16_t * out, size_t n) {
+      if (noiseType == NOISE_PINK) {
+        for (size_t i=0; i<n; i++) out[i] = nextPink();
+      } else if (noiseType == NOISE_BROWN) {
+        for (size_t i=0; i<n; i++) out[i] = nextBrown();
+      } else {
+        uint32_t x = state; // keep the state in a register for the loop
+        for (size_t i=0; i<n; i++) {
+          x ^= x << 13;
+          x ^= x >> 17;
+          x ^= x << 5;
+          out[i] = (int16_t)(x >> 16);
+        }
+        state = x;
+      }
+    }
+
+  private:
+    uint32_t state = 1;
+    int noiseType = NOISE_WHITE;
+    uint32_t pinkCount = 0;
+    int32_t pinkRows[NOISE_PINK_ROWS];
+    int32_t pinkSum = 0;
+    int32_t brown = 0;
+};
+
+#endif /* NOISE_H_ */
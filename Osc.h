@@ -15,20 +15,53 @@
 #ifndef OSC_H_
 #define OSC_H_
 
+// define as true before including Osc.h to make all Osc instances use an integer phase accumulator
+#ifndef OSC_FIXED_PHASE
+#define OSC_FIXED_PHASE false
+#endif
+
+// the most voices in unison mode, define before including Osc.h to change, e.g. 16
+#ifndef OSC_MAX_UNISON
+#define OSC_MAX_UNISON 8
+#endif
+
+// standard waves for Osc::getTable(), generated once and shared
+#define OSC_SIN 0
+#define OSC_COS 1
+#define OSC_TRI 2
+#define OSC_SAW 3
+#define OSC_SQR 4
+#define OSC_SAW_MIP 5 // band limited mipmaps of MIPMAP_SIZE, for setMipmap()
+#define OSC_SQR_MIP 6
+#define OSC_TRI_MIP 7
+#define OSC_NOISE 8 // noise tables are always TABLE_SIZE
+#define OSC_PINK_NOISE 9
+#define OSC_BROWN_NOISE 10
+#define OSC_SHARED_TABLES 16 // the most tables getTable() keeps track of
+
+// on ESP32 the standard tables are constants in flash, read in place rather than generated into RAM
+#if IS_ESP32() && !defined(M16_NO_FLASH_TABLES)
+  #include "WaveTables.h"
+#endif
+
 class Osc {
 
 public:
   /** Constructor.
 	* Has no table specified - make sure to use setTable() after initialising
 	*/
-  Osc() {}
+  Osc() {
+    initUnison();
+  }
 
 	/** Constructor.
 	* @param TABLE_NAME the name of the array the Osc will be using.
   * Table is a int16_t array of TABLE_SIZE - values rabge from -16383 to 16383 (which seems like 15, not 16 bits???)
   * Use sinGen() or similar function in M16.h to fill the table in the setup() function before using
 	*/
-	Osc(int16_t * TABLE_NAME):table(TABLE_NAME) {} // const 
+	Osc(int16_t * TABLE_NAME):table(TABLE_NAME) { // const
+    initUnison();
+  }
 
   /** Updates the phase according to the current frequency and returns the sample at the new phase position.
 	* @return outSamp The next sample.
@@ -45,6 +78,43 @@ public:
     return sampVal;
 	}
 
+  /** Fill a buffer with the next n samples.
+  * Mode checks are made once per block rather than once per sample.
+  * @out The buffer to fill
+  * @n The number of samples to generate
+  */
+  inline
+  void next(int16_t * out, size_t n) {
+    if (spread1 != 1 || pulseWidthOn || isNoise || isCrackle) {
+      for (size_t i=0; i<n; i++) {
+        out[i] = next();
+      }
+      return;
+    }
+    if (fixedPhase) {
+      nextFixed(out, n);
+      return;
+    }
+    // plain wavetable read, keep state in locals for the whole block
+    float phase = phase_fractional;
+    float phaseInc = phase_increment_fractional;
+    int32_t prevVal = prevSampVal;
+    int level = mipLevel;
+    for (size_t i=0; i<n; i++) {
+      int32_t sampVal = (table[(int)phase >> level] + prevVal)>>1; // smooth
+      prevVal = sampVal;
+      out[i] = sampVal;
+      phase += phaseInc;
+      if (phase > TABLE_SIZE) {
+        phase -= TABLE_SIZE;
+        phaseInc *= (1 + (rand(9) - 4) * 0.000001);
+      }
+    }
+    phase_fractional = phase;
+    phase_increment_fractional = phaseInc;
+    prevSampVal = prevVal;
+  }
+
   /** Returns the sample at for the oscillator phase at specified time in milliseconds.
   * Used for LFOs. Assumes the Osc started at time = 0;
 	* @return outSamp The sample value at the calculated phase position - range MIN_16 to MAX_16.
@@ -73,22 +143,75 @@ public:
   inline
 	void setTable(int16_t * TABLE_NAME) { // const
 		table = TABLE_NAME;
+    mipmap = NULL;
+    mipLevel = 0;
 	}
 
+  /** Change to a table shorter than TABLE_SIZE, such as a small table for an LFO
+  * Fill it with one of the table generators, passing the same size, e.g. Osc::sinGen(lfoTable, 256);
+  * @param TABLE_NAME is the name of the array
+  * @param size The number of samples in the table, a power of 2 no more than TABLE_SIZE
+  */
+  inline
+  void setTable(int16_t * TABLE_NAME, int size) {
+    setTable(TABLE_NAME);
+    while (mipLevel < TABLE_BITS && (TABLE_SIZE >> mipLevel) > size) mipLevel++; // read it as a mip level
+  }
+
+  /** Play from a set of band limited tables, one per octave, to avoid aliasing at high pitches.
+  * The level is chosen automatically whenever the frequency is set.
+  * @param MIPMAP_NAME is an array of MIPMAP_SIZE filled by sawMipGen(), sqrMipGen() or triMipGen()
+  */
+  inline
+  void setMipmap(int16_t * MIPMAP_NAME) {
+    mipmap = MIPMAP_NAME;
+    setFreq(frequency);
+  }
+
 	/** Set the phase of the Oscil. Phase ranges from 0.0 - 1.0 */
 	inline
   void setPhase(float phase) {
 		phase_fractional = phase;
     phase_fractional_s1 = phase;
     phase_fractional_s2 = phase;
+    phase_acc = (uint32_t)(max(0.0f, min((float)TABLE_SIZE - 0.01f, phase)) * PHASE_ACC_PER_INDEX);
 	}
 
 	/** Get the phase of the Oscil in fractional format. */
 	inline
   float getPhase() {
+    if (fixedPhase) return phase_acc * PHASE_INDEX_PER_ACC;
 		return phase_fractional;
 	}
 
+  /** Use an integer phase accumulator instead of a floating point phase.
+  * Cheaper on processors without an FPU, such as the ESP8266.
+  * The top TABLE_BITS of a 32 bit accumulator index the wavetable.
+  * Not used by feedback(), which always uses the floating point phase.
+  * @val Is true or false
+  */
+  inline
+  void setFixedPhase(bool val) {
+    if (val && !fixedPhase) phase_acc = (uint32_t)(max(0.0f, min((float)TABLE_SIZE - 0.01f, phase_fractional)) * PHASE_ACC_PER_INDEX);
+    if (!val && fixedPhase) phase_fractional = phase_acc * PHASE_INDEX_PER_ACC;
+    fixedPhase = val;
+  }
+
+  /** Return true if the integer phase accumulator is in use */
+  inline
+  bool getFixedPhase() {
+    return fixedPhase;
+  }
+
+  /** Interpolate between adjacent table values using the low bits of the fixed phase.
+  * Reduces quantisation noise for low frequencies and small tables. Has no effect unless setFixedPhase(true).
+  * @val Is true or false
+  */
+  inline
+  void setInterpolate(bool val) {
+    interpolate = val;
+  }
+
   /** Set the spread value of the Oscil.
   * @newVal A multiplyer of the base freq, from 0 to 1.0, values near zero are best for phasing effects
   */
@@ -127,7 +250,7 @@ public:
   int16_t nextMorph(int16_t * secondWaveTable, float morphAmount) {
     int intMorphAmount = max(0, min (1024, (int)(1024 * morphAmount)));
     int32_t sampVal = readTable();
-    int32_t sampVal2 = secondWaveTable[(int)phase_fractional];
+    int32_t sampVal2 = secondWaveTable[phaseIndex()];
     if (morphAmount > 0) sampVal = (((sampVal2 * intMorphAmount) >> 10) +
       ((sampVal * (1024 - intMorphAmount)) >> 10));
     sampVal = (sampVal + prevSampVal)>>1; // smooth
@@ -147,7 +270,7 @@ public:
   int16_t currentMorph(int16_t * secondWaveTable, float morphAmount) {
     int intMorphAmount = max(0, min(1024, (int)(1024 * morphAmount)));
     int32_t sampVal = readTable();
-    int32_t sampVal2 = secondWaveTable[(int)phase_fractional];
+    int32_t sampVal2 = secondWaveTable[phaseIndex()];
     if (morphAmount > 0) sampVal = (((sampVal2 * intMorphAmount) >> 10) +
       ((sampVal * (1024 - intMorphAmount)) >> 10));
     prevSampVal = sampVal;
@@ -157,6 +280,201 @@ public:
     return sampVal;
 	}
 
+  /** Play from a bank of wavetable frames, crossfading between adjacent frames with setScan().
+  * @bank frames * TABLE_SIZE values, frame f starting at bank[f * TABLE_SIZE], see bankAlloc().
+  * The bank is only read, so it can be a const array in flash or be in PSRAM.
+  * @frames The number of frames in the bank
+  */
+  inline
+  void setBank(const int16_t * bank, int frames) {
+    bankTable = bank;
+    bankFrames = max(1, frames);
+    setScan(scanPos);
+  }
+
+  /** Set the position in the wavetable bank
+  * @pos 0.0 is the first frame and 1.0 the last, in between crossfades adjacent frames.
+  */
+  inline
+  void setScan(float pos) {
+    scanPos = max(0.0f, min(1.0f, pos));
+    scanTarget = scanPos * (bankFrames - 1) * 65536.0f; // Q16 frame position
+  }
+
+  /** Return the position in the wavetable bank, 0.0 - 1.0 */
+  inline
+  float getScan() {
+    return scanPos;
+  }
+
+  /** Return the next sample from the wavetable bank at the scan position.
+  * Plays the table as next() does if no bank has been set.
+  */
+  inline
+  int16_t nextScan() {
+    if (bankTable == NULL) return next();
+    blockScan = scanTarget;
+    int32_t sampVal = (readBank(scanTarget) + prevSampVal)>>1; // smooth
+    prevSampVal = sampVal;
+    incrementPhase();
+    return sampVal;
+  }
+
+  /** Fill a buffer with samples from the wavetable bank.
+  * Changes of scan position since the last block are ramped across this one.
+  * @out The buffer to fill
+  * @n The number of samples to generate
+  */
+  inline
+  void nextScan(int16_t * out, size_t n) {
+    if (bankTable == NULL) {
+      next(out, n);
+      return;
+    }
+    int32_t scan = blockScan;
+    int32_t step = n > 0 ? ((int32_t)scanTarget - scan) / (int32_t)n : 0;
+    int32_t prevVal = prevSampVal;
+    for (size_t i=0; i<n; i++) {
+      scan += step;
+      int32_t sampVal = (readBank(i == n - 1 ? scanTarget : scan) + prevVal)>>1; // smooth
+      prevVal = sampVal;
+      out[i] = sampVal;
+      incrementPhase();
+    }
+    prevSampVal = prevVal;
+    blockScan = scanTarget;
+  }
+
+  /** Allocate a wavetable bank from the M16 audio arena, or PSRAM, for filling in setup()
+  * @frames The number of TABLE_SIZE frames
+  * @psram On ESP32 boards with PSRAM, true to place the bank there
+  */
+  static int16_t * bankAlloc(int frames, bool psram = false) {
+    return (int16_t *)audioAlloc(frames * TABLE_SIZE * sizeof(int16_t), psram);
+  }
+
+  /** Return the start of a frame in a wavetable bank, e.g. Osc::sawGen(Osc::bankFrame(bank, 2));
+  * @bank The wavetable bank
+  * @frame The frame, from 0
+  */
+  static int16_t * bankFrame(int16_t * bank, int frame) {
+    return bank + frame * TABLE_SIZE;
+  }
+
+  /** Play several detuned copies of the table at once, as for a supersaw.
+  * Voices run free with their own integer phases and are read with nextUnison().
+  * @voices The number of voices, 1 (off) to OSC_MAX_UNISON
+  * @detune The spread of pitches across the voices in semitones, e.g. 0.3
+  */
+  inline
+  void setUnison(int voices, float detune) {
+    int prevVoices = unisonVoices;
+    unisonVoices = max(1, min(OSC_MAX_UNISON, voices));
+    unisonDetune = max(0.0f, detune);
+    for (int v=prevVoices; v<unisonVoices; v++) {
+      unisonPhase[v] = (uint32_t)rand(TABLE_SIZE) << PHASE_SHIFT; // new voices start at random phases
+    }
+    // 1/N keeps the sum of N voices within full scale when their phases line up as they beat,
+    // with up to 3 dB of sqrt(N) makeup, as unaligned voices sum to about sqrt(N) times one
+    unisonGain = 32767 * min(sqrt((float)unisonVoices), 1.41421356f) / unisonVoices;
+    for (int v=0; v<unisonVoices; v++) {
+      float offset = (unisonVoices > 1) ? unisonDetune * ((float)v / (unisonVoices - 1) - 0.5f) : 0;
+      unisonRatio[v] = pow(2.0f, offset / 12.0f);
+    }
+    setUnisonSpread(unisonSpread);
+    if (mipmap != NULL) selectMipLevel(); // the sharpest voice may need a smoother level
+    updateUnison();
+  }
+
+  /** Set how widely the unison voices are spread across the stereo field
+  * @width 0.0 (mono) to 1.0 (voices spread from left to right)
+  */
+  inline
+  void setUnisonSpread(float width) {
+    unisonSpread = max(0.0f, min(1.0f, width));
+    for (int v=0; v<unisonVoices; v++) {
+      float pos = (unisonVoices > 1) ? (float)v / (unisonVoices - 1) - 0.5f : 0;
+      float pan = 0.5f + pos * unisonSpread;
+      unisonLeft[v] = panLeft(pan) * unisonGain;
+      unisonRight[v] = panRight(pan) * unisonGain;
+    }
+  }
+
+  /** Return the number of unison voices */
+  inline
+  int getUnison() {
+    return unisonVoices;
+  }
+
+  /** Return the sum of the unison voices */
+  inline
+  int16_t nextUnison() {
+    int16_t out;
+    nextUnison(&out, 1);
+    return out;
+  }
+
+  /** Set the next left and right sums of the unison voices, spread with setUnisonSpread() */
+  inline
+  void nextUnison(int16_t &left, int16_t &right) {
+    nextUnison(&left, &right, 1);
+  }
+
+  /** Fill a buffer with the sum of the unison voices
+  * @out The buffer to fill
+  * @n The number of samples to generate
+  */
+  inline
+  void nextUnison(int16_t * out, size_t n) {
+    int32_t acc[unisonChunk];
+    for (size_t done=0; done<n; done+=unisonChunk) {
+      size_t len = min((size_t)unisonChunk, n - done);
+      for (size_t i=0; i<len; i++) acc[i] = 0;
+      for (int v=0; v<unisonVoices; v++) {
+        accumulateUnison(v, acc, len);
+      }
+      for (size_t i=0; i<len; i++) {
+        out[done + i] = clip16(acc[i]);
+      }
+    }
+  }
+
+  /** Fill left and right buffers with the unison voices, spread with setUnisonSpread()
+  * @left The left buffer to fill
+  * @right The right buffer to fill
+  * @n The number of samples to generate
+  */
+  inline
+  void nextUnison(int16_t * left, int16_t * right, size_t n) {
+    int32_t accL[unisonChunk];
+    int32_t accR[unisonChunk];
+    int16_t voiceBuf[unisonChunk];
+    int shift = PHASE_SHIFT + mipLevel;
+    for (size_t done=0; done<n; done+=unisonChunk) {
+      size_t len = min((size_t)unisonChunk, n - done);
+      for (size_t i=0; i<len; i++) accL[i] = accR[i] = 0;
+      for (int v=0; v<unisonVoices; v++) {
+        uint32_t ph = unisonPhase[v];
+        uint32_t inc = unisonInc[v];
+        for (size_t i=0; i<len; i++) { // one voice at a time keeps the inner loop tight
+          voiceBuf[i] = table[ph >> shift];
+          ph += inc;
+        }
+        unisonPhase[v] = ph;
+        int32_t gl = unisonLeft[v];
+        int32_t gr = unisonRight[v];
+        for (size_t i=0; i<len; i++) {
+          accL[i] += (voiceBuf[i] * gl) >> 15;
+          accR[i] += (voiceBuf[i] * gr) >> 15;
+        }
+      }
+      for (size_t i=0; i<len; i++) {
+        left[done + i] = clip16(accL[i]);
+        right[done + i] = clip16(accR[i]);
+      }
+    }
+  }
+
   /** Get a window transform between this Osc and another wavetable.
   * Inspired by the Window Transform Function by Dove Audio
   * @param secondWaveTable - an wavetable array to transform with
@@ -173,37 +491,38 @@ public:
     int threeQuarterTable = quarterTable * 3;
     int portion14 = quarterTable * windowSize;
     int32_t sampVal = 0;
+    int phaseInd = phaseIndex();
     if (duel) {
-      if (phase_fractional < (quarterTable - portion14) || (phase_fractional > (quarterTable + portion14) &&
-          phase_fractional < (threeQuarterTable - portion14)) || phase_fractional > (threeQuarterTable + portion14)) {
+      if (phaseInd < (quarterTable - portion14) || (phaseInd > (quarterTable + portion14) &&
+          phaseInd < (threeQuarterTable - portion14)) || phaseInd > (threeQuarterTable + portion14)) {
         sampVal = readTable();
         if (spread1 != 1) {
           sampVal = doSpread(sampVal);
         }
       } else {
-        sampVal = secondWaveTable[(int)phase_fractional];
+        sampVal = secondWaveTable[phaseInd];
         if (invert) sampVal *= -1;
         if (spread1 != 1) {
-          int32_t spreadSamp1 = secondWaveTable[(int)phase_fractional];
+          int32_t spreadSamp1 = secondWaveTable[phaseInd];
           sampVal = (sampVal + spreadSamp1)>>1;
-          int32_t spreadSamp2 = secondWaveTable[(int)phase_fractional];
+          int32_t spreadSamp2 = secondWaveTable[phaseInd];
           sampVal = (sampVal + spreadSamp2)>>1;
           incrementSpreadPhase();
         }
       }
     } else {
-      if (phase_fractional < (halfTable - portion12) || phase_fractional > (halfTable + portion12)) {
+      if (phaseInd < (halfTable - portion12) || phaseInd > (halfTable + portion12)) {
         sampVal = readTable();
         if (spread1 != 1) {
           sampVal = doSpread(sampVal);
         }
       } else {
-        sampVal = secondWaveTable[(int)phase_fractional];
+        sampVal = secondWaveTable[phaseInd];
         if (invert) sampVal *= -1;
         if (spread1 != 1) {
-          int32_t spreadSamp1 = secondWaveTable[(int)phase_fractional];
+          int32_t spreadSamp1 = secondWaveTable[phaseInd];
           sampVal = (sampVal + spreadSamp1)>>1;
-          int32_t spreadSamp2 = secondWaveTable[(int)phase_fractional];
+          int32_t spreadSamp2 = secondWaveTable[phaseInd];
           sampVal = (sampVal + spreadSamp2)>>1;
           incrementSpreadPhase();
         }
@@ -225,7 +544,7 @@ public:
   inline
   int16_t phMod(int32_t modulator, float modIndex) {
     modulator *= modIndex;
-    int32_t sampVal = table[(int16_t)(phase_fractional + (modulator >> 4)) & (TABLE_SIZE - 1)];
+    int32_t sampVal = table[((int16_t)(phaseIndex() + (modulator >> 4)) & (TABLE_SIZE - 1)) >> mipLevel];
   	incrementPhase();
     if (spread1 != 1) {
       sampVal = doSpread(sampVal);
@@ -281,7 +600,7 @@ public:
    */
   inline
   int16_t feedback(int modIndex) {
-  	int16_t y = table[(int)feedback_phase_fractional] >> 3;
+  	int16_t y = table[(int)feedback_phase_fractional >> mipLevel] >> 3;
   	int16_t s = readTableIndex(y);
   	int f = ((int32_t)modIndex * (int32_t)s) >> 16;
 		phase_fractional += f + phase_increment_fractional;
@@ -294,7 +613,7 @@ public:
 		if (feedback_phase_fractional > TABLE_SIZE) {
 			feedback_phase_fractional -= TABLE_SIZE;
 		}
-    int16_t out = table[(int16_t)phase_fractional & (TABLE_SIZE - 1)];
+    int16_t out = table[((int16_t)phase_fractional & (TABLE_SIZE - 1)) >> mipLevel];
   	return out;
   }
 
@@ -322,9 +641,11 @@ public:
 		if (freq > 0) {
       frequency = freq;
 		  phase_increment_fractional = freq / 440.0f * (float)TABLE_SIZE / (SAMPLE_RATE / 440.0f);
+      phase_inc_acc = min(freq, SAMPLE_RATE * 0.5f) * PHASE_ACC_PER_HZ;
       if (pulseWidthOn) {
         phase_increment_fractional_w1 = phase_increment_fractional * 0.5 / pulseWidth;
         phase_increment_fractional_w2 = phase_increment_fractional * 0.5 / (1.0 - pulseWidth);
+        setPulseWidthAcc();
       }
       if (spread1 != 1) {
         phase_increment_fractional_s1 = phase_increment_fractional * spread1;
@@ -334,6 +655,8 @@ public:
         phase_increment_fractional_s2 = phase_increment_fractional;
       }
       cycleLengthPerMS = frequency * 0.001f; /// 1000.0f;
+      if (mipmap != NULL) selectMipLevel();
+      updateUnison(); // keep nextUnison() in tune, including with a single voice
     }
 	}
 
@@ -367,6 +690,8 @@ public:
 	inline
 	void setPhaseInc(float phaseinc_fractional) {
 		phase_increment_fractional = phaseinc_fractional;
+    phase_inc_acc = max(0.0f, min((float)HALF_TABLE_SIZE, phaseinc_fractional)) * PHASE_ACC_PER_INDEX;
+    updateUnison();
 	}
 
 	/** Set using noise waveform flag.
@@ -406,6 +731,7 @@ public:
     float halfPhaseInc = phase_increment_fractional * 0.5f;
     phase_increment_fractional_w1 = halfPhaseInc * pwInv;
     phase_increment_fractional_w2 = halfPhaseInc / (1.0f - pulseWidth);
+    setPulseWidthAcc();
   }
 
   /** Set using pulse width for the waveform
@@ -425,40 +751,46 @@ public:
 
   /** Generate a cosine wave
   * @theTable The the wavetable to be filled
+  * @size The number of samples, TABLE_SIZE unless the table is played with setTable(table, size)
   */
-  static void cosGen(int16_t * theTable) {
-    for(int i=0; i<TABLE_SIZE; i++) {
-      theTable[i] = (cos(2 * 3.1459 * i * TABLE_SIZE_INV) * MAX_16); //32767, 16383
+  static void cosGen(int16_t * theTable, int size = TABLE_SIZE) {
+    for(int i=0; i<size; i++) {
+      theTable[i] = (cos(2 * 3.1459 * i / size) * MAX_16); //32767, 16383
     }
   }
 
   /** Generate a sine wave
   * @theTable The the wavetable to be filled
+  * @size The number of samples, TABLE_SIZE unless the table is played with setTable(table, size)
   */
-  static void sinGen(int16_t * theTable) {
-    for(int i=0; i<TABLE_SIZE; i++) {
-      theTable[i] = (sin(2 * 3.1459 * i * TABLE_SIZE_INV) * MAX_16); //32767, 16383
+  static void sinGen(int16_t * theTable, int size = TABLE_SIZE) {
+    for(int i=0; i<size; i++) {
+      theTable[i] = (sin(2 * 3.1459 * i / size) * MAX_16); //32767, 16383
     }
   }
 
   /** Generate a triangle wave
   * @theTable The the wavetable to be filled
+  * @size The number of samples, TABLE_SIZE unless the table is played with setTable(table, size)
   */
-  static void triGen(int16_t * theTable) {
-    for (int i=0; i<TABLE_SIZE; i++) {
-      if (i < HALF_TABLE_SIZE) {
-        theTable[i] = MAX_16 - i * (MAX_16 * 2.0f * TABLE_SIZE_INV * 2.0f);
-      } else theTable[i] = MIN_16 + (i - (float)HALF_TABLE_SIZE) * (MAX_16 * 2.0f * TABLE_SIZE_INV * 2.0f);
+  static void triGen(int16_t * theTable, int size = TABLE_SIZE) {
+    int half = size / 2;
+    float step = MAX_16 * 4.0f / size;
+    for (int i=0; i<size; i++) {
+      if (i < half) {
+        theTable[i] = MAX_16 - i * step;
+      } else theTable[i] = MIN_16 + (i - (float)half) * step;
     }
   }
 
   /** Generate a square/pulse wave
   * @theTable The the wavetable to be filled
   * @duty The duty cycle, or pulse width, 0.0 - 1.0, 0.5 = sqr
+  * @size The number of samples, TABLE_SIZE unless the table is played with setTable(table, size)
   */
-  static void pulseGen(int16_t * theTable, float duty) {
-    for(int i=0; i<TABLE_SIZE; i++) {
-      if (i < TABLE_SIZE * duty) {
+  static void pulseGen(int16_t * theTable, float duty, int size = TABLE_SIZE) {
+    for(int i=0; i<size; i++) {
+      if (i < size * duty) {
         theTable[i] = MAX_16;
       } else theTable[i] = MIN_16;
     }
@@ -466,20 +798,107 @@ public:
 
   /** Generate a square wave
   * @theTable The the wavetable to be filled
+  * @size The number of samples, TABLE_SIZE unless the table is played with setTable(table, size)
   */
-  static void sqrGen(int16_t * theTable) {
-    pulseGen(theTable, 0.5);
+  static void sqrGen(int16_t * theTable, int size = TABLE_SIZE) {
+    pulseGen(theTable, 0.5, size);
   }
 
   /** Generate a sawtooth wave
   * @theTable The the wavetable to be filled
+  * @size The number of samples, TABLE_SIZE unless the table is played with setTable(table, size)
   */
-  static void sawGen(int16_t * theTable) {
-    for (int i=0; i<TABLE_SIZE; i++) {
-      theTable[i] = (MAX_16 - i * (MAX_16 * 2 * TABLE_SIZE_INV));
+  static void sawGen(int16_t * theTable, int size = TABLE_SIZE) {
+    for (int i=0; i<size; i++) {
+      theTable[i] = (MAX_16 - i * (MAX_16 * 2.0f / size));
     }
   }
 
+  /** Generate a set of band limited sawtooth waves, one per octave.
+  * Generation is slow, so do this once in setup() and share the result.
+  * @theMipmap The array of MIPMAP_SIZE to be filled, for use with setMipmap()
+  */
+  static void sawMipGen(int16_t * theMipmap) {
+    sawGen(theMipmap); // the full size level only plays below ~12 Hz, so needs no band limiting
+    mipGen(theMipmap, 1, 0);
+  }
+
+  /** Generate a set of band limited square waves, one per octave.
+  * Generation is slow, so do this once in setup() and share the result.
+  * @theMipmap The array of MIPMAP_SIZE to be filled, for use with setMipmap()
+  */
+  static void sqrMipGen(int16_t * theMipmap) {
+    sqrGen(theMipmap);
+    mipGen(theMipmap, 2, 0);
+  }
+
+  /** Generate a set of band limited triangle waves, one per octave.
+  * Generation is slow, so do this once in setup() and share the result.
+  * @theMipmap The array of MIPMAP_SIZE to be filled, for use with setMipmap()
+  */
+  static void triMipGen(int16_t * theMipmap) {
+    triGen(theMipmap);
+    mipGen(theMipmap, 2, 2);
+  }
+
+  /** Return a standard wave table shared by every Osc, FX or other user that asks for it
+  * On ESP32 the standard waves at the default table size are constants in flash (WaveTables.h),
+  * returned straight away. Others, and all tables on ESP8266, are generated by the first request,
+  * into the M16 audio arena once audioStart() has made it, and later requests return the same table.
+  * So sketches need not declare and fill their own copy.
+  * The registry has no locking and new tables are slow to generate, so call it from one task
+  * in setup(), never from the audio task.
+  * e.g. osc.setTable(Osc::getTable(OSC_SAW)); or lfo.setTable(Osc::getTable(OSC_SIN, 256), 256);
+  * @shape OSC_SIN, OSC_COS, OSC_TRI, OSC_SAW, OSC_SQR, OSC_SAW_MIP, OSC_SQR_MIP, OSC_TRI_MIP,
+  * OSC_NOISE, OSC_PINK_NOISE or OSC_BROWN_NOISE
+  * @size The number of samples, a power of 2 up to TABLE_SIZE. Ignored for mipmaps and noise.
+  * @return The table, or NULL for an unknown shape. Treat it as read only.
+  */
+  static int16_t * getTable(int shape, int size = TABLE_SIZE) {
+    if (shape < OSC_SIN || shape > OSC_BROWN_NOISE) return NULL;
+    if (shape >= OSC_SAW_MIP) size = (shape <= OSC_TRI_MIP) ? MIPMAP_SIZE : TABLE_SIZE;
+    else size = max(4, min((int)TABLE_SIZE, size));
+    #if IS_ESP32() && !defined(M16_NO_FLASH_TABLES)
+      const int16_t * flash = oscFlashTable(shape, size);
+      if (flash != NULL) return (int16_t *)flash; // read only, in flash
+    #endif
+    SharedTable * shared = sharedTables();
+    int & numShared = sharedTableCount();
+    for (int i=0; i<numShared; i++) {
+      if (shared[i].shape == shape && shared[i].size == size) return shared[i].table;
+    }
+    int16_t * theTable; // from the M16 audio arena, or the heap before there is one, so a size set later still applies
+    if (audioArenaReady) {
+      theTable = (int16_t *)audioAlloc(size * sizeof(int16_t));
+    } else theTable = (int16_t *)malloc(size * sizeof(int16_t));
+    if (theTable == NULL) return NULL;
+    switch (shape) {
+      case OSC_SIN: sinGen(theTable, size); break;
+      case OSC_COS: cosGen(theTable, size); break;
+      case OSC_TRI: triGen(theTable, size); break;
+      case OSC_SAW: sawGen(theTable, size); break;
+      case OSC_SQR: sqrGen(theTable, size); break;
+      case OSC_SAW_MIP: sawMipGen(theTable); break;
+      case OSC_SQR_MIP: sqrMipGen(theTable); break;
+      case OSC_TRI_MIP: triMipGen(theTable); break;
+      case OSC_NOISE: noiseGen(theTable); break;
+      case OSC_PINK_NOISE: pinkNoiseGen(theTable); break;
+      case OSC_BROWN_NOISE: brownNoiseGen(theTable); break;
+    }
+    if (numShared < OSC_SHARED_TABLES) { // when full the table still works, it just isn't shared
+      shared[numShared].shape = shape;
+      shared[numShared].size = size;
+      shared[numShared].table = theTable;
+      numShared++;
+    }
+    return theTable;
+  }
+
+  /** Return the start of a mipmap level, which is TABLE_SIZE >> level samples long */
+  static int16_t * mipLevelTable(int16_t * theMipmap, int level) {
+    return theMipmap + (MIPMAP_SIZE - (MIPMAP_SIZE >> level));
+  }
+
   /** Generate white noise
   * @theTable The the wavetable to be filled
   */
@@ -565,6 +984,24 @@ private:
   float phase_increment_fractional_w1 = phase_increment_fractional;
   float phase_increment_fractional_w2 = phase_increment_fractional;
 	int16_t * table; // const
+  int16_t * mipmap = NULL;
+  int mipLevel = 0; // table is TABLE_SIZE >> mipLevel samples long
+  static const int unisonChunk = 32; // samples accumulated at a time by nextUnison()
+  int unisonVoices = 1;
+  float unisonDetune = 0;
+  float unisonSpread = 0;
+  int32_t unisonGain = 32767; // Q15, min(sqrt(voices), sqrt(2)) / voices
+  uint32_t unisonPhase[OSC_MAX_UNISON] = {0};
+  uint32_t unisonInc[OSC_MAX_UNISON] = {0};
+  float unisonRatio[OSC_MAX_UNISON] = {1.0f};
+  int32_t unisonLeft[OSC_MAX_UNISON] = {0}; // Q15 pan gains including unisonGain
+  int32_t unisonRight[OSC_MAX_UNISON] = {0};
+  const int16_t * bankTable = NULL; // frames of TABLE_SIZE for nextScan()
+  int bankFrames = 1;
+  float scanPos = 0;
+  uint32_t scanTarget = 0; // Q16 frame position
+  uint32_t blockScan = 0; // scan position at the end of the last block
+  static const int MIPMAP_LEVELS = TABLE_BITS - 1; // smallest level is 4 samples
   int32_t prevSampVal = 0;
   bool isNoise = false;
   bool isCrackle = false;
@@ -579,10 +1016,24 @@ private:
   float testVal = 1.3;
   float cycleLengthPerMS = frequency * 0.001f; // / 1000.0f;
   float midiPitch = 69;
+  bool fixedPhase = OSC_FIXED_PHASE;
+  bool interpolate = false;
+  static const int PHASE_SHIFT = 32 - TABLE_BITS; // accumulator bits below the table index
+  static constexpr float PHASE_ACC_PER_INDEX = (float)(1UL << PHASE_SHIFT);
+  static constexpr float PHASE_INDEX_PER_ACC = 1.0f / (1UL << PHASE_SHIFT);
+  static constexpr float PHASE_ACC_PER_HZ = 4294967296.0f / SAMPLE_RATE;
+  uint32_t phase_acc = 0;
+  uint32_t phase_inc_acc = 18.75f * PHASE_ACC_PER_INDEX; // matches phase_increment_fractional
+  uint32_t phase_inc_acc_w1 = phase_inc_acc;
+  uint32_t phase_inc_acc_w2 = phase_inc_acc;
 
   /** Increments the phase of the oscillator without returning a sample.*/
 	inline
 	void incrementPhase() {
+    if (fixedPhase) {
+      incrementPhaseFixed();
+      return;
+    }
     if (pulseWidthOn) {
       if (phase_fractional < HALF_TABLE_SIZE) {
         phase_fractional += phase_increment_fractional_w1;
@@ -617,27 +1068,203 @@ private:
     if (phase_fractional_s2 > TABLE_SIZE) phase_fractional_s2 -= TABLE_SIZE;
   }
 
+  /** Increments the integer phase accumulator, wrapping by overflow.*/
+  inline
+  void incrementPhaseFixed() {
+    uint32_t prevAcc = phase_acc;
+    if (pulseWidthOn) {
+      phase_acc += (phase_acc < ((uint32_t)HALF_TABLE_SIZE << PHASE_SHIFT)) ? phase_inc_acc_w1 : phase_inc_acc_w2;
+    } else phase_acc += phase_inc_acc;
+    if (phase_acc < prevAcc) { // wrapped
+      if (isNoise) {
+        phase_acc = (uint32_t)rand(TABLE_SIZE) << PHASE_SHIFT;
+      } else if (isCrackle) {
+        if (rand(MAX_16) > crackleAmnt) {
+          phase_acc = 1UL << PHASE_SHIFT;
+        } else phase_acc = (uint32_t)rand(TABLE_SIZE) << PHASE_SHIFT;
+      } else if (!pulseWidthOn) {
+        // integer version of the pitch destabilising randomness
+        phase_inc_acc += (rand(9) - 4) * (int32_t)(phase_inc_acc >> 20);
+      }
+    }
+  }
+
+  /** Fill a buffer using the integer phase accumulator, see next(out, n) */
+  inline
+  void nextFixed(int16_t * out, size_t n) {
+    uint32_t acc = phase_acc;
+    uint32_t inc = phase_inc_acc;
+    int32_t prevVal = prevSampVal;
+    for (size_t i=0; i<n; i++) {
+      int32_t sampVal = (readFixed(acc) + prevVal)>>1; // smooth
+      prevVal = sampVal;
+      out[i] = sampVal;
+      uint32_t nextAcc = acc + inc;
+      if (nextAcc < acc) inc += (rand(9) - 4) * (int32_t)(inc >> 20);
+      acc = nextAcc;
+    }
+    phase_acc = acc;
+    phase_inc_acc = inc;
+    prevSampVal = prevVal;
+  }
+
+  /** Update the integer phase increments for each half of a pulse width cycle */
+  inline
+  void setPulseWidthAcc() {
+    phase_inc_acc_w1 = min(4.29e9f, phase_inc_acc * 0.5f / pulseWidth);
+    phase_inc_acc_w2 = min(4.29e9f, phase_inc_acc * 0.5f / (1.0f - pulseWidth));
+  }
+
+  /** Returns the table index for the current phase. */
+  inline
+  int phaseIndex() {
+    if (fixedPhase) return phase_acc >> PHASE_SHIFT;
+    return (int)phase_fractional;
+  }
+
+  /** Returns the sample for an integer phase, interpolated if required. */
+  inline
+  int16_t readFixed(uint32_t acc) {
+    int shift = PHASE_SHIFT + mipLevel;
+    uint32_t index = acc >> shift;
+    if (interpolate) {
+      int32_t a = table[index];
+      int32_t b = table[(index + 1) & ((TABLE_SIZE >> mipLevel) - 1)];
+      return a + (((b - a) * (int32_t)((acc >> (shift - 15)) & 0x7FFF)) >> 15);
+    }
+    return table[index];
+  }
+
 	/** Returns the current sample. */
 	inline
 	int16_t readTable() {
-    return table[(int)(phase_fractional)];
+    if (fixedPhase) return readFixed(phase_acc);
+    return table[(int)(phase_fractional) >> mipLevel];
 	}
 
 	/** Returns a particular sample. */
 	inline
 	int16_t readTableIndex(int ind) {
-		return table[ind];
+		return table[ind >> mipLevel];
 	}
 
+  /** Set up a single unison voice at the current frequency, panned centre */
+  void initUnison() {
+    setUnisonSpread(unisonSpread);
+    updateUnison();
+  }
+
+  /** Set the unison phase increments from the frequency and detune ratios */
+  inline
+  void updateUnison() {
+    for (int v=0; v<unisonVoices; v++) {
+      unisonInc[v] = min(4.29e9f, phase_inc_acc * unisonRatio[v]);
+    }
+  }
+
+  /** Add one unison voice for len samples to a mono accumulator, scaled by unisonGain */
+  inline
+  void accumulateUnison(int v, int32_t * acc, size_t len) {
+    int shift = PHASE_SHIFT + mipLevel;
+    uint32_t ph = unisonPhase[v];
+    uint32_t inc = unisonInc[v];
+    int32_t g = unisonGain;
+    for (size_t i=0; i<len; i++) {
+      acc[i] += (table[ph >> shift] * g) >> 15;
+      ph += inc;
+    }
+    unisonPhase[v] = ph;
+  }
+
+  /** Returns the current sample from the wavetable bank, crossfading two frames
+  * @scan The Q16 frame position
+  */
+  inline
+  int16_t readBank(uint32_t scan) {
+    int frame = scan >> 16;
+    int32_t frac = (scan & 0xFFFF) >> 1; // Q15
+    const int16_t * frameTable = bankTable + frame * TABLE_SIZE;
+    int index = phaseIndex() & (TABLE_SIZE - 1);
+    int32_t a = frameTable[index];
+    if (frac == 0 || frame >= bankFrames - 1) return a;
+    int32_t b = frameTable[index + TABLE_SIZE];
+    return a + (((b - a) * frac) >> 15);
+  }
+
   /** Returns a spread sample. */
 	inline
 	int16_t doSpread(int32_t sampVal) {
-    int32_t spreadSamp1 = table[(int)phase_fractional_s1];
-    int32_t spreadSamp2 = table[(int)phase_fractional_s2];
+    int32_t spreadSamp1 = table[(int)phase_fractional_s1 >> mipLevel];
+    int32_t spreadSamp2 = table[(int)phase_fractional_s2 >> mipLevel];
     sampVal = clip16((sampVal + ((spreadSamp1 * 600)>>10) + ((spreadSamp2 * 600)>>10))>>1);
     incrementSpreadPhase();
     return sampVal;
 	}
+
+  /** Choose the mipmap level whose highest harmonic stays below the Nyquist frequency.
+  * Level k has TABLE_SIZE >> (k + 1) harmonics, so needs a phase increment of no more than 2^k
+  */
+  inline
+  void selectMipLevel() {
+    float inc = max(max(phase_increment_fractional, phase_increment_fractional_s1), phase_increment_fractional_s2);
+    inc = max(inc, phase_increment_fractional * unisonRatio[unisonVoices - 1]); // the sharpest unison voice
+    int level = 0;
+    while (level < MIPMAP_LEVELS - 1 && (float)(1 << level) < inc) level++;
+    mipLevel = level;
+    table = mipLevelTable(mipmap, level);
+  }
+
+  struct SharedTable {
+    int shape;
+    int size;
+    int16_t * table;
+  };
+
+  /** The tables made by getTable(), kept in function statics so the header can be included anywhere */
+  static SharedTable * sharedTables() {
+    static SharedTable tables[OSC_SHARED_TABLES];
+    return tables;
+  }
+
+  static int & sharedTableCount() {
+    static int count = 0;
+    return count;
+  }
+
+  /** Fill mipmap levels 1 and up by additive synthesis.
+  * Harmonics are Lanczos windowed to avoid ringing at the edges of square waves.
+  * @step The harmonic step, 1 for all harmonics or 2 for odd harmonics only
+  * @power The power of the harmonic number the amplitude falls with, 0 for 1/h, 2 for 1/h^2 cosine phase
+  */
+  static void mipGen(int16_t * theMipmap, int step, int power) {
+    float * sinTable = new float[TABLE_SIZE];
+    float * levelBuf = new float[HALF_TABLE_SIZE];
+    for (int i=0; i<TABLE_SIZE; i++) {
+      sinTable[i] = sin(2 * PI * i * TABLE_SIZE_INV);
+    }
+    for (int level=1; level<MIPMAP_LEVELS; level++) {
+      int len = TABLE_SIZE >> level;
+      int harmonics = len >> 1;
+      for (int i=0; i<len; i++) levelBuf[i] = 0;
+      for (int h=1; h<harmonics; h+=step) {
+        float sigma = sin(PI * h / harmonics) / (PI * h / harmonics);
+        float amp = (power == 2) ? sigma / ((float)h * h) : sigma / h;
+        int phaseOffset = (power == 2) ? TABLE_SIZE >> 2 : 0; // cosine for triangle waves
+        for (int i=0; i<len; i++) {
+          levelBuf[i] += amp * sinTable[((h * i << level) + phaseOffset) & (TABLE_SIZE - 1)];
+        }
+      }
+      float peak = 0;
+      for (int i=0; i<len; i++) peak = max(peak, (float)fabs(levelBuf[i]));
+      float scale = (peak > 0) ? MAX_16 / peak : 0;
+      int16_t * levelTable = mipLevelTable(theMipmap, level);
+      for (int i=0; i<len; i++) {
+        levelTable[i] = max(MIN_16, min(MAX_16, (int)(levelBuf[i] * scale)));
+      }
+    }
+    delete[] sinTable;
+    delete[] levelBuf;
+  }
 };
 
 
@@ -0,0 +1,129 @@
+/*
+ * Param.h
+ *
+ * A smoothed parameter class that ramps linearly to a target value
+ *
+ * by Andrew R. Brown 2025
+ *
+ * Set the target from a control loop at any rate, then read the value once per
+ * audio block with nextBlock(), or per sample with next(), and pass it to a setter.
+ * Changes are spread over the ramp time, so there is no zipper noise and the cost
+ * of updating a filter or other coefficient is fixed at once per block.
+ *
+ * This file is part of the M16 audio library. Relies on M16.h
+ *
+ * M16 is licensed under a Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International License.
+ */
+
+#ifndef PARAM_H_
+#define PARAM_H_
+
+class Param {
+
+  public:
+    /** Constructor. */
+    Param() {}
+
+    /** Constructor.
+    * @param initial The starting value
+    */
+    Param(float initial) {
+      setValue(initial);
+    }
+
+    /** Set the ramp time in milliseconds
+    * The default is one audio block, dmaBufferLength samples
+    * @ms The time taken to reach a new target
+    */
+    void setRampTime(float ms) {
+      rampSamples = max(1, (int)(ms * SAMPLE_RATE * 0.001f));
+      rampSamplesInv = 1.0f / rampSamples;
+    }
+
+    /** Set a new value to ramp toward
+    * @target The value to reach after the ramp time
+    */
+    inline
+    void setTarget(float target) {
+      targetVal = target;
+      increment = (targetVal - currVal) * rampSamplesInv;
+      rampRemaining = rampSamples;
+    }
+
+    /** Return the value being ramped toward */
+    inline
+    float getTarget() {
+      return targetVal;
+    }
+
+    /** Set the value immediately, without a ramp
+    * @val The new value
+    */
+    inline
+    void setValue(float val) {
+      currVal = targetVal = val;
+      increment = 0;
+      rampRemaining = 0;
+    }
+
+    /** Return the current value */
+    inline
+    float getValue() {
+      return currVal;
+    }
+
+    /** Return true while the value is moving toward its target */
+    inline
+    bool isRamping() {
+      return rampRemaining > 0;
+    }
+
+    /** Advance the ramp by one sample and return the value */
+    inline
+    float next() {
+      if (rampRemaining > 0) {
+        if (--rampRemaining == 0) {
+          currVal = targetVal;
+        } else currVal += increment;
+      }
+      return currVal;
+    }
+
+    /** Advance the ramp by a block of samples and return the value at the end of the block
+    * @n The number of samples in the block
+    */
+    inline
+    float nextBlock(size_t n) {
+      if (rampRemaining > 0) {
+        if (rampRemaining <= (int)n) {
+          rampRemaining = 0;
+          currVal = targetVal;
+        } else {
+          rampRemaining -= n;
+          currVal += increment * n;
+        }
+      }
+      return currVal;
+    }
+
+    /** Fill a buffer with the ramped value for each sample of a block
+    * @out The buffer to fill
+    * @n The number of samples in the block
+    */
+    inline
+    void next(float * out, size_t n) {
+      for (size_t i=0; i<n; i++) {
+        out[i] = next();
+      }
+    }
+
+  private:
+    float currVal = 0;
+    float targetVal = 0;
+    float increment = 0;
+    int rampSamples = dmaBufferLength;
+    float rampSamplesInv = 1.0f / dmaBufferLength;
+    int rampRemaining = 0;
+};
+
+#endif /* PARAM_H_ */
@@ -0,0 +1,99 @@
+/*
+ * Profile.h
+ *
+ * Timers for measuring the CPU cost of parts of the audio render, such as Osc, SVF or FX calls
+ *
+ * by Andrew R. Brown 2025
+ *
+ * Wrap a stage with start() and stop(), or declare a ProfileScope at the top of a block.
+ * Results are gathered in the audio task and published once per M16 load window (about 100 ms),
+ * so loop() can read them at any time without disturbing the audio.
+ *
+ * This file is part of the M16 audio library. Relies on M16.h
+ *
+ * M16 is licensed under a Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International License.
+ */
+
+#ifndef PROFILE_H_
+#define PROFILE_H_
+
+class Profile {
+
+  public:
+    /** Constructor. */
+    Profile() {}
+
+    /** Begin timing a stage */
+    inline
+    void start() {
+      startCycles = audioCycles();
+    }
+
+    /** End timing a stage, publishing the results when a load window has passed */
+    inline
+    void stop() {
+      uint32_t cycles = audioCycles() - startCycles;
+      sumCycles += cycles;
+      calls++;
+      if (cycles > maxCycles) maxCycles = cycles;
+      if (window != audioProfileWindows) publish();
+    }
+
+    /** Return the share of the audio core used by this stage, as a percentage */
+    float getLoad() {
+      return load;
+    }
+
+    /** Return the average cycles per call */
+    uint32_t getCycles() {
+      return avgCycles;
+    }
+
+    /** Return the most cycles taken by one call in the last window */
+    uint32_t getMaxCycles() {
+      return peakCycles;
+    }
+
+    /** Return the average microseconds per call */
+    float getMicros() {
+      return (float)avgCycles / ESP.getCpuFreqMHz();
+    }
+
+  private:
+    uint32_t startCycles = 0;
+    uint32_t sumCycles = 0;
+    uint32_t calls = 0;
+    uint32_t maxCycles = 0;
+    uint32_t window = 0;
+    volatile float load = 0;
+    volatile uint32_t avgCycles = 0;
+    volatile uint32_t peakCycles = 0;
+
+    void publish() {
+      if (audioProfileWindowCycles > 0) load = sumCycles * 100.0f / audioProfileWindowCycles;
+      avgCycles = calls > 0 ? sumCycles / calls : 0;
+      peakCycles = maxCycles;
+      sumCycles = calls = maxCycles = 0;
+      window = audioProfileWindows;
+    }
+};
+
+/** Times the enclosing block with a Profile, from declaration to the end of the block
+* e.g. { ProfileScope t(filterTime); filter.nextLPF(in, out, n); }
+*/
+class ProfileScope {
+
+  public:
+    ProfileScope(Profile &p) : profile(p) {
+      profile.start();
+    }
+
+    ~ProfileScope() {
+      profile.stop();
+    }
+
+  private:
+    Profile &profile;
+};
+
+#endif /* PROFILE_H_ */
@@ -76,6 +76,25 @@ class SVF {
       return low; 
     }
 
+    /** Calculate a block of Lowpass filter samples, given a block of input signal.
+     *  Frequency changes since the last block are ramped across this one.
+     *  @input The input samples, an output from an oscillator or other audio element.
+     *  @output The buffer to fill with filtered samples
+     *  @n The number of samples to process
+     */
+    inline
+    void nextLPF(const int32_t * input, int16_t * output, size_t n) {
+      int32_t lo = low, ba = band, hi = high;
+      float ff = blockStart();
+      float fStep = blockStep(n);
+      for (size_t i=0; i<n; i++) {
+        ff += fStep;
+        calcFilterStep(clip16(input[i]), lo, ba, hi, ff);
+        output[i] = lo;
+      }
+      low = lo; band = ba; high = hi; notch = hi + lo;
+    }
+
     /** Calculate the next Lowpass filter sample, given an input signal.
      *  Input is an output from an oscillator or other audio element.
      */
@@ -104,6 +123,25 @@ class SVF {
       return max(-MAX_16, (int)min((int32_t)MAX_16, high));
     }
 
+    /** Calculate a block of Highpass filter samples, given a block of input signal.
+     *  Frequency changes since the last block are ramped across this one.
+     *  @input The input samples, an output from an oscillator or other audio element.
+     *  @output The buffer to fill with filtered samples
+     *  @n The number of samples to process
+     */
+    inline
+    void nextHPF(const int32_t * input, int16_t * output, size_t n) {
+      int32_t lo = low, ba = band, hi = high;
+      float ff = blockStart();
+      float fStep = blockStep(n);
+      for (size_t i=0; i<n; i++) {
+        ff += fStep;
+        calcFilterStep(clip16(input[i]), lo, ba, hi, ff);
+        output[i] = max(-MAX_16, (int)min((int32_t)MAX_16, hi));
+      }
+      low = lo; band = ba; high = hi; notch = hi + lo;
+    }
+
     /** Retrieve the current Highpass filter sample.
      *  Allows simultaneous use of LPF, HPF & BPF. 
      *  Use nextXXX() for one of them at each sample to compute the next filter values.
@@ -123,6 +161,25 @@ class SVF {
       return max(-MAX_16, (int)min((int32_t)MAX_16, band));
     }
 
+    /** Calculate a block of Bandpass filter samples, given a block of input signal.
+     *  Frequency changes since the last block are ramped across this one.
+     *  @input The input samples, an output from an oscillator or other audio element.
+     *  @output The buffer to fill with filtered samples
+     *  @n The number of samples to process
+     */
+    inline
+    void nextBPF(const int32_t * input, int16_t * output, size_t n) {
+      int32_t lo = low, ba = band, hi = high;
+      float ff = blockStart();
+      float fStep = blockStep(n);
+      for (size_t i=0; i<n; i++) {
+        ff += fStep;
+        calcFilterStep(clip16(input[i]), lo, ba, hi, ff);
+        output[i] = max(-MAX_16, (int)min((int32_t)MAX_16, ba));
+      }
+      low = lo; band = ba; high = hi; notch = hi + lo;
+    }
+
     /** Retrieve the current Bandpass filter sample.
      *  Allows simultaneous use of LPF, HPF & BPF. 
      *  Use nextXXX() for one of them at each sample to compute the next filter values.
@@ -177,12 +234,13 @@ class SVF {
     }
 
   private:
-    int32_t low, band, high, notch, allpassPrevIn, allpassPrevOut, simplePrev;
+    int32_t low = 0, band = 0, high = 0, notch = 0, allpassPrevIn = 0, allpassPrevOut = 0, simplePrev = 0;
     int32_t q = MAX_16;
     int32_t scale = sqrt(1) * MAX_16;
     volatile float f = 1.0;
+    float blockF = -1; // f at the end of the last block, -1 before the first block
     int32_t centFreq = 10000;
-    float resOffset;
+    float resOffset = 1.0f;
     int32_t maxFreq = SAMPLE_RATE * 0.2222;
 
     void calcFilter(int32_t input) {
@@ -194,6 +252,32 @@ class SVF {
       notch = high + low;
     }
 
+    /** Return f at the end of the last block, where the block ramp starts */
+    inline
+    float blockStart() {
+      if (blockF < 0) blockF = f; // no ramp into the first block
+      return blockF;
+    }
+
+    /** Return the per sample step that ramps f from its value at the end of the last block,
+    * then record the new value for the next block */
+    inline
+    float blockStep(size_t n) {
+      float target = f;
+      float step = (target == blockF || n == 0) ? 0 : (target - blockF) / n;
+      blockF = target;
+      return step;
+    }
+
+    /** Filter step on local copies of the state, used by the block functions */
+    inline
+    void calcFilterStep(int32_t input, int32_t &lo, int32_t &ba, int32_t &hi, float ff) {
+      input *= resOffset;
+      lo += ff * ba;
+      hi = ((scale * input) >> 15) - lo - ((q * ba) >> 16);
+      ba += ff * hi;
+    }
+
 };
 
 #endif /* SVF_H_ */
@@ -82,6 +82,17 @@ class SVF2 {
       return clip16(low); 
     }
 
+    /** Calculate a block of Lowpass filter samples, given a block of input signal.
+     *  Frequency changes since the last block are ramped across this one.
+     *  @input The input samples, an output from an oscillator or other audio element.
+     *  @output The buffer to fill with filtered samples
+     *  @n The number of samples to process
+     */
+    inline
+    void nextLPF(const int32_t * input, int16_t * output, size_t n) {
+      process(input, output, n, 0);
+    }
+
     /** Calculate the next Lowpass filter sample, given an input signal.
      *  Input is an output from an oscillator or other audio element.
      */
@@ -109,6 +120,17 @@ class SVF2 {
       return clip16(high);
     }
 
+    /** Calculate a block of Highpass filter samples, given a block of input signal.
+     *  Frequency changes since the last block are ramped across this one.
+     *  @input The input samples, an output from an oscillator or other audio element.
+     *  @output The buffer to fill with filtered samples
+     *  @n The number of samples to process
+     */
+    inline
+    void nextHPF(const int32_t * input, int16_t * output, size_t n) {
+      process(input, output, n, 1);
+    }
+
     /** Retrieve the current Highpass filter sample.
      *  Allows simultaneous use of LPF, HPF & BPF.
      *  Use nextXXX() for one of them at each sample to compute the next filter values.
@@ -128,6 +150,17 @@ class SVF2 {
       return clip16(band);
     }
 
+    /** Calculate a block of Bandpass filter samples, given a block of input signal.
+     *  Frequency changes since the last block are ramped across this one.
+     *  @input The input samples, an output from an oscillator or other audio element.
+     *  @output The buffer to fill with filtered samples
+     *  @n The number of samples to process
+     */
+    inline
+    void nextBPF(const int32_t * input, int16_t * output, size_t n) {
+      process(input, output, n, 2);
+    }
+
     /** Retrieve the current Bandpass filter sample.
      *  Allows simultaneous use of LPF, HPF & BPF.
      *  Use nextXXX() for one of them at each sample to compute the next filter values.
@@ -190,6 +223,43 @@ class SVF2 {
     float fb = 0.0;
     float buf0 = 0.0;
     float buf1 = 0.0;
+    float blockF = -1, blockFb = 0; // f and fb at the end of the last block, -1 before the first block
+
+    /** Filter a block on local copies of the state, ramping f and fb from the last block
+    * @mode 0 lowpass, 1 highpass, 2 bandpass
+    */
+    inline
+    void process(const int32_t * input, int16_t * output, size_t n, int mode) {
+      if (n == 0) return;
+      float b0 = buf0, b1 = buf1;
+      if (blockF < 0) { // no ramp into the first block
+        blockF = f;
+        blockFb = fb;
+      }
+      float ff = blockF, ffb = blockFb;
+      float fStep = 0, fbStep = 0;
+      if (f != blockF || fb != blockFb) {
+        float nInv = 1.0f / n;
+        fStep = (f - blockF) * nInv;
+        fbStep = (fb - blockFb) * nInv;
+      }
+      float in = 0;
+      for (size_t i=0; i<n; i++) {
+        ff += fStep;
+        ffb += fbStep;
+        in = max(-1.0f, min(1.0f, (float)(clip16(input[i]) * MAX_16_INV)));
+        b0 = b0 + ff * (in - b0 + ffb * (b0 - b1));
+        b1 = b1 + ff * (b0 - b1);
+        float out = (mode == 0) ? b1 : (mode == 1) ? in - b0 : b0 - b1;
+        output[i] = clip16(out * MAX_16);
+      }
+      buf0 = b0; buf1 = b1;
+      blockF = f; blockFb = fb;
+      low = b1 * MAX_16;
+      high = (in - b0) * MAX_16;
+      band = (b0 - b1) * MAX_16;
+      notch = (in - b0 + b1) * MAX_16;
+    }
 
     void calcFilter(int32_t input) {
       float in =  max(-1.0f, min(1.0f, (float)(input * MAX_16_INV)));
@@ -0,0 +1,175 @@
+/*
+ * SVFBank.h
+ *
+ * A bank of N State Variable Filters, such as one per voice, processed together
+ *
+ * by Andrew R. Brown 2025
+ *
+ * The same filter as SVF, with coefficients and state stored as arrays
+ * so that all N filters are stepped in one loop each sample.
+ *
+ * This file is part of the M16 audio library. Relies on M16.h
+ *
+ * M16 is licensed under a Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International License.
+ */
+
+#ifndef SVFBANK_H_
+#define SVFBANK_H_
+
+template <int N>
+class SVFBank {
+
+  public:
+    /** Constructor */
+    SVFBank() {
+      for (int v=0; v<N; v++) {
+        low[v] = band[v] = high[v] = 0;
+        f[v] = 1.0f;
+        setRes(v, 0.2);
+      }
+    }
+
+    /** Set how resonant one filter will be.
+    * @v The filter, from 0 to N-1
+    * @resonance 0.01 > res < 1.0
+    */
+    inline
+    void setRes(int v, float resonance) {
+      float res = max(0.01f, min(0.84f, resonance));
+      q[v] = (1.0 - res) * MAX_16;
+      scale[v] = sqrt(max(0.1f, res)) * MAX_16;
+      resOffset[v] = 1.2 - res * 1.6;
+    }
+
+    /** Set how resonant all filters will be.
+    * @resonance 0.01 > res < 1.0
+    */
+    inline
+    void setRes(float resonance) {
+      for (int v=0; v<N; v++) setRes(v, resonance);
+    }
+
+    /** Set the cutoff or centre frequency of one filter.
+    * @v The filter, from 0 to N-1
+    * @freq_val  40 - 10k Hz (SAMPLE_RATE/4).
+    */
+    inline
+    void setFreq(int v, int32_t freq_val) {
+      f[v] = 2 * sin(3.1459 * max(0, (int)min(maxFreq, freq_val)) * SAMPLE_RATE_INV);
+    }
+
+    /** Return the frequency coefficient of one filter. */
+    inline
+    float getFreq(int v) {
+      return f[v];
+    }
+
+    /** Set the cutoff or corner frequency of one filter.
+    * @v The filter, from 0 to N-1
+    * @cutoff_val 0.0 - 1.0 which equates to 40 - 10k Hz (SAMPLE_RATE/4).
+    */
+    inline
+    void setCutoff(int v, float cutoff_val) {
+      cutoff_val = max(0.0f, min(1.0f, cutoff_val));
+      float cutoff_freq = 0;
+      if (cutoff_val > 0.7) {
+        cutoff_freq = pow(cutoff_val, 3) * SAMPLE_RATE * 0.2222;
+      } else cutoff_freq = pow(cutoff_val * 1.43, 2) * 3500 + 40;
+      f[v] = 2 * sin(3.1459 * cutoff_freq * SAMPLE_RATE_INV);
+    }
+
+    /** Clear the state of one filter, e.g. when its voice starts a new note. */
+    inline
+    void reset(int v) {
+      low[v] = band[v] = high[v] = 0;
+    }
+
+    /** Calculate the next Lowpass sample of every filter.
+    * @input N input samples, one per filter
+    * @output N filtered samples
+    */
+    inline
+    void nextLPF(const int32_t * input, int16_t * output) {
+      process<0>(input, output, 1);
+    }
+
+    /** Calculate the next Highpass sample of every filter.
+    * @input N input samples, one per filter
+    * @output N filtered samples
+    */
+    inline
+    void nextHPF(const int32_t * input, int16_t * output) {
+      process<1>(input, output, 1);
+    }
+
+    /** Calculate the next Bandpass sample of every filter.
+    * @input N input samples, one per filter
+    * @output N filtered samples
+    */
+    inline
+    void nextBPF(const int32_t * input, int16_t * output) {
+      process<2>(input, output, 1);
+    }
+
+    /** Calculate a block of Lowpass samples for every filter.
+    * @input N blocks of n samples, filter v's block starting at input[v * n]
+    * @output N blocks of n filtered samples, in the same layout
+    * @n The number of samples per filter
+    */
+    inline
+    void nextLPF(const int32_t * input, int16_t * output, size_t n) {
+      process<0>(input, output, n);
+    }
+
+    /** Calculate a block of Highpass samples for every filter.
+    * @input N blocks of n samples, filter v's block starting at input[v * n]
+    * @output N blocks of n filtered samples, in the same layout
+    * @n The number of samples per filter
+    */
+    inline
+    void nextHPF(const int32_t * input, int16_t * output, size_t n) {
+      process<1>(input, output, n);
+    }
+
+    /** Calculate a block of Bandpass samples for every filter.
+    * @input N blocks of n samples, filter v's block starting at input[v * n]
+    * @output N blocks of n filtered samples, in the same layout
+    * @n The number of samples per filter
+    */
+    inline
+    void nextBPF(const int32_t * input, int16_t * output, size_t n) {
+      process<2>(input, output, n);
+    }
+
+    /** Return the number of filters in the bank */
+    int getSize() {
+      return N;
+    }
+
+  private:
+    int32_t low[N], band[N], high[N];
+    int32_t q[N], scale[N];
+    float f[N], resOffset[N];
+    int32_t maxFreq = SAMPLE_RATE * 0.2222;
+
+    /** Step every filter for n samples, the inner loop across filters
+    * MODE 0 is lowpass, 1 highpass and 2 bandpass
+    */
+    template <int MODE>
+    inline
+    void process(const int32_t * input, int16_t * output, size_t n) {
+      for (size_t i=0; i<n; i++) {
+        for (int v=0; v<N; v++) {
+          int32_t in = clip16(input[v * n + i]);
+          in *= resOffset[v];
+          low[v] += f[v] * band[v];
+          high[v] = ((scale[v] * in) >> 15) - low[v] - ((q[v] * band[v]) >> 16);
+          band[v] += f[v] * high[v];
+          int32_t out = (MODE == 0) ? low[v] : (MODE == 1) ? high[v] : band[v];
+          output[v * n + i] = (MODE == 0) ? out : max(-MAX_16, (int)min((int32_t)MAX_16, out));
+        }
+      }
+    }
+};
+
+#endif /* SVFBANK_H_ */
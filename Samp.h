@@ -24,7 +24,7 @@ public:
   */
   Samp(const int16_t * TABLE_NAME, unsigned long TABLE_SIZE):table(TABLE_NAME),table_size((unsigned long) TABLE_SIZE) {
     setLoopingOff();
-    endpos_fractional = table_size;
+    endpos_fractional = (uint64_t)table_size << 32;
     startpos_fractional = 0;
   }
 
@@ -42,7 +42,7 @@ public:
   inline
   void setStart(unsigned int startpos)
   {
-    startpos_fractional = (unsigned long) startpos;
+    startpos_fractional = (uint64_t)startpos << 32;
   }
 
   /** Resets the phase (the playhead) to the start position,
@@ -67,7 +67,7 @@ public:
   */
   inline
   void setEnd(unsigned int end) {
-    endpos_fractional = (unsigned long) end;
+    endpos_fractional = (uint64_t)min((unsigned long)end, table_size) << 32;
   }
 
   /** Turns looping on.*/
@@ -82,21 +82,40 @@ public:
     looping = false;
   }
 
+  /** Turn linear interpolation between samples on or off, on by default.
+  * @param state true to interpolate, false to read the nearest earlier sample
+  */
+  inline
+  void setInterpolate(bool state) {
+    interpolate = state;
+  }
+
   /** Returns the sample at the current phase position. */
   inline
   int16_t next() {
-    if (phase_fractional>endpos_fractional){
-      if (looping) {
-        phase_fractional = startpos_fractional + (phase_fractional - endpos_fractional);
+    if (phase_fractional >= endpos_fractional){
+      if (looping && endpos_fractional > startpos_fractional) {
+        phase_fractional = startpos_fractional + (phase_fractional - endpos_fractional) % (endpos_fractional - startpos_fractional);
       } else {
         return 0;
       }
     }
-    int16_t out = table[(int)phase_fractional];
+    int16_t out = readTable(phase_fractional);
     incrementPhase();
     return out;
   }
 
+  /** Fill a buffer with samples from the current phase position.
+  * @out The buffer to fill
+  * @n The number of samples
+  */
+  inline
+  void next(int16_t * out, size_t n) {
+    for (size_t i=0; i<n; i++) {
+      out[i] = next();
+    }
+  }
+
   /** Checks if the sample is playing by seeing if the phase is within the limits of its end position.*/
   inline
   boolean isPlaying() {
@@ -104,11 +123,20 @@ public:
   }
 
   /** Set the sample frequency.
-  * @param frequency to play the wave table.
+  * @param frequency to play the wave table, the number of times per second the whole table is played.
   */
   inline
   void setFreq(float frequency) {
-    phase_increment_fractional = (unsigned long)((float)table_size * frequency * SAMPLE_RATE_INV);
+    phase_increment_fractional = (uint64_t)((double)table_size * frequency / SAMPLE_RATE * 4294967296.0);
+  }
+
+  /** Set the playback speed relative to the recorded pitch.
+  * @param speed 1.0 plays at the original pitch, 2.0 an octave higher, 0.5 an octave lower.
+  * For a MIDI pitch relative to the sample's root pitch use pow(2, (pitch - root) / 12.0), or intervalFreq(1, pitch - root).
+  */
+  inline
+  void setSpeed(float speed) {
+    phase_increment_fractional = (uint64_t)(max(0.0f, speed) * 4294967296.0);
   }
 
   /**  Returns the sample at the given table index.
@@ -120,11 +148,12 @@ public:
   }
 
   /** Set a specific phase increment.
-  * @param phaseinc_fractional A phase increment value.
+  * @param phaseinc_fractional A phase increment value, in whole samples per step.
+  * Use setSpeed() for fractional increments.
    */
   inline
   void setPhaseInc(unsigned long phaseinc_fractional) {
-    phase_increment_fractional = phaseinc_fractional;
+    phase_increment_fractional = (uint64_t)phaseinc_fractional << 32;
   }
 
 private:
@@ -134,11 +163,23 @@ private:
     phase_fractional += phase_increment_fractional;
   }
 
-  volatile unsigned long phase_fractional;
-  volatile unsigned long phase_increment_fractional;
+  /** Read the table at a 32.32 fixed point position */
+  inline
+  int16_t readTable(uint64_t phase) {
+    uint32_t index = phase >> 32;
+    int32_t a = table[index];
+    if (!interpolate || index + 1 >= (endpos_fractional >> 32)) return a;
+    int32_t frac = (uint32_t)phase >> 17; // Q15 so the multiply can't overflow
+    return a + (((table[index + 1] - a) * frac)>>15);
+  }
+
+  uint64_t phase_fractional = 0; // 32.32 fixed point position in samples
+  uint64_t phase_increment_fractional = (uint64_t)1 << 32;
   const int16_t * table;
   bool looping;
-  unsigned long startpos_fractional, endpos_fractional, table_size;
+  bool interpolate = true;
+  unsigned long table_size;
+  uint64_t startpos_fractional, endpos_fractional;
 };
 
 #endif /* SAMP_H_ */
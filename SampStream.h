@@ -0,0 +1,342 @@
+/*
+ * SampStream.h
+ *
+ * A sample playback class that streams from a file or flash partition
+ *
+ * by Andrew R. Brown 2025
+ *
+ * Samples are read into a RAM ring buffer by a low priority task (ESP32),
+ * or by calling update() from loop() (ESP8266), so next() never waits on file I/O.
+ * Plays 16 bit mono PCM, either raw or in a WAV file, at the audio sample rate.
+ *
+ * This file is part of the M16 audio library. Relies on M16.h
+ *
+ * M16 is licensed under a Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International License.
+ */
+
+#ifndef SAMPSTREAM_H_
+#define SAMPSTREAM_H_
+
+#include "FS.h"
+#if IS_ESP32()
+  #include "esp_partition.h"
+  #include "esp_idf_version.h"
+  #if ESP_IDF_VERSION_MAJOR >= 5
+    typedef esp_partition_mmap_handle_t SampStreamMapHandle;
+  #else // Arduino-ESP32 v2
+    #include "esp_spi_flash.h"
+    typedef spi_flash_mmap_handle_t SampStreamMapHandle;
+  #endif
+#endif
+
+// ring buffer length in samples, a power of two
+#ifndef SAMPSTREAM_RING_SIZE
+  #define SAMPSTREAM_RING_SIZE 4096
+#endif
+
+class SampStream {
+
+public:
+  /** Constructor. */
+  SampStream() {}
+
+  /** Destructor. Stops the refill task and releases the ring and any mapped partition. */
+  ~SampStream() {
+    stopRefill();
+    releaseSource();
+    audioFree(ring);
+  }
+
+  /** Stream from an open file, such as from LittleFS.open() or SD.open().
+  * WAV files are read from their data chunk, other files are treated as raw 16 bit PCM.
+  * @param file The file to stream, which should stay open while playing
+  * @return true if the file can be played
+  */
+  bool begin(File file) {
+    stopRefill();
+    releaseSource();
+    sourceFile = file;
+    if (!sourceFile) return false;
+    dataStart = 0;
+    dataBytes = sourceFile.size();
+    if (!findWavData()) return false;
+    return beginStream();
+  }
+
+  #if IS_ESP32()
+    /** Stream from a data partition in flash, memory mapped with esp_partition_mmap().
+    * Upload raw 16 bit PCM to the partition, e.g. with esptool write_flash.
+    * @param label The partition name in the partition table
+    * @param offset The start of the sample data in the partition, in bytes
+    * @param bytes The length of the sample data, or 0 for the rest of the partition
+    * @return true if the partition could be mapped
+    */
+    bool beginPartition(const char * label, size_t offset = 0, size_t bytes = 0) {
+      const esp_partition_t * part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+      if (part == nullptr || offset >= part->size) return false;
+      if (bytes == 0 || offset + bytes > part->size) bytes = part->size - offset;
+      stopRefill();
+      releaseSource();
+      const void * mapped;
+      #if ESP_IDF_VERSION_MAJOR >= 5
+        if (esp_partition_mmap(part, offset, bytes, ESP_PARTITION_MMAP_DATA, &mapped, &mapHandle) != ESP_OK) return false;
+      #else
+        if (esp_partition_mmap(part, offset, bytes, SPI_FLASH_MMAP_DATA, &mapped, &mapHandle) != ESP_OK) return false;
+      #endif
+      mappedData = (const uint8_t *)mapped;
+      dataStart = 0;
+      dataBytes = bytes;
+      return beginStream();
+    }
+  #endif
+
+  /** Play the sample from the beginning.
+  * Playback starts once the refill task has read from the start of the source.
+  */
+  inline
+  void start() {
+    restartRequested = true; // the refill task clears sourceEnded when it restarts the source
+    playing = true;
+    notifyRefill();
+  }
+
+  /** Stop playback */
+  inline
+  void stop() {
+    playing = false;
+  }
+
+  /** Turns looping on.*/
+  inline
+  void setLoopingOn() {
+    looping = true;
+  }
+
+  /** Turns looping off.*/
+  inline
+  void setLoopingOff() {
+    looping = false;
+  }
+
+  /** Checks if the sample is playing. */
+  inline
+  bool isPlaying() {
+    return playing;
+  }
+
+  /** Returns the next sample from the ring buffer, or 0 if none are ready. */
+  inline
+  int16_t next() {
+    if (!playing || restartRequested) return 0;
+    if ((int32_t)(restartPos - ringRead) > 0) ringRead = restartPos; // skip samples read before a restart
+    if (ringWritten == ringRead) {
+      if (sourceEnded && (int32_t)(ringRead - endPos) >= 0) {
+        playing = false;
+      } else {
+        underruns++;
+        notifyRefill();
+      }
+      return 0;
+    }
+    int16_t out = ring[ringRead & RING_MASK];
+    ringRead++;
+    if ((ringRead & (CHUNK - 1)) == 0) notifyRefill();
+    return out;
+  }
+
+  /** Fill a buffer with the next samples.
+  * @out The buffer to fill
+  * @n The number of samples
+  */
+  inline
+  void next(int16_t * out, size_t n) {
+    for (size_t i=0; i<n; i++) {
+      out[i] = next();
+    }
+  }
+
+  /** Refill the ring buffer from the source.
+  * Called by the refill task on ESP32, call it often from loop() on ESP8266.
+  */
+  void update() {
+    if (ring == nullptr) return;
+    if (restartRequested) {
+      sourcePos = 0;
+      if (sourceFile) sourceFile.seek(dataStart);
+      restartPos = ringWritten;
+      sourceEnded = false; // only the refill task writes it, so a restart can't race an end
+      __sync_synchronize();
+      restartRequested = false;
+    }
+    while (!sourceEnded) {
+      uint32_t space = SAMPSTREAM_RING_SIZE - (ringWritten - ringRead);
+      if (space < CHUNK) break;
+      uint32_t index = ringWritten & RING_MASK;
+      size_t count = min((uint32_t)CHUNK, SAMPSTREAM_RING_SIZE - index);
+      size_t got = readSource(ring + index, count);
+      __sync_synchronize(); // samples are in the ring before the count is updated
+      ringWritten += got;
+      if (got < count) { // end of the source
+        if (looping && sourcePos > 0) {
+          sourcePos = 0;
+          if (sourceFile) sourceFile.seek(dataStart);
+        } else {
+          endPos = ringWritten;
+          sourceEnded = true;
+        }
+      }
+    }
+  }
+
+  /** Return the number of times next() has been called with no samples ready */
+  unsigned long getUnderruns() {
+    return underruns;
+  }
+
+  /** Return the length of the source in samples */
+  unsigned long getLength() {
+    return dataBytes / 2;
+  }
+
+private:
+  static const uint32_t RING_MASK = SAMPSTREAM_RING_SIZE - 1;
+  static const uint32_t CHUNK = SAMPSTREAM_RING_SIZE / 4; // samples read at a time
+  int16_t * ring = nullptr;
+  volatile uint32_t ringWritten = 0; // updated by the refill task
+  volatile uint32_t ringRead = 0; // updated by next()
+  volatile uint32_t restartPos = 0;
+  volatile uint32_t endPos = 0;
+  volatile bool restartRequested = false;
+  volatile bool sourceEnded = false;
+  volatile bool playing = false;
+  bool looping = false;
+  unsigned long underruns = 0;
+  File sourceFile;
+  const uint8_t * mappedData = nullptr;
+  size_t dataStart = 0;
+  size_t dataBytes = 0;
+  size_t sourcePos = 0;
+  #if IS_ESP32()
+    TaskHandle_t refillTaskHandle = nullptr;
+    volatile bool refillStopRequested = false;
+    volatile bool refillStopped = false;
+    SampStreamMapHandle mapHandle = 0;
+  #endif
+
+  /** Stop playback and end the refill task once it has finished reading, so the source can change safely */
+  void stopRefill() {
+    playing = false;
+    #if IS_ESP32()
+      if (refillTaskHandle == nullptr) return;
+      refillStopRequested = true;
+      while (!refillStopped) {
+        xTaskNotifyGive(refillTaskHandle);
+        vTaskDelay(1);
+      }
+      TaskHandle_t task = refillTaskHandle;
+      refillTaskHandle = nullptr; // next() stops notifying it before it goes
+      vTaskDelete(task);
+      refillStopRequested = refillStopped = false;
+    #endif
+  }
+
+  /** Let go of the last file and unmap the last partition */
+  void releaseSource() {
+    sourceFile = File();
+    #if IS_ESP32()
+      if (mappedData != nullptr) {
+        #if ESP_IDF_VERSION_MAJOR >= 5
+          esp_partition_munmap(mapHandle);
+        #else
+          spi_flash_munmap(mapHandle);
+        #endif
+      }
+    #endif
+    mappedData = nullptr;
+  }
+
+  /** Allocate the ring and start the refill task */
+  bool beginStream() {
+    if (ring == nullptr) ring = (int16_t *)audioAlloc(SAMPSTREAM_RING_SIZE * sizeof(int16_t));
+    if (ring == nullptr) return false;
+    ringWritten = ringRead = restartPos = endPos = 0;
+    sourcePos = 0;
+    restartRequested = true;
+    #if IS_ESP32()
+      if (refillTaskHandle == nullptr) {
+        xTaskCreate(refillTask, "SampStream", 4096, this, 1, &refillTaskHandle);
+      }
+    #endif
+    return true;
+  }
+
+  /** Refill the ring whenever next() asks, or every few ms */
+  static void refillTask(void * param) {
+    SampStream * stream = (SampStream *)param;
+    #if IS_ESP32()
+      while (!stream->refillStopRequested) {
+        stream->update();
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(5));
+      }
+      stream->refillStopped = true;
+      for (;;) vTaskDelay(portMAX_DELAY); // deleted by stopRefill()
+    #endif
+  }
+
+  /** Wake the refill task */
+  inline
+  void notifyRefill() {
+    #if IS_ESP32()
+      if (refillTaskHandle != nullptr) xTaskNotifyGive(refillTaskHandle);
+    #endif
+  }
+
+  /** Read samples from the file or partition at the current source position
+  * @return the number of samples read
+  */
+  size_t readSource(int16_t * dest, size_t samples) {
+    size_t bytes = min(samples * 2, dataBytes - sourcePos) & ~(size_t)1;
+    if (bytes == 0) return 0;
+    if (mappedData != nullptr) {
+      memcpy(dest, mappedData + dataStart + sourcePos, bytes);
+    } else {
+      bytes = sourceFile.read((uint8_t *)dest, bytes) & ~(size_t)1;
+    }
+    sourcePos += bytes;
+    return bytes / 2;
+  }
+
+  /** If the file is a WAV file, find its data chunk
+  * @return false for WAV files that are not 16 bit mono PCM
+  */
+  bool findWavData() {
+    uint8_t header[12];
+    sourceFile.seek(0);
+    if (sourceFile.read(header, 12) != 12 || memcmp(header, "RIFF", 4) != 0 || memcmp(header + 8, "WAVE", 4) != 0) {
+      sourceFile.seek(0);
+      return true; // raw PCM
+    }
+    uint8_t chunk[8];
+    size_t pos = 12;
+    while (sourceFile.read(chunk, 8) == 8) {
+      size_t chunkSize = chunk[4] | (chunk[5] << 8) | (chunk[6] << 16) | ((uint32_t)chunk[7] << 24);
+      pos += 8;
+      if (memcmp(chunk, "fmt ", 4) == 0) {
+        uint8_t fmt[16];
+        if (chunkSize < 16 || sourceFile.read(fmt, 16) != 16) return false;
+        int channels = fmt[2] | (fmt[3] << 8);
+        int bits = fmt[14] | (fmt[15] << 8);
+        if (channels != 1 || bits != 16) return false;
+      } else if (memcmp(chunk, "data", 4) == 0) {
+        dataStart = pos;
+        dataBytes = min(chunkSize, sourceFile.size() - pos);
+        return sourceFile.seek(dataStart);
+      }
+      pos += chunkSize + (chunkSize & 1); // chunks are word aligned
+      sourceFile.seek(pos);
+    }
+    return false;
+  }
+};
+
+#endif /* SAMPSTREAM_H_ */
@@ -0,0 +1,254 @@
+/*
+ * Voice.h
+ *
+ * A synthesiser voice and a polyphonic voice allocator.
+ * Voices whose envelope has finished are skipped when rendering.
+ *
+ * by Andrew R. Brown 2025
+ *
+ * This file is part of the M16 audio library. Relies on M16.h
+ *
+ * M16 is licensed under a Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International License.
+ */
+
+#ifndef VOICE_H_
+#define VOICE_H_
+
+#include "Osc.h"
+#include "Env.h"
+#include "SVF.h"
+
+#define VOICE_STEAL_OLDEST 0
+#define VOICE_STEAL_QUIETEST 1
+
+class Voice {
+
+  public:
+    Osc osc;
+    Env env;
+    SVF filter;
+
+    /** Constructor. Use osc.setTable() before playing. */
+    Voice() {}
+
+    /** Start a note
+    * @pitch The MIDI pitch, 0 - 127
+    * @velocity The MIDI velocity, 0 - 127
+    */
+    inline
+    void noteOn(int pitch, int velocity) {
+      notePitch = pitch;
+      released = false;
+      osc.setPitch(pitch);
+      env.setMaxLevel(max(0, min(127, velocity)) * 0.007874f);
+      env.start();
+    }
+
+    /** Move the note to its release phase */
+    inline
+    void noteOff() {
+      released = true;
+      env.startRelease();
+    }
+
+    /** Return true if the envelope has not finished */
+    inline
+    bool isActive() {
+      return env.getEnvState() > 0;
+    }
+
+    /** Return true if the note has been released or has finished */
+    inline
+    bool isReleased() {
+      return released || !isActive();
+    }
+
+    /** Return the pitch of the current or most recent note */
+    inline
+    int getPitch() {
+      return notePitch;
+    }
+
+    /** Compute the next sample for this voice.
+    * The envelope should be updated at control rate with env.next(), e.g. via VoicePool::update()
+    */
+    inline
+    int16_t next() {
+      return filter.nextLPF((osc.next() * env.getValue())>>16);
+    }
+
+    /** Render a block of this voice and add it to a mix buffer.
+    * The envelope is advanced once per block.
+    * @mix The buffer to add the voice to
+    * @n The number of samples, up to dmaBufferLength
+    */
+    inline
+    void addTo(int32_t * mix, size_t n) {
+      int16_t oscBuf[dmaBufferLength];
+      uint16_t envBuf[dmaBufferLength];
+      int32_t ampBuf[dmaBufferLength];
+      osc.next(oscBuf, n);
+      env.next(envBuf, n);
+      for (size_t i=0; i<n; i++) {
+        ampBuf[i] = (oscBuf[i] * envBuf[i])>>16;
+      }
+      filter.nextLPF(ampBuf, oscBuf, n);
+      for (size_t i=0; i<n; i++) {
+        mix[i] += oscBuf[i];
+      }
+    }
+
+  private:
+    int notePitch = -1;
+    bool released = true;
+    uint32_t noteOrder = 0; // when the voice was allocated, for stealing
+    friend class VoicePool;
+};
+
+class VoicePool {
+
+  public:
+    /** Constructor.
+    * @voices An array of voices to allocate notes to
+    * @numVoices The number of voices in the array
+    */
+    VoicePool(Voice * voices, int numVoices):voices(voices), numVoices(numVoices) {}
+
+    /** Set how a voice is chosen when all are busy
+    * @mode VOICE_STEAL_OLDEST or VOICE_STEAL_QUIETEST
+    */
+    inline
+    void setStealMode(int mode) {
+      stealMode = mode;
+    }
+
+    /** Allocate a voice and start a note on it
+    * A voice already sounding the pitch is retriggered, otherwise an idle voice is used,
+    * otherwise one is stolen. Released voices are stolen before held ones.
+    * @pitch The MIDI pitch, 0 - 127
+    * @velocity The MIDI velocity, 0 - 127
+    * @return The voice that was allocated
+    */
+    inline
+    Voice * noteOn(int pitch, int velocity) {
+      Voice * v = findPitch(pitch);
+      if (v == NULL) v = findIdle();
+      if (v == NULL) v = findSteal(true);
+      if (v == NULL) v = findSteal(false);
+      v->noteOrder = ++noteCount;
+      v->noteOn(pitch, velocity);
+      return v;
+    }
+
+    /** Release the voice playing a pitch
+    * @pitch The MIDI pitch, 0 - 127
+    */
+    inline
+    void noteOff(int pitch) {
+      Voice * v = findPitch(pitch);
+      if (v != NULL) v->noteOff();
+    }
+
+    /** Release all voices */
+    inline
+    void allNotesOff() {
+      for (int i=0; i<numVoices; i++) {
+        if (voices[i].isActive()) voices[i].noteOff();
+      }
+    }
+
+    /** Advance the envelopes of active voices.
+    * Call at control rate (e.g. every few ms from loop()) when using next() per sample.
+    */
+    inline
+    void update() {
+      for (int i=0; i<numVoices; i++) {
+        if (voices[i].isActive()) voices[i].env.next();
+      }
+    }
+
+    /** Compute the next mixed sample of all active voices */
+    inline
+    int32_t next() {
+      int32_t mix = 0;
+      for (int i=0; i<numVoices; i++) {
+        if (voices[i].isActive()) mix += voices[i].next();
+      }
+      return mix;
+    }
+
+    /** Render a block of all active voices into a mix buffer.
+    * @mix The buffer to fill
+    * @n The number of samples, up to dmaBufferLength
+    */
+    inline
+    void next(int32_t * mix, size_t n) {
+      for (size_t i=0; i<n; i++) {
+        mix[i] = 0;
+      }
+      for (int i=0; i<numVoices; i++) {
+        if (voices[i].isActive()) voices[i].addTo(mix, n);
+      }
+    }
+
+    /** Return the number of voices that are currently sounding */
+    inline
+    int getActiveCount() {
+      int count = 0;
+      for (int i=0; i<numVoices; i++) {
+        if (voices[i].isActive()) count++;
+      }
+      return count;
+    }
+
+    /** Return a voice by index */
+    inline
+    Voice & getVoice(int index) {
+      return voices[max(0, min(numVoices - 1, index))];
+    }
+
+    /** Return the number of voices in the pool */
+    inline
+    int getSize() {
+      return numVoices;
+    }
+
+  private:
+    Voice * voices;
+    int numVoices;
+    int stealMode = VOICE_STEAL_OLDEST;
+    uint32_t noteCount = 0;
+
+    Voice * findPitch(int pitch) {
+      for (int i=0; i<numVoices; i++) {
+        if (voices[i].isActive() && !voices[i].released && voices[i].notePitch == pitch) return &voices[i];
+      }
+      return NULL;
+    }
+
+    Voice * findIdle() {
+      for (int i=0; i<numVoices; i++) {
+        if (!voices[i].isActive()) return &voices[i];
+      }
+      return NULL;
+    }
+
+    /** Choose a voice to steal, from released voices only or from all voices */
+    Voice * findSteal(bool releasedOnly) {
+      Voice * choice = NULL;
+      for (int i=0; i<numVoices; i++) {
+        Voice * v = &voices[i];
+        if (releasedOnly && !v->isReleased()) continue;
+        if (choice == NULL) {
+          choice = v;
+        } else if (stealMode == VOICE_STEAL_QUIETEST) {
+          if (v->env.getValue() < choice->env.getValue()) choice = v;
+        } else if (v->noteOrder < choice->noteOrder) {
+          choice = v;
+        }
+      }
+      return choice;
+    }
+};
+
+#endif /* VOICE_H_ */
@@ -0,0 +1,2924 @@
+/*
+ * WaveTables.h
+ *
+ * Standard wave tables as constants, which ESP32 reads directly from flash
+ *
+ * by Andrew R. Brown 2025
+ *
+ * Generated by extras/host/tables.cpp (make tables) with the Osc generators, do not edit.
+ * Used by Osc::getTable() on ESP32 when M16_TABLE_BITS is 12, ESP8266 generates them into RAM.
+ *
+ * This file is part of the M16 audio library. Relies on M16.h
+ *
+ * M16 is licensed under a Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International License.
+ */
+
+#ifndef WAVETABLES_H_
+#define WAVETABLES_H_
+
+#if M16_TABLE_BITS == 12
+
+const int16_t oscFlashSin[4096] = {
+  0, 50, 100, 150, 201, 251, 301, 352, 402, 452, 503, 553, 603, 654, 704, 754,
+  805, 855, 905, 956, 1006, 1056, 1107, 1157, 1207, 1258, 1308, 1358, 1408, 1459, 1509, 1559,
+  1610, 1660, 1710, 1760, 1811, 1861, 1911, 1961, 2012, 2062, 2112, 2162, 2212, 2263, 2313, 2363,
+  2413, 2463, 2514, 2564, 2614, 2664, 2714, 2765, 2815, 2865, 2915, 2965, 3015, 3065, 3115, 3166,
+  3216, 3266, 3316, 3366, 3416, 3466, 3516, 3566, 3616, 3666, 3716, 3766, 3816, 3866, 3916, 3966,
+  4016, 4066, 4116, 4166, 4216, 4266, 4316, 4365, 4415, 4465, 4515, 4565, 4615, 4665, 4714, 4764,
+  4814, 4864, 4914, 4963, 5013, 5063, 5112, 5162, 5212, 5262, 5311, 5361, 5411, 5460, 5510, 5559,
+  5609, 5659, 5708, 5758, 5807, 5857, 5906, 5956, 6005, 6055, 6104, 6154, 6203, 6253, 6302, 6351,
+  6401, 6450, 6499, 6549, 6598, 6647, 6697, 6746, 6795, 6844, 6894, 6943, 6992, 7041, 7090, 7139,
+  7188, 7238, 7287, 7336, 7385, 7434, 7483, 7532, 7581, 7630, 7679, 7728, 7776, 7825, 7874, 7923,
+  7972, 8021, 8070, 8118, 8167, 8216, 8265, 8313, 8362, 8411, 8459, 8508, 8556, 8605, 8654, 8702,
+  8751, 8799, 8848, 8896, 8944, 8993, 9041, 9090, 9138, 9186, 9235, 9283, 9331, 9379, 9428, 9476,
+  9524, 9572, 9620, 9668, 9716, 9764, 9812, 9860, 9908, 9956, 10004, 10052, 10100, 10148, 10196, 10244,
+  10292, 10339, 10387, 10435, 10482, 10530, 10578, 10625, 10673, 10721, 10768, 10816, 10863, 10911, 10958, 11006,
+  11053, 11100, 11148, 11195, 11242, 11289, 11337, 11384, 11431, 11478, 11525, 11573, 11620, 11667, 11714, 11761,
+  11808, 11855, 11901, 11948, 11995, 12042, 12089, 12136, 12182, 12229, 12276, 12322, 12369, 12416, 12462, 12509,
+  12555, 12602, 12648, 12695, 12741, 12787, 12834, 12880, 12926, 12972, 13019, 13065, 13111, 13157, 13203, 13249,
+  13295, 13341, 13387, 13433, 13479, 13525, 13571, 13616, 13662, 13708, 13754, 13799, 13845, 13891, 13936, 13982,
+  14027, 14073, 14118, 14163, 14209, 14254, 14299, 14345, 14390, 14435, 14480, 14525, 14571, 14616, 14661, 14706,
+  14751, 14796, 14840, 14885, 14930, 14975, 15020, 15064, 15109, 15154, 15198, 15243, 15287, 15332, 15376, 15421,
+  15465, 15510, 15554, 15598, 15642, 15687, 15731, 15775, 15819, 15863, 15907, 15951, 15995, 16039, 16083, 16127,
+  16170, 16214, 16258, 16302, 16345, 16389, 16432, 16476, 16519, 16563, 16606, 16650, 16693, 16736, 16780, 16823,
+  16866, 16909, 16952, 16995, 17038, 17081, 17124, 17167, 17210, 17253, 17295, 17338, 17381, 17423, 17466, 17509,
+  17551, 17594, 17636, 17679, 17721, 17763, 17805, 17848, 17890, 17932, 17974, 18016, 18058, 18100, 18142, 18184,
+  18226, 18268, 18309, 18351, 18393, 18434, 18476, 18518, 18559, 18601, 18642, 18683, 18725, 18766, 18807, 18848,
+  18890, 18931, 18972, 19013, 19054, 19095, 19135, 19176, 19217, 19258, 19299, 19339, 19380, 19420, 19461, 19501,
+  19542, 19582, 19623, 19663, 19703, 19743, 19783, 19823, 19864, 19904, 19943, 19983, 20023, 20063, 20103, 20143,
+  20182, 20222, 20261, 20301, 20340, 20380, 20419, 20459, 20498, 20537, 20576, 20616, 20655, 20694, 20733, 20772,
+  20811, 20849, 20888, 20927, 20966, 21004, 21043, 21081, 21120, 21158, 21197, 21235, 21273, 21312, 21350, 21388,
+  21426, 21464, 21502, 21540, 21578, 21616, 21654, 21692, 21729, 21767, 21804, 21842, 21880, 21917, 21954, 21992,
+  22029, 22066, 22103, 22141, 22178, 22215, 22252, 22289, 22325, 22362, 22399, 22436, 22472, 22509, 22545, 22582,
+  22618, 22655, 22691, 22727, 22764, 22800, 22836, 22872, 22908, 22944, 22980, 23016, 23052, 23087, 23123, 23159,
+  23194, 23230, 23265, 23301, 23336, 23371, 23407, 23442, 23477, 23512, 23547, 23582, 23617, 23652, 23687, 23721,
+  23756, 23791, 23825, 23860, 23894, 23929, 23963, 23997, 24032, 24066, 24100, 24134, 24168, 24202, 24236, 24270,
+  24303, 24337, 24371, 24404, 24438, 24471, 24505, 24538, 24572, 24605, 24638, 24671, 24704, 24737, 24770, 24803,
+  24836, 24869, 24902, 24934, 24967, 25000, 25032, 25065, 25097, 25129, 25162, 25194, 25226, 25258, 25290, 25322,
+  25354, 25386, 25418, 25449, 25481, 25513, 25544, 25576, 25607, 25638, 25670, 25701, 25732, 25763, 25794, 25825,
+  25856, 25887, 25918, 25949, 25980, 26010, 26041, 26071, 26102, 26132, 26162, 26193, 26223, 26253, 26283, 26313,
+  26343, 26373, 26403, 26433, 26462, 26492, 26522, 26551, 26581, 26610, 26639, 26669, 26698, 26727, 26756, 26785,
+  26814, 26843, 26872, 26901, 26929, 26958, 26986, 27015, 27043, 27072, 27100, 27128, 27157, 27185, 27213, 27241,
+  27269, 27297, 27324, 27352, 27380, 27407, 27435, 27463, 27490, 27517, 27545, 27572, 27599, 27626, 27653, 27680,
+  27707, 27734, 27761, 27787, 27814, 27841, 27867, 27893, 27920, 27946, 27972, 27999, 28025, 28051, 28077, 28103,
+  28128, 28154, 28180, 28206, 28231, 28257, 28282, 28308, 28333, 28358, 28383, 28408, 28433, 28458, 28483, 28508,
+  28533, 28558, 28582, 28607, 28631, 28656, 28680, 28705, 28729, 28753, 28777, 28801, 28825, 28849, 28873, 28897,
+  28920, 28944, 28967, 28991, 29014, 29038, 29061, 29084, 29107, 29130, 29153, 29176, 29199, 29222, 29245, 29267,
+  29290, 29313, 29335, 29357, 29380, 29402, 29424, 29446, 29468, 29490, 29512, 29534, 29556, 29578, 29599, 29621,
+  29642, 29664, 29685, 29706, 29727, 29749, 29770, 29791, 29812, 29832, 29853, 29874, 29895, 29915, 29936, 29956,
+  29976, 29997, 30017, 30037, 30057, 30077, 30097, 30117, 30137, 30156, 30176, 30196, 30215, 30235, 30254, 30273,
+  30292, 30312, 30331, 30350, 30369, 30388, 30406, 30425, 30444, 30462, 30481, 30499, 30518, 30536, 30554, 30572,
+  30590, 30608, 30626, 30644, 30662, 30680, 30697, 30715, 30732, 30750, 30767, 30784, 30802, 30819, 30836, 30853,
+  30870, 30886, 30903, 30920, 30937, 30953, 30970, 30986, 31002, 31019, 31035, 31051, 31067, 31083, 31099, 31115,
+  31130, 31146, 31162, 31177, 31193, 31208, 31223, 31238, 31254, 31269, 31284, 31299, 31313, 31328, 31343, 31358,
+  31372, 31387, 31401, 31415, 31430, 31444, 31458, 31472, 31486, 31500, 31514, 31527, 31541, 31555, 31568, 31582,
+  31595, 31608, 31622, 31635, 31648, 31661, 31674, 31687, 31699, 31712, 31725, 31737, 31750, 31762, 31774, 31787,
+  31799, 31811, 31823, 31835, 31847, 31859, 31870, 31882, 31894, 31905, 31917, 31928, 31939, 31950, 31962, 31973,
+  31984, 31994, 32005, 32016, 32027, 32037, 32048, 32058, 32069, 32079, 32089, 32099, 32109, 32119, 32129, 32139,
+  32149, 32159, 32168, 32178, 32187, 32197, 32206, 32215, 32224, 32233, 32242, 32251, 32260, 32269, 32278, 32286,
+  32295, 32303, 32312, 32320, 32328, 32336, 32344, 32352, 32360, 32368, 32376, 32384, 32391, 32399, 32406, 32414,
+  32421, 32428, 32436, 32443, 32450, 32457, 32464, 32470, 32477, 32484, 32490, 32497, 32503, 32509, 32516, 32522,
+  32528, 32534, 32540, 32546, 32552, 32557, 32563, 32569, 32574, 32579, 32585, 32590, 32595, 32600, 32605, 32610,
+  32615, 32620, 32625, 32629, 32634, 32638, 32643, 32647, 32651, 32656, 32660, 32664, 32668, 32671, 32675, 32679,
+  32683, 32686, 32690, 32693, 32696, 32700, 32703, 32706, 32709, 32712, 32715, 32718, 32720, 32723, 32725, 32728,
+  32730, 32733, 32735, 32737, 32739, 32741, 32743, 32745, 32747, 32748, 32750, 32752, 32753, 32755, 32756, 32757,
+  32758, 32759, 32760, 32761, 32762, 32763, 32764, 32764, 32765, 32765, 32766, 32766, 32766, 32766, 32766, 32766,
+  32766, 32766, 32766, 32766, 32765, 32765, 32764, 32764, 32763, 32762, 32761, 32761, 32760, 32758, 32757, 32756,
+  32755, 32753, 32752, 32750, 32749, 32747, 32745, 32743, 32742, 32740, 32737, 32735, 32733, 32731, 32728, 32726,
+  32723, 32721, 32718, 32715, 32712, 32710, 32707, 32703, 32700, 32697, 32694, 32690, 32687, 32683, 32680, 32676,
+  32672, 32668, 32664, 32660, 32656, 32652, 32648, 32644, 32639, 32635, 32630, 32626, 32621, 32616, 32611, 32606,
+  32601, 32596, 32591, 32586, 32580, 32575, 32570, 32564, 32558, 32553, 32547, 32541, 32535, 32529, 32523, 32517,
+  32511, 32504, 32498, 32491, 32485, 32478, 32472, 32465, 32458, 32451, 32444, 32437, 32430, 32423, 32415, 32408,
+  32400, 32393, 32385, 32378, 32370, 32362, 32354, 32346, 32338, 32330, 32322, 32313, 32305, 32296, 32288, 32279,
+  32271, 32262, 32253, 32244, 32235, 32226, 32217, 32208, 32198, 32189, 32180, 32170, 32160, 32151, 32141, 32131,
+  32121, 32111, 32101, 32091, 32081, 32071, 32060, 32050, 32039, 32029, 32018, 32007, 31997, 31986, 31975, 31964,
+  31953, 31941, 31930, 31919, 31907, 31896, 31884, 31873, 31861, 31849, 31837, 31825, 31813, 31801, 31789, 31777,
+  31765, 31752, 31740, 31727, 31715, 31702, 31689, 31676, 31663, 31650, 31637, 31624, 31611, 31598, 31584, 31571,
+  31557, 31544, 31530, 31516, 31503, 31489, 31475, 31461, 31447, 31432, 31418, 31404, 31389, 31375, 31360, 31346,
+  31331, 31316, 31302, 31287, 31272, 31257, 31241, 31226, 31211, 31196, 31180, 31165, 31149, 31133, 31118, 31102,
+  31086, 31070, 31054, 31038, 31022, 31005, 30989, 30973, 30956, 30940, 30923, 30906, 30890, 30873, 30856, 30839,
+  30822, 30805, 30788, 30770, 30753, 30736, 30718, 30701, 30683, 30665, 30648, 30630, 30612, 30594, 30576, 30558,
+  30539, 30521, 30503, 30484, 30466, 30447, 30429, 30410, 30391, 30372, 30353, 30334, 30315, 30296, 30277, 30258,
+  30238, 30219, 30199, 30180, 30160, 30141, 30121, 30101, 30081, 30061, 30041, 30021, 30001, 29980, 29960, 29940,
+  29919, 29899, 29878, 29857, 29836, 29816, 29795, 29774, 29753, 29732, 29710, 29689, 29668, 29646, 29625, 29603,
+  29582, 29560, 29538, 29516, 29495, 29473, 29451, 29429, 29406, 29384, 29362, 29339, 29317, 29294, 29272, 29249,
+  29227, 29204, 29181, 29158, 29135, 29112, 29089, 29066, 29042, 29019, 28996, 28972, 28949, 28925, 28901, 28877,
+  28854, 28830, 28806, 28782, 28758, 28734, 28709, 28685, 28661, 28636, 28612, 28587, 28563, 28538, 28513, 28488,
+  28463, 28438, 28413, 28388, 28363, 28338, 28313, 28287, 28262, 28236, 28211, 28185, 28159, 28134, 28108, 28082,
+  28056, 28030, 28004, 27978, 27951, 27925, 27899, 27872, 27846, 27819, 27793, 27766, 27739, 27712, 27685, 27658,
+  27631, 27604, 27577, 27550, 27523, 27495, 27468, 27440, 27413, 27385, 27358, 27330, 27302, 27274, 27246, 27218,
+  27190, 27162, 27134, 27106, 27077, 27049, 27021, 26992, 26963, 26935, 26906, 26877, 26849, 26820, 26791, 26762,
+  26733, 26704, 26674, 26645, 26616, 26586, 26557, 26527, 26498, 26468, 26438, 26409, 26379, 26349, 26319, 26289,
+  26259, 26229, 26199, 26168, 26138, 26108, 26077, 26047, 26016, 25986, 25955, 25924, 25893, 25862, 25831, 25800,
+  25769, 25738, 25707, 25676, 25645, 25613, 25582, 25550, 25519, 25487, 25455, 25424, 25392, 25360, 25328, 25296,
+  25264, 25232, 25200, 25168, 25136, 25103, 25071, 25038, 25006, 24973, 24941, 24908, 24875, 24843, 24810, 24777,
+  24744, 24711, 24678, 24645, 24611, 24578, 24545, 24511, 24478, 24445, 24411, 24377, 24344, 24310, 24276, 24242,
+  24209, 24175, 24141, 24107, 24072, 24038, 24004, 23970, 23935, 23901, 23866, 23832, 23797, 23763, 23728, 23693,
+  23659, 23624, 23589, 23554, 23519, 23484, 23449, 23413, 23378, 23343, 23308, 23272, 23237, 23201, 23166, 23130,
+  23094, 23059, 23023, 22987, 22951, 22915, 22879, 22843, 22807, 22771, 22735, 22698, 22662, 22626, 22589, 22553,
+  22516, 22479, 22443, 22406, 22369, 22333, 22296, 22259, 22222, 22185, 22148, 22111, 22073, 22036, 21999, 21962,
+  21924, 21887, 21849, 21812, 21774, 21737, 21699, 21661, 21623, 21586, 21548, 21510, 21472, 21434, 21396, 21357,
+  21319, 21281, 21243, 21204, 21166, 21128, 21089, 21050, 21012, 20973, 20935, 20896, 20857, 20818, 20779, 20740,
+  20701, 20662, 20623, 20584, 20545, 20506, 20466, 20427, 20388, 20348, 20309, 20269, 20230, 20190, 20150, 20111,
+  20071, 20031, 19991, 19951, 19911, 19871, 19831, 19791, 19751, 19711, 19671, 19630, 19590, 19550, 19509, 19469,
+  19428, 19388, 19347, 19307, 19266, 19225, 19184, 19143, 19103, 19062, 19021, 18980, 18939, 18898, 18856, 18815,
+  18774, 18733, 18691, 18650, 18609, 18567, 18526, 18484, 18443, 18401, 18359, 18318, 18276, 18234, 18192, 18150,
+  18108, 18066, 18024, 17982, 17940, 17898, 17856, 17814, 17771, 17729, 17687, 17644, 17602, 17560, 17517, 17474,
+  17432, 17389, 17347, 17304, 17261, 17218, 17175, 17133, 17090, 17047, 17004, 16961, 16917, 16874, 16831, 16788,
+  16745, 16701, 16658, 16615, 16571, 16528, 16484, 16441, 16397, 16354, 16310, 16266, 16223, 16179, 16135, 16091,
+  16048, 16004, 15960, 15916, 15872, 15828, 15784, 15739, 15695, 15651, 15607, 15563, 15518, 15474, 15430, 15385,
+  15341, 15296, 15252, 15207, 15162, 15118, 15073, 15028, 14984, 14939, 14894, 14849, 14804, 14759, 14714, 14669,
+  14624, 14579, 14534, 14489, 14444, 14399, 14354, 14308, 14263, 14218, 14172, 14127, 14082, 14036, 13991, 13945,
+  13899, 13854, 13808, 13763, 13717, 13671, 13625, 13580, 13534, 13488, 13442, 13396, 13350, 13304, 13258, 13212,
+  13166, 13120, 13074, 13028, 12981, 12935, 12889, 12843, 12796, 12750, 12704, 12657, 12611, 12564, 12518, 12471,
+  12425, 12378, 12331, 12285, 12238, 12191, 12145, 12098, 12051, 12004, 11958, 11911, 11864, 11817, 11770, 11723,
+  11676, 11629, 11582, 11535, 11488, 11440, 11393, 11346, 11299, 11251, 11204, 11157, 11110, 11062, 11015, 10967,
+  10920, 10872, 10825, 10777, 10730, 10682, 10635, 10587, 10539, 10492, 10444, 10396, 10349, 10301, 10253, 10205,
+  10157, 10110, 10062, 10014, 9966, 9918, 9870, 9822, 9774, 9726, 9678, 9630, 9581, 9533, 9485, 9437,
+  9389, 9341, 9292, 9244, 9196, 9147, 9099, 9051, 9002, 8954, 8905, 8857, 8809, 8760, 8712, 8663,
+  8614, 8566, 8517, 8469, 8420, 8371, 8323, 8274, 8225, 8177, 8128, 8079, 8030, 7981, 7933, 7884,
+  7835, 7786, 7737, 7688, 7639, 7590, 7541, 7492, 7443, 7394, 7345, 7296, 7247, 7198, 7149, 7100,
+  7051, 7002, 6952, 6903, 6854, 6805, 6755, 6706, 6657, 6608, 6558, 6509, 6460, 6410, 6361, 6312,
+  6262, 6213, 6163, 6114, 6064, 6015, 5966, 5916, 5866, 5817, 5767, 5718, 5668, 5619, 5569, 5520,
+  5470, 5420, 5371, 5321, 5271, 5222, 5172, 5122, 5072, 5023, 4973, 4923, 4873, 4824, 4774, 4724,
+  4674, 4624, 4575, 4525, 4475, 4425, 4375, 4325, 4275, 4226, 4176, 4126, 4076, 4026, 3976, 3926,
+  3876, 3826, 3776, 3726, 3676, 3626, 3576, 3526, 3476, 3426, 3376, 3326, 3276, 3225, 3175, 3125,
+  3075, 3025, 2975, 2925, 2875, 2824, 2774, 2724, 2674, 2624, 2574, 2524, 2473, 2423, 2373, 2323,
+  2273, 2222, 2172, 2122, 2072, 2021, 1971, 1921, 1871, 1820, 1770, 1720, 1670, 1619, 1569, 1519,
+  1469, 1418, 1368, 1318, 1267, 1217, 1167, 1116, 1066, 1016, 966, 915, 865, 815, 764, 714,
+  664, 613, 563, 513, 462, 412, 362, 311, 261, 211, 160, 110, 60, 9, -40, -90,
+  -141, -191, -241, -292, -342, -392, -443, -493, -543, -594, -644, -694, -745, -795, -845, -896,
+  -946, -996, -1046, -1097, -1147, -1197, -1248, -1298, -1348, -1399, -1449, -1499, -1549, -1600, -1650, -1700,
+  -1750, -1801, -1851, -1901, -1951, -2002, -2052, -2102, -2152, -2203, -2253, -2303, -2353, -2403, -2454, -2504,
+  -2554, -2604, -2654, -2705, -2755, -2805, -2855, -2905, -2955, -3005, -3055, -3106, -3156, -3206, -3256, -3306,
+  -3356, -3406, -3456, -3506, -3556, -3606, -3656, -3706, -3756, -3806, -3856, -3906, -3956, -4006, -4056, -4106,
+  -4156, -4206, -4256, -4306, -4356, -4406, -4455, -4505, -4555, -4605, -4655, -4705, -4754, -4804, -4854, -4904,
+  -4954, -5003, -5053, -5103, -5152, -5202, -5252, -5302, -5351, -5401, -5450, -5500, -5550, -5599, -5649, -5698,
+  -5748, -5798, -5847, -5897, -5946, -5996, -6045, -6095, -6144, -6193, -6243, -6292, -6342, -6391, -6440, -6490,
+  -6539, -6588, -6638, -6687, -6736, -6785, -6835, -6884, -6933, -6982, -7031, -7081, -7130, -7179, -7228, -7277,
+  -7326, -7375, -7424, -7473, -7522, -7571, -7620, -7669, -7718, -7767, -7816, -7865, -7914, -7962, -8011, -8060,
+  -8109, -8158, -8206, -8255, -8304, -8352, -8401, -8450, -8498, -8547, -8595, -8644, -8693, -8741, -8790, -8838,
+  -8886, -8935, -8983, -9032, -9080, -9128, -9177, -9225, -9273, -9322, -9370, -9418, -9466, -9514, -9563, -9611,
+  -9659, -9707, -9755, -9803, -9851, -9899, -9947, -9995, -10043, -10091, -10139, -10187, -10234, -10282, -10330, -10378,
+  -10425, -10473, -10521, -10568, -10616, -10664, -10711, -10759, -10806, -10854, -10901, -10949, -10996, -11044, -11091, -11138,
+  -11186, -11233, -11280, -11327, -11375, -11422, -11469, -11516, -11563, -11610, -11657, -11704, -11751, -11798, -11845, -11892,
+  -11939, -11986, -12033, -12080, -12126, -12173, -12220, -12267, -12313, -12360, -12406, -12453, -12500, -12546, -12593, -12639,
+  -12685, -12732, -12778, -12825, -12871, -12917, -12963, -13010, -13056, -13102, -13148, -13194, -13240, -13286, -13332, -13378,
+  -13424, -13470, -13516, -13562, -13607, -13653, -13699, -13745, -13790, -13836, -13882, -13927, -13973, -14018, -14064, -14109,
+  -14155, -14200, -14245, -14291, -14336, -14381, -14426, -14471, -14517, -14562, -14607, -14652, -14697, -14742, -14787, -14832,
+  -14877, -14921, -14966, -15011, -15056, -15100, -15145, -15190, -15234, -15279, -15323, -15368, -15412, -15457, -15501, -15545,
+  -15589, -15634, -15678, -15722, -15766, -15810, -15854, -15898, -15942, -15986, -16030, -16074, -16118, -16162, -16206, -16249,
+  -16293, -16337, -16380, -16424, -16467, -16511, -16554, -16598, -16641, -16684, -16728, -16771, -16814, -16857, -16901, -16944,
+  -16987, -17030, -17073, -17116, -17159, -17201, -17244, -17287, -17330, -17372, -17415, -17458, -17500, -17543, -17585, -17628,
+  -17670, -17713, -17755, -17797, -17839, -17882, -17924, -17966, -18008, -18050, -18092, -18134, -18176, -18218, -18259, -18301,
+  -18343, -18385, -18426, -18468, -18509, -18551, -18592, -18634, -18675, -18717, -18758, -18799, -18840, -18881, -18923, -18964,
+  -19005, -19046, -19087, -19127, -19168, -19209, -19250, -19291, -19331, -19372, -19412, -19453, -19493, -19534, -19574, -19615,
+  -19655, -19695, -19735, -19776, -19816, -19856, -19896, -19936, -19976, -20015, -20055, -20095, -20135, -20174, -20214, -20254,
+  -20293, -20333, -20372, -20412, -20451, -20490, -20529, -20569, -20608, -20647, -20686, -20725, -20764, -20803, -20842, -20881,
+  -20919, -20958, -20997, -21035, -21074, -21112, -21151, -21189, -21228, -21266, -21304, -21342, -21381, -21419, -21457, -21495,
+  -21533, -21571, -21609, -21646, -21684, -21722, -21760, -21797, -21835, -21872, -21910, -21947, -21984, -22022, -22059, -22096,
+  -22133, -22170, -22207, -22244, -22281, -22318, -22355, -22392, -22428, -22465, -22502, -22538, -22575, -22611, -22648, -22684,
+  -22720, -22757, -22793, -22829, -22865, -22901, -22937, -22973, -23009, -23045, -23080, -23116, -23152, -23187, -23223, -23258,
+  -23294, -23329, -23364, -23400, -23435, -23470, -23505, -23540, -23575, -23610, -23645, -23680, -23714, -23749, -23784, -23818,
+  -23853, -23887, -23922, -23956, -23991, -24025, -24059, -24093, -24127, -24161, -24195, -24229, -24263, -24297, -24331, -24364,
+  -24398, -24431, -24465, -24498, -24532, -24565, -24598, -24632, -24665, -24698, -24731, -24764, -24797, -24830, -24863, -24895,
+  -24928, -24961, -24993, -25026, -25058, -25091, -25123, -25155, -25187, -25220, -25252, -25284, -25316, -25348, -25380, -25411,
+  -25443, -25475, -25506, -25538, -25569, -25601, -25632, -25664, -25695, -25726, -25757, -25788, -25819, -25850, -25881, -25912,
+  -25943, -25973, -26004, -26035, -26065, -26096, -26126, -26156, -26187, -26217, -26247, -26277, -26307, -26337, -26367, -26397,
+  -26427, -26457, -26486, -26516, -26545, -26575, -26604, -26634, -26663, -26692, -26721, -26750, -26779, -26808, -26837, -26866,
+  -26895, -26924, -26952, -26981, -27009, -27038, -27066, -27095, -27123, -27151, -27179, -27207, -27235, -27263, -27291, -27319,
+  -27347, -27374, -27402, -27430, -27457, -27485, -27512, -27539, -27566, -27594, -27621, -27648, -27675, -27702, -27729, -27755,
+  -27782, -27809, -27835, -27862, -27888, -27915, -27941, -27967, -27993, -28020, -28046, -28072, -28098, -28123, -28149, -28175,
+  -28201, -28226, -28252, -28277, -28303, -28328, -28353, -28378, -28403, -28429, -28454, -28478, -28503, -28528, -28553, -28578,
+  -28602, -28627, -28651, -28675, -28700, -28724, -28748, -28772, -28796, -28820, -28844, -28868, -28892, -28916, -28939, -28963,
+  -28986, -29010, -29033, -29056, -29080, -29103, -29126, -29149, -29172, -29195, -29218, -29240, -29263, -29286, -29308, -29331,
+  -29353, -29375, -29398, -29420, -29442, -29464, -29486, -29508, -29530, -29552, -29573, -29595, -29616, -29638, -29659, -29681,
+  -29702, -29723, -29744, -29765, -29786, -29807, -29828, -29849, -29870, -29890, -29911, -29932, -29952, -29972, -29993, -30013,
+  -30033, -30053, -30073, -30093, -30113, -30133, -30153, -30172, -30192, -30211, -30231, -30250, -30269, -30289, -30308, -30327,
+  -30346, -30365, -30384, -30403, -30421, -30440, -30459, -30477, -30496, -30514, -30532, -30550, -30569, -30587, -30605, -30623,
+  -30641, -30658, -30676, -30694, -30711, -30729, -30746, -30764, -30781, -30798, -30815, -30832, -30849, -30866, -30883, -30900,
+  -30917, -30933, -30950, -30966, -30983, -30999, -31015, -31032, -31048, -31064, -31080, -31096, -31111, -31127, -31143, -31159,
+  -31174, -31190, -31205, -31220, -31235, -31251, -31266, -31281, -31296, -31311, -31325, -31340, -31355, -31369, -31384, -31398,
+  -31413, -31427, -31441, -31455, -31469, -31483, -31497, -31511, -31525, -31538, -31552, -31566, -31579, -31592, -31606, -31619,
+  -31632, -31645, -31658, -31671, -31684, -31697, -31710, -31722, -31735, -31747, -31760, -31772, -31784, -31797, -31809, -31821,
+  -31833, -31845, -31856, -31868, -31880, -31891, -31903, -31914, -31926, -31937, -31948, -31959, -31970, -31981, -31992, -32003,
+  -32014, -32025, -32035, -32046, -32056, -32067, -32077, -32087, -32097, -32107, -32117, -32127, -32137, -32147, -32157, -32166,
+  -32176, -32185, -32195, -32204, -32213, -32222, -32232, -32241, -32250, -32258, -32267, -32276, -32285, -32293, -32302, -32310,
+  -32318, -32327, -32335, -32343, -32351, -32359, -32367, -32375, -32382, -32390, -32397, -32405, -32412, -32420, -32427, -32434,
+  -32441, -32448, -32455, -32462, -32469, -32476, -32482, -32489, -32495, -32502, -32508, -32514, -32521, -32527, -32533, -32539,
+  -32545, -32550, -32556, -32562, -32567, -32573, -32578, -32584, -32589, -32594, -32599, -32604, -32609, -32614, -32619, -32624,
+  -32628, -32633, -32637, -32642, -32646, -32651, -32655, -32659, -32663, -32667, -32671, -32675, -32678, -32682, -32685, -32689,
+  -32692, -32696, -32699, -32702, -32705, -32708, -32711, -32714, -32717, -32720, -32722, -32725, -32727, -32730, -32732, -32734,
+  -32737, -32739, -32741, -32743, -32745, -32746, -32748, -32750, -32751, -32753, -32754, -32756, -32757, -32758, -32759, -32760,
+  -32761, -32762, -32763, -32764, -32764, -32765, -32765, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766,
+  -32766, -32765, -32765, -32764, -32764, -32763, -32762, -32762, -32761, -32760, -32759, -32758, -32756, -32755, -32754, -32752,
+  -32751, -32749, -32747, -32746, -32744, -32742, -32740, -32738, -32736, -32734, -32731, -32729, -32726, -32724, -32721, -32719,
+  -32716, -32713, -32710, -32707, -32704, -32701, -32698, -32694, -32691, -32688, -32684, -32680, -32677, -32673, -32669, -32665,
+  -32661, -32657, -32653, -32649, -32644, -32640, -32636, -32631, -32626, -32622, -32617, -32612, -32607, -32602, -32597, -32592,
+  -32587, -32582, -32576, -32571, -32565, -32560, -32554, -32548, -32542, -32536, -32530, -32524, -32518, -32512, -32506, -32499,
+  -32493, -32486, -32480, -32473, -32466, -32459, -32452, -32445, -32438, -32431, -32424, -32417, -32409, -32402, -32394, -32387,
+  -32379, -32371, -32364, -32356, -32348, -32340, -32331, -32323, -32315, -32307, -32298, -32290, -32281, -32272, -32264, -32255,
+  -32246, -32237, -32228, -32219, -32209, -32200, -32191, -32181, -32172, -32162, -32153, -32143, -32133, -32123, -32113, -32103,
+  -32093, -32083, -32073, -32062, -32052, -32041, -32031, -32020, -32010, -31999, -31988, -31977, -31966, -31955, -31944, -31932,
+  -31921, -31910, -31898, -31887, -31875, -31863, -31852, -31840, -31828, -31816, -31804, -31792, -31779, -31767, -31755, -31742,
+  -31730, -31717, -31704, -31692, -31679, -31666, -31653, -31640, -31627, -31614, -31600, -31587, -31574, -31560, -31546, -31533,
+  -31519, -31505, -31491, -31478, -31463, -31449, -31435, -31421, -31407, -31392, -31378, -31363, -31349, -31334, -31319, -31304,
+  -31290, -31275, -31259, -31244, -31229, -31214, -31199, -31183, -31168, -31152, -31136, -31121, -31105, -31089, -31073, -31057,
+  -31041, -31025, -31009, -30992, -30976, -30960, -30943, -30926, -30910, -30893, -30876, -30859, -30842, -30825, -30808, -30791,
+  -30774, -30756, -30739, -30722, -30704, -30686, -30669, -30651, -30633, -30615, -30597, -30579, -30561, -30543, -30525, -30506,
+  -30488, -30470, -30451, -30432, -30414, -30395, -30376, -30357, -30338, -30319, -30300, -30281, -30262, -30242, -30223, -30203,
+  -30184, -30164, -30144, -30125, -30105, -30085, -30065, -30045, -30025, -30005, -29984, -29964, -29944, -29923, -29903, -29882,
+  -29861, -29841, -29820, -29799, -29778, -29757, -29736, -29715, -29693, -29672, -29651, -29629, -29608, -29586, -29564, -29543,
+  -29521, -29499, -29477, -29455, -29433, -29411, -29388, -29366, -29344, -29321, -29299, -29276, -29254, -29231, -29208, -29185,
+  -29162, -29139, -29116, -29093, -29070, -29047, -29024, -29000, -28977, -28953, -28930, -28906, -28882, -28858, -28834, -28810,
+  -28786, -28762, -28738, -28714, -28690, -28665, -28641, -28617, -28592, -28567, -28543, -28518, -28493, -28468, -28443, -28418,
+  -28393, -28368, -28343, -28317, -28292, -28267, -28241, -28216, -28190, -28164, -28139, -28113, -28087, -28061, -28035, -28009,
+  -27983, -27956, -27930, -27904, -27877, -27851, -27824, -27798, -27771, -27744, -27717, -27691, -27664, -27637, -27610, -27582,
+  -27555, -27528, -27501, -27473, -27446, -27418, -27391, -27363, -27335, -27308, -27280, -27252, -27224, -27196, -27168, -27139,
+  -27111, -27083, -27055, -27026, -26998, -26969, -26940, -26912, -26883, -26854, -26825, -26796, -26767, -26738, -26709, -26680,
+  -26651, -26621, -26592, -26563, -26533, -26504, -26474, -26444, -26415, -26385, -26355, -26325, -26295, -26265, -26235, -26205,
+  -26174, -26144, -26114, -26083, -26053, -26022, -25992, -25961, -25930, -25899, -25868, -25838, -25807, -25775, -25744, -25713,
+  -25682, -25651, -25619, -25588, -25556, -25525, -25493, -25462, -25430, -25398, -25366, -25334, -25303, -25271, -25238, -25206,
+  -25174, -25142, -25110, -25077, -25045, -25012, -24980, -24947, -24915, -24882, -24849, -24816, -24783, -24750, -24717, -24684,
+  -24651, -24618, -24585, -24551, -24518, -24485, -24451, -24418, -24384, -24350, -24317, -24283, -24249, -24215, -24181, -24147,
+  -24113, -24079, -24045, -24011, -23976, -23942, -23908, -23873, -23839, -23804, -23770, -23735, -23700, -23665, -23631, -23596,
+  -23561, -23526, -23491, -23455, -23420, -23385, -23350, -23314, -23279, -23244, -23208, -23173, -23137, -23101, -23066, -23030,
+  -22994, -22958, -22922, -22886, -22850, -22814, -22778, -22742, -22705, -22669, -22633, -22596, -22560, -22523, -22487, -22450,
+  -22413, -22377, -22340, -22303, -22266, -22229, -22192, -22155, -22118, -22081, -22044, -22006, -21969, -21932, -21894, -21857,
+  -21819, -21782, -21744, -21706, -21669, -21631, -21593, -21555, -21517, -21479, -21441, -21403, -21365, -21327, -21288, -21250,
+  -21212, -21173, -21135, -21097, -21058, -21019, -20981, -20942, -20903, -20865, -20826, -20787, -20748, -20709, -20670, -20631,
+  -20592, -20553, -20513, -20474, -20435, -20395, -20356, -20316, -20277, -20237, -20198, -20158, -20118, -20079, -20039, -19999,
+  -19959, -19919, -19879, -19839, -19799, -19759, -19719, -19679, -19638, -19598, -19558, -19517, -19477, -19436, -19396, -19355,
+  -19314, -19274, -19233, -19192, -19151, -19111, -19070, -19029, -18988, -18947, -18906, -18865, -18823, -18782, -18741, -18700,
+  -18658, -18617, -18575, -18534, -18492, -18451, -18409, -18367, -18326, -18284, -18242, -18200, -18159, -18117, -18075, -18033,
+  -17991, -17949, -17906, -17864, -17822, -17780, -17737, -17695, -17653, -17610, -17568, -17525, -17483, -17440, -17398, -17355,
+  -17312, -17269, -17227, -17184, -17141, -17098, -17055, -17012, -16969, -16926, -16883, -16840, -16796, -16753, -16710, -16667,
+  -16623, -16580, -16536, -16493, -16449, -16406, -16362, -16319, -16275, -16231, -16188, -16144, -16100, -16056, -16012, -15968,
+  -15924, -15880, -15836, -15792, -15748, -15704, -15660, -15615, -15571, -15527, -15483, -15438, -15394, -15349, -15305, -15260,
+  -15216, -15171, -15127, -15082, -15037, -14992, -14948, -14903, -14858, -14813, -14768, -14723, -14678, -14633, -14588, -14543,
+  -14498, -14453, -14408, -14362, -14317, -14272, -14227, -14181, -14136, -14090, -14045, -13999, -13954, -13908, -13863, -13817,
+  -13772, -13726, -13680, -13634, -13589, -13543, -13497, -13451, -13405, -13359, -13313, -13267, -13221, -13175, -13129, -13083,
+  -13037, -12990, -12944, -12898, -12852, -12805, -12759, -12713, -12666, -12620, -12573, -12527, -12480, -12434, -12387, -12341,
+  -12294, -12247, -12201, -12154, -12107, -12060, -12014, -11967, -11920, -11873, -11826, -11779, -11732, -11685, -11638, -11591,
+  -11544, -11497, -11450, -11402, -11355, -11308, -11261, -11213, -11166, -11119, -11071, -11024, -10977, -10929, -10882, -10834,
+  -10787, -10739, -10692, -10644, -10596, -10549, -10501, -10453, -10406, -10358, -10310, -10262, -10215, -10167, -10119, -10071,
+  -10023, -9975, -9927, -9879, -9831, -9783, -9735, -9687, -9639, -9591, -9543, -9495, -9446, -9398, -9350, -9302,
+  -9253, -9205, -9157, -9109, -9060, -9012, -8963, -8915, -8867, -8818, -8770, -8721, -8673, -8624, -8575, -8527,
+  -8478, -8430, -8381, -8332, -8284, -8235, -8186, -8137, -8089, -8040, -7991, -7942, -7893, -7845, -7796, -7747,
+  -7698, -7649, -7600, -7551, -7502, -7453, -7404, -7355, -7306, -7257, -7208, -7159, -7109, -7060, -7011, -6962,
+  -6913, -6864, -6814, -6765, -6716, -6667, -6617, -6568, -6519, -6469, -6420, -6371, -6321, -6272, -6222, -6173,
+  -6124, -6074, -6025, -5975, -5926, -5876, -5827, -5777, -5728, -5678, -5628, -5579, -5529, -5480, -5430, -5380,
+  -5331, -5281, -5231, -5182, -5132, -5082, -5033, -4983, -4933, -4883, -4833, -4784, -4734, -4684, -4634, -4584,
+  -4535, -4485, -4435, -4385, -4335, -4285, -4235, -4185, -4135, -4086, -4036, -3986, -3936, -3886, -3836, -3786,
+  -3736, -3686, -3636, -3586, -3536, -3486, -3436, -3385, -3335, -3285, -3235, -3185, -3135, -3085, -3035, -2985,
+  -2935, -2884, -2834, -2784, -2734, -2684, -2634, -2584, -2533, -2483, -2433, -2383, -2333, -2282, -2232, -2182,
+  -2132, -2081, -2031, -1981, -1931, -1881, -1830, -1780, -1730, -1679, -1629, -1579, -1529, -1478, -1428, -1378,
+  -1328, -1277, -1227, -1177, -1126, -1076, -1026, -975, -925, -875, -824, -774, -724, -673, -623, -573,
+  -523, -472, -422, -372, -321, -271, -221, -170, -120, -70, -19, 30, 80, 131, 181, 231
+};
+
+const int16_t oscFlashCos[4096] = {
+  32767, 32766, 32766, 32766, 32766, 32766, 32765, 32765, 32764, 32763, 32763, 32762, 32761, 32760, 32759, 32758,
+  32757, 32755, 32754, 32753, 32751, 32749, 32748, 32746, 32744, 32742, 32740, 32738, 32736, 32734, 32732, 32729,
+  32727, 32724, 32722, 32719, 32716, 32714, 32711, 32708, 32705, 32702, 32698, 32695, 32692, 32688, 32685, 32681,
+  32677, 32674, 32670, 32666, 32662, 32658, 32654, 32650, 32645, 32641, 32637, 32632, 32627, 32623, 32618, 32613,
+  32608, 32603, 32598, 32593, 32588, 32583, 32577, 32572, 32566, 32561, 32555, 32549, 32543, 32538, 32532, 32526,
+  32519, 32513, 32507, 32501, 32494, 32488, 32481, 32474, 32468, 32461, 32454, 32447, 32440, 32433, 32426, 32418,
+  32411, 32403, 32396, 32388, 32381, 32373, 32365, 32357, 32349, 32341, 32333, 32325, 32317, 32308, 32300, 32291,
+  32283, 32274, 32265, 32257, 32248, 32239, 32230, 32221, 32211, 32202, 32193, 32183, 32174, 32164, 32155, 32145,
+  32135, 32125, 32115, 32105, 32095, 32085, 32075, 32064, 32054, 32044, 32033, 32022, 32012, 32001, 31990, 31979,
+  31968, 31957, 31946, 31935, 31923, 31912, 31901, 31889, 31877, 31866, 31854, 31842, 31830, 31818, 31806, 31794,
+  31782, 31770, 31757, 31745, 31732, 31720, 31707, 31694, 31681, 31669, 31656, 31643, 31629, 31616, 31603, 31590,
+  31576, 31563, 31549, 31536, 31522, 31508, 31494, 31480, 31466, 31452, 31438, 31424, 31410, 31395, 31381, 31366,
+  31352, 31337, 31322, 31307, 31293, 31278, 31263, 31247, 31232, 31217, 31202, 31186, 31171, 31155, 31140, 31124,
+  31108, 31092, 31076, 31060, 31044, 31028, 31012, 30996, 30979, 30963, 30946, 30930, 30913, 30896, 30880, 30863,
+  30846, 30829, 30812, 30795, 30777, 30760, 30743, 30725, 30708, 30690, 30672, 30655, 30637, 30619, 30601, 30583,
+  30565, 30547, 30528, 30510, 30492, 30473, 30455, 30436, 30418, 30399, 30380, 30361, 30342, 30323, 30304, 30285,
+  30266, 30246, 30227, 30207, 30188, 30168, 30149, 30129, 30109, 30089, 30069, 30049, 30029, 30009, 29989, 29968,
+  29948, 29927, 29907, 29886, 29866, 29845, 29824, 29803, 29782, 29761, 29740, 29719, 29698, 29676, 29655, 29634,
+  29612, 29590, 29569, 29547, 29525, 29503, 29481, 29459, 29437, 29415, 29393, 29371, 29348, 29326, 29304, 29281,
+  29258, 29236, 29213, 29190, 29167, 29144, 29121, 29098, 29075, 29052, 29028, 29005, 28981, 28958, 28934, 28911,
+  28887, 28863, 28839, 28815, 28791, 28767, 28743, 28719, 28695, 28670, 28646, 28622, 28597, 28572, 28548, 28523,
+  28498, 28473, 28448, 28423, 28398, 28373, 28348, 28323, 28297, 28272, 28246, 28221, 28195, 28170, 28144, 28118,
+  28092, 28066, 28040, 28014, 27988, 27962, 27936, 27909, 27883, 27856, 27830, 27803, 27777, 27750, 27723, 27696,
+  27669, 27642, 27615, 27588, 27561, 27534, 27506, 27479, 27451, 27424, 27396, 27369, 27341, 27313, 27285, 27258,
+  27230, 27202, 27173, 27145, 27117, 27089, 27060, 27032, 27004, 26975, 26946, 26918, 26889, 26860, 26831, 26802,
+  26773, 26744, 26715, 26686, 26657, 26628, 26598, 26569, 26539, 26510, 26480, 26450, 26421, 26391, 26361, 26331,
+  26301, 26271, 26241, 26211, 26181, 26150, 26120, 26089, 26059, 26028, 25998, 25967, 25936, 25906, 25875, 25844,
+  25813, 25782, 25751, 25720, 25688, 25657, 25626, 25594, 25563, 25531, 25500, 25468, 25437, 25405, 25373, 25341,
+  25309, 25277, 25245, 25213, 25181, 25149, 25116, 25084, 25051, 25019, 24986, 24954, 24921, 24889, 24856, 24823,
+  24790, 24757, 24724, 24691, 24658, 24625, 24592, 24558, 24525, 24491, 24458, 24424, 24391, 24357, 24324, 24290,
+  24256, 24222, 24188, 24154, 24120, 24086, 24052, 24018, 23983, 23949, 23915, 23880, 23846, 23811, 23777, 23742,
+  23707, 23673, 23638, 23603, 23568, 23533, 23498, 23463, 23428, 23392, 23357, 23322, 23286, 23251, 23215, 23180,
+  23144, 23109, 23073, 23037, 23001, 22965, 22930, 22894, 22858, 22821, 22785, 22749, 22713, 22677, 22640, 22604,
+  22567, 22531, 22494, 22458, 22421, 22384, 22347, 22311, 22274, 22237, 22200, 22163, 22126, 22088, 22051, 22014,
+  21977, 21939, 21902, 21864, 21827, 21789, 21752, 21714, 21676, 21639, 21601, 21563, 21525, 21487, 21449, 21411,
+  21373, 21335, 21296, 21258, 21220, 21181, 21143, 21104, 21066, 21027, 20989, 20950, 20911, 20873, 20834, 20795,
+  20756, 20717, 20678, 20639, 20600, 20561, 20521, 20482, 20443, 20403, 20364, 20325, 20285, 20246, 20206, 20166,
+  20127, 20087, 20047, 20007, 19967, 19927, 19887, 19847, 19807, 19767, 19727, 19687, 19647, 19606, 19566, 19526,
+  19485, 19445, 19404, 19364, 19323, 19282, 19241, 19201, 19160, 19119, 19078, 19037, 18996, 18955, 18914, 18873,
+  18832, 18791, 18749, 18708, 18667, 18625, 18584, 18542, 18501, 18459, 18418, 18376, 18334, 18293, 18251, 18209,
+  18167, 18125, 18083, 18041, 17999, 17957, 17915, 17873, 17831, 17788, 17746, 17704, 17661, 17619, 17577, 17534,
+  17492, 17449, 17406, 17364, 17321, 17278, 17235, 17193, 17150, 17107, 17064, 17021, 16978, 16935, 16892, 16849,
+  16805, 16762, 16719, 16676, 16632, 16589, 16545, 16502, 16458, 16415, 16371, 16328, 16284, 16240, 16197, 16153,
+  16109, 16065, 16021, 15977, 15933, 15889, 15845, 15801, 15757, 15713, 15669, 15625, 15580, 15536, 15492, 15447,
+  15403, 15359, 15314, 15270, 15225, 15180, 15136, 15091, 15046, 15002, 14957, 14912, 14867, 14822, 14777, 14733,
+  14688, 14643, 14598, 14552, 14507, 14462, 14417, 14372, 14327, 14281, 14236, 14191, 14145, 14100, 14054, 14009,
+  13963, 13918, 13872, 13827, 13781, 13735, 13690, 13644, 13598, 13552, 13506, 13460, 13415, 13369, 13323, 13277,
+  13231, 13185, 13138, 13092, 13046, 13000, 12954, 12908, 12861, 12815, 12769, 12722, 12676, 12629, 12583, 12536,
+  12490, 12443, 12397, 12350, 12304, 12257, 12210, 12164, 12117, 12070, 12023, 11976, 11929, 11883, 11836, 11789,
+  11742, 11695, 11648, 11601, 11554, 11506, 11459, 11412, 11365, 11318, 11270, 11223, 11176, 11129, 11081, 11034,
+  10986, 10939, 10892, 10844, 10797, 10749, 10701, 10654, 10606, 10559, 10511, 10463, 10416, 10368, 10320, 10272,
+  10224, 10177, 10129, 10081, 10033, 9985, 9937, 9889, 9841, 9793, 9745, 9697, 9649, 9601, 9553, 9505,
+  9456, 9408, 9360, 9312, 9263, 9215, 9167, 9118, 9070, 9022, 8973, 8925, 8877, 8828, 8780, 8731,
+  8683, 8634, 8585, 8537, 8488, 8440, 8391, 8342, 8294, 8245, 8196, 8147, 8099, 8050, 8001, 7952,
+  7903, 7855, 7806, 7757, 7708, 7659, 7610, 7561, 7512, 7463, 7414, 7365, 7316, 7267, 7218, 7169,
+  7120, 7070, 7021, 6972, 6923, 6874, 6825, 6775, 6726, 6677, 6627, 6578, 6529, 6480, 6430, 6381,
+  6331, 6282, 6233, 6183, 6134, 6084, 6035, 5985, 5936, 5886, 5837, 5787, 5738, 5688, 5639, 5589,
+  5539, 5490, 5440, 5391, 5341, 5291, 5242, 5192, 5142, 5092, 5043, 4993, 4943, 4894, 4844, 4794,
+  4744, 4694, 4645, 4595, 4545, 4495, 4445, 4395, 4345, 4295, 4246, 4196, 4146, 4096, 4046, 3996,
+  3946, 3896, 3846, 3796, 3746, 3696, 3646, 3596, 3546, 3496, 3446, 3396, 3346, 3296, 3246, 3195,
+  3145, 3095, 3045, 2995, 2945, 2895, 2845, 2795, 2744, 2694, 2644, 2594, 2544, 2493, 2443, 2393,
+  2343, 2293, 2242, 2192, 2142, 2092, 2042, 1991, 1941, 1891, 1841, 1790, 1740, 1690, 1640, 1589,
+  1539, 1489, 1438, 1388, 1338, 1288, 1237, 1187, 1137, 1086, 1036, 986, 935, 885, 835, 785,
+  734, 684, 634, 583, 533, 483, 432, 382, 332, 281, 231, 181, 130, 80, 30, -20,
+  -70, -120, -171, -221, -271, -322, -372, -422, -473, -523, -573, -624, -674, -724, -775, -825,
+  -875, -926, -976, -1026, -1077, -1127, -1177, -1227, -1278, -1328, -1378, -1429, -1479, -1529, -1579, -1630,
+  -1680, -1730, -1781, -1831, -1881, -1931, -1982, -2032, -2082, -2132, -2182, -2233, -2283, -2333, -2383, -2433,
+  -2484, -2534, -2584, -2634, -2684, -2735, -2785, -2835, -2885, -2935, -2985, -3035, -3085, -3136, -3186, -3236,
+  -3286, -3336, -3386, -3436, -3486, -3536, -3586, -3636, -3686, -3736, -3786, -3836, -3886, -3936, -3986, -4036,
+  -4086, -4136, -4186, -4236, -4286, -4336, -4385, -4435, -4485, -4535, -4585, -4635, -4685, -4734, -4784, -4834,
+  -4884, -4934, -4983, -5033, -5083, -5132, -5182, -5232, -5282, -5331, -5381, -5431, -5480, -5530, -5579, -5629,
+  -5679, -5728, -5778, -5827, -5877, -5926, -5976, -6025, -6075, -6124, -6174, -6223, -6272, -6322, -6371, -6421,
+  -6470, -6519, -6569, -6618, -6667, -6716, -6766, -6815, -6864, -6913, -6963, -7012, -7061, -7110, -7159, -7208,
+  -7257, -7306, -7355, -7404, -7453, -7503, -7551, -7600, -7649, -7698, -7747, -7796, -7845, -7894, -7943, -7992,
+  -8040, -8089, -8138, -8187, -8235, -8284, -8333, -8381, -8430, -8479, -8527, -8576, -8624, -8673, -8722, -8770,
+  -8819, -8867, -8915, -8964, -9012, -9061, -9109, -9157, -9206, -9254, -9302, -9350, -9399, -9447, -9495, -9543,
+  -9591, -9640, -9688, -9736, -9784, -9832, -9880, -9928, -9976, -10024, -10072, -10119, -10167, -10215, -10263, -10311,
+  -10358, -10406, -10454, -10502, -10549, -10597, -10645, -10692, -10740, -10787, -10835, -10882, -10930, -10977, -11025, -11072,
+  -11119, -11167, -11214, -11261, -11308, -11356, -11403, -11450, -11497, -11544, -11591, -11639, -11686, -11733, -11780, -11826,
+  -11873, -11920, -11967, -12014, -12061, -12108, -12154, -12201, -12248, -12294, -12341, -12388, -12434, -12481, -12527, -12574,
+  -12620, -12667, -12713, -12760, -12806, -12852, -12898, -12945, -12991, -13037, -13083, -13129, -13176, -13222, -13268, -13314,
+  -13360, -13406, -13451, -13497, -13543, -13589, -13635, -13681, -13726, -13772, -13818, -13863, -13909, -13954, -14000, -14045,
+  -14091, -14136, -14182, -14227, -14272, -14318, -14363, -14408, -14453, -14498, -14544, -14589, -14634, -14679, -14724, -14769,
+  -14814, -14858, -14903, -14948, -14993, -15038, -15082, -15127, -15172, -15216, -15261, -15305, -15350, -15394, -15439, -15483,
+  -15527, -15572, -15616, -15660, -15704, -15749, -15793, -15837, -15881, -15925, -15969, -16013, -16057, -16100, -16144, -16188,
+  -16232, -16275, -16319, -16363, -16406, -16450, -16493, -16537, -16580, -16624, -16667, -16710, -16754, -16797, -16840, -16883,
+  -16926, -16969, -17012, -17055, -17098, -17141, -17184, -17227, -17270, -17313, -17355, -17398, -17441, -17483, -17526, -17568,
+  -17611, -17653, -17696, -17738, -17780, -17822, -17865, -17907, -17949, -17991, -18033, -18075, -18117, -18159, -18201, -18243,
+  -18284, -18326, -18368, -18410, -18451, -18493, -18534, -18576, -18617, -18659, -18700, -18741, -18783, -18824, -18865, -18906,
+  -18947, -18988, -19029, -19070, -19111, -19152, -19193, -19234, -19274, -19315, -19356, -19396, -19437, -19477, -19518, -19558,
+  -19598, -19639, -19679, -19719, -19759, -19800, -19840, -19880, -19920, -19960, -19999, -20039, -20079, -20119, -20159, -20198,
+  -20238, -20277, -20317, -20356, -20396, -20435, -20474, -20514, -20553, -20592, -20631, -20670, -20709, -20748, -20787, -20826,
+  -20865, -20904, -20943, -20981, -21020, -21058, -21097, -21135, -21174, -21212, -21251, -21289, -21327, -21365, -21403, -21442,
+  -21480, -21518, -21555, -21593, -21631, -21669, -21707, -21744, -21782, -21820, -21857, -21895, -21932, -21969, -22007, -22044,
+  -22081, -22118, -22155, -22192, -22229, -22266, -22303, -22340, -22377, -22414, -22450, -22487, -22524, -22560, -22597, -22633,
+  -22669, -22706, -22742, -22778, -22814, -22850, -22887, -22923, -22958, -22994, -23030, -23066, -23102, -23137, -23173, -23208,
+  -23244, -23279, -23315, -23350, -23385, -23421, -23456, -23491, -23526, -23561, -23596, -23631, -23666, -23701, -23735, -23770,
+  -23805, -23839, -23874, -23908, -23942, -23977, -24011, -24045, -24079, -24114, -24148, -24182, -24216, -24249, -24283, -24317,
+  -24351, -24384, -24418, -24451, -24485, -24518, -24552, -24585, -24618, -24651, -24685, -24718, -24751, -24784, -24817, -24849,
+  -24882, -24915, -24948, -24980, -25013, -25045, -25078, -25110, -25142, -25174, -25207, -25239, -25271, -25303, -25335, -25367,
+  -25399, -25430, -25462, -25494, -25525, -25557, -25588, -25620, -25651, -25682, -25714, -25745, -25776, -25807, -25838, -25869,
+  -25900, -25930, -25961, -25992, -26022, -26053, -26084, -26114, -26144, -26175, -26205, -26235, -26265, -26295, -26325, -26355,
+  -26385, -26415, -26445, -26474, -26504, -26533, -26563, -26592, -26622, -26651, -26680, -26710, -26739, -26768, -26797, -26826,
+  -26855, -26883, -26912, -26941, -26969, -26998, -27026, -27055, -27083, -27112, -27140, -27168, -27196, -27224, -27252, -27280,
+  -27308, -27336, -27363, -27391, -27419, -27446, -27474, -27501, -27528, -27556, -27583, -27610, -27637, -27664, -27691, -27718,
+  -27745, -27771, -27798, -27825, -27851, -27878, -27904, -27930, -27957, -27983, -28009, -28035, -28061, -28087, -28113, -28139,
+  -28165, -28190, -28216, -28241, -28267, -28292, -28318, -28343, -28368, -28393, -28418, -28444, -28468, -28493, -28518, -28543,
+  -28568, -28592, -28617, -28641, -28666, -28690, -28714, -28739, -28763, -28787, -28811, -28835, -28859, -28882, -28906, -28930,
+  -28953, -28977, -29000, -29024, -29047, -29070, -29094, -29117, -29140, -29163, -29186, -29208, -29231, -29254, -29277, -29299,
+  -29322, -29344, -29366, -29389, -29411, -29433, -29455, -29477, -29499, -29521, -29543, -29565, -29586, -29608, -29629, -29651,
+  -29672, -29693, -29715, -29736, -29757, -29778, -29799, -29820, -29841, -29861, -29882, -29903, -29923, -29944, -29964, -29985,
+  -30005, -30025, -30045, -30065, -30085, -30105, -30125, -30145, -30164, -30184, -30204, -30223, -30242, -30262, -30281, -30300,
+  -30319, -30338, -30357, -30376, -30395, -30414, -30433, -30451, -30470, -30488, -30507, -30525, -30543, -30561, -30579, -30598,
+  -30615, -30633, -30651, -30669, -30687, -30704, -30722, -30739, -30757, -30774, -30791, -30808, -30826, -30843, -30859, -30876,
+  -30893, -30910, -30927, -30943, -30960, -30976, -30993, -31009, -31025, -31041, -31057, -31073, -31089, -31105, -31121, -31137,
+  -31152, -31168, -31183, -31199, -31214, -31229, -31245, -31260, -31275, -31290, -31305, -31319, -31334, -31349, -31363, -31378,
+  -31392, -31407, -31421, -31435, -31450, -31464, -31478, -31492, -31505, -31519, -31533, -31547, -31560, -31574, -31587, -31600,
+  -31614, -31627, -31640, -31653, -31666, -31679, -31692, -31705, -31717, -31730, -31742, -31755, -31767, -31779, -31792, -31804,
+  -31816, -31828, -31840, -31852, -31863, -31875, -31887, -31898, -31910, -31921, -31932, -31944, -31955, -31966, -31977, -31988,
+  -31999, -32010, -32020, -32031, -32042, -32052, -32062, -32073, -32083, -32093, -32103, -32113, -32123, -32133, -32143, -32153,
+  -32162, -32172, -32182, -32191, -32200, -32210, -32219, -32228, -32237, -32246, -32255, -32264, -32272, -32281, -32290, -32298,
+  -32307, -32315, -32323, -32332, -32340, -32348, -32356, -32364, -32371, -32379, -32387, -32394, -32402, -32409, -32417, -32424,
+  -32431, -32438, -32446, -32453, -32459, -32466, -32473, -32480, -32486, -32493, -32499, -32506, -32512, -32518, -32524, -32530,
+  -32536, -32542, -32548, -32554, -32560, -32565, -32571, -32576, -32582, -32587, -32592, -32597, -32602, -32607, -32612, -32617,
+  -32622, -32627, -32631, -32636, -32640, -32644, -32649, -32653, -32657, -32661, -32665, -32669, -32673, -32677, -32680, -32684,
+  -32688, -32691, -32694, -32698, -32701, -32704, -32707, -32710, -32713, -32716, -32719, -32721, -32724, -32726, -32729, -32731,
+  -32734, -32736, -32738, -32740, -32742, -32744, -32746, -32747, -32749, -32751, -32752, -32754, -32755, -32756, -32758, -32759,
+  -32760, -32761, -32762, -32762, -32763, -32764, -32764, -32765, -32765, -32766, -32766, -32766, -32766, -32766, -32766, -32766,
+  -32766, -32766, -32766, -32765, -32765, -32764, -32764, -32763, -32762, -32761, -32760, -32759, -32758, -32757, -32756, -32754,
+  -32753, -32751, -32750, -32748, -32746, -32745, -32743, -32741, -32739, -32737, -32734, -32732, -32730, -32727, -32725, -32722,
+  -32720, -32717, -32714, -32711, -32708, -32705, -32702, -32699, -32696, -32692, -32689, -32685, -32682, -32678, -32674, -32671,
+  -32667, -32663, -32659, -32655, -32650, -32646, -32642, -32637, -32633, -32628, -32624, -32619, -32614, -32609, -32604, -32599,
+  -32594, -32589, -32584, -32578, -32573, -32567, -32562, -32556, -32550, -32545, -32539, -32533, -32527, -32521, -32514, -32508,
+  -32502, -32495, -32489, -32482, -32476, -32469, -32462, -32455, -32448, -32441, -32434, -32427, -32420, -32412, -32405, -32397,
+  -32390, -32382, -32374, -32367, -32359, -32351, -32343, -32335, -32327, -32318, -32310, -32302, -32293, -32284, -32276, -32267,
+  -32258, -32249, -32240, -32231, -32222, -32213, -32204, -32195, -32185, -32176, -32166, -32157, -32147, -32137, -32127, -32117,
+  -32107, -32097, -32087, -32077, -32067, -32056, -32046, -32035, -32025, -32014, -32003, -31992, -31981, -31970, -31959, -31948,
+  -31937, -31926, -31914, -31903, -31891, -31880, -31868, -31856, -31844, -31833, -31821, -31809, -31796, -31784, -31772, -31760,
+  -31747, -31735, -31722, -31709, -31697, -31684, -31671, -31658, -31645, -31632, -31619, -31606, -31592, -31579, -31565, -31552,
+  -31538, -31525, -31511, -31497, -31483, -31469, -31455, -31441, -31427, -31412, -31398, -31384, -31369, -31355, -31340, -31325,
+  -31310, -31296, -31281, -31266, -31250, -31235, -31220, -31205, -31189, -31174, -31158, -31143, -31127, -31111, -31095, -31080,
+  -31064, -31048, -31031, -31015, -30999, -30983, -30966, -30950, -30933, -30916, -30900, -30883, -30866, -30849, -30832, -30815,
+  -30798, -30781, -30763, -30746, -30729, -30711, -30694, -30676, -30658, -30640, -30623, -30605, -30587, -30568, -30550, -30532,
+  -30514, -30495, -30477, -30458, -30440, -30421, -30402, -30384, -30365, -30346, -30327, -30308, -30289, -30269, -30250, -30231,
+  -30211, -30192, -30172, -30152, -30133, -30113, -30093, -30073, -30053, -30033, -30013, -29992, -29972, -29952, -29931, -29911,
+  -29890, -29870, -29849, -29828, -29807, -29786, -29765, -29744, -29723, -29702, -29681, -29659, -29638, -29616, -29595, -29573,
+  -29551, -29530, -29508, -29486, -29464, -29442, -29420, -29397, -29375, -29353, -29330, -29308, -29285, -29263, -29240, -29217,
+  -29195, -29172, -29149, -29126, -29103, -29079, -29056, -29033, -29010, -28986, -28963, -28939, -28915, -28892, -28868, -28844,
+  -28820, -28796, -28772, -28748, -28724, -28700, -28675, -28651, -28626, -28602, -28577, -28553, -28528, -28503, -28478, -28453,
+  -28428, -28403, -28378, -28353, -28328, -28302, -28277, -28251, -28226, -28200, -28175, -28149, -28123, -28097, -28071, -28045,
+  -28019, -27993, -27967, -27941, -27914, -27888, -27862, -27835, -27808, -27782, -27755, -27728, -27701, -27675, -27648, -27620,
+  -27593, -27566, -27539, -27512, -27484, -27457, -27429, -27402, -27374, -27346, -27319, -27291, -27263, -27235, -27207, -27179,
+  -27151, -27123, -27094, -27066, -27038, -27009, -26981, -26952, -26923, -26895, -26866, -26837, -26808, -26779, -26750, -26721,
+  -26692, -26663, -26633, -26604, -26575, -26545, -26516, -26486, -26456, -26427, -26397, -26367, -26337, -26307, -26277, -26247,
+  -26217, -26186, -26156, -26126, -26095, -26065, -26034, -26004, -25973, -25942, -25912, -25881, -25850, -25819, -25788, -25757,
+  -25726, -25695, -25663, -25632, -25601, -25569, -25538, -25506, -25474, -25443, -25411, -25379, -25347, -25315, -25283, -25251,
+  -25219, -25187, -25155, -25123, -25090, -25058, -25025, -24993, -24960, -24928, -24895, -24862, -24829, -24797, -24764, -24731,
+  -24698, -24664, -24631, -24598, -24565, -24531, -24498, -24465, -24431, -24397, -24364, -24330, -24296, -24263, -24229, -24195,
+  -24161, -24127, -24093, -24059, -24024, -23990, -23956, -23922, -23887, -23853, -23818, -23783, -23749, -23714, -23679, -23645,
+  -23610, -23575, -23540, -23505, -23470, -23434, -23399, -23364, -23329, -23293, -23258, -23222, -23187, -23151, -23116, -23080,
+  -23044, -23008, -22973, -22937, -22901, -22865, -22829, -22792, -22756, -22720, -22684, -22647, -22611, -22574, -22538, -22501,
+  -22465, -22428, -22391, -22355, -22318, -22281, -22244, -22207, -22170, -22133, -22096, -22059, -22021, -21984, -21947, -21909,
+  -21872, -21834, -21797, -21759, -21721, -21684, -21646, -21608, -21570, -21532, -21494, -21456, -21418, -21380, -21342, -21304,
+  -21266, -21227, -21189, -21150, -21112, -21074, -21035, -20996, -20958, -20919, -20880, -20841, -20803, -20764, -20725, -20686,
+  -20647, -20607, -20568, -20529, -20490, -20451, -20411, -20372, -20332, -20293, -20253, -20214, -20174, -20134, -20095, -20055,
+  -20015, -19975, -19935, -19895, -19855, -19815, -19775, -19735, -19695, -19654, -19614, -19574, -19533, -19493, -19453, -19412,
+  -19371, -19331, -19290, -19249, -19209, -19168, -19127, -19086, -19045, -19004, -18963, -18922, -18881, -18840, -18799, -18757,
+  -18716, -18675, -18633, -18592, -18551, -18509, -18467, -18426, -18384, -18343, -18301, -18259, -18217, -18175, -18133, -18092,
+  -18050, -18008, -17965, -17923, -17881, -17839, -17797, -17754, -17712, -17670, -17627, -17585, -17542, -17500, -17457, -17415,
+  -17372, -17329, -17287, -17244, -17201, -17158, -17115, -17072, -17029, -16986, -16943, -16900, -16857, -16814, -16771, -16727,
+  -16684, -16641, -16597, -16554, -16510, -16467, -16423, -16380, -16336, -16293, -16249, -16205, -16161, -16118, -16074, -16030,
+  -15986, -15942, -15898, -15854, -15810, -15766, -15722, -15678, -15633, -15589, -15545, -15500, -15456, -15412, -15367, -15323,
+  -15278, -15234, -15189, -15144, -15100, -15055, -15010, -14966, -14921, -14876, -14831, -14786, -14741, -14696, -14651, -14606,
+  -14561, -14516, -14471, -14426, -14381, -14335, -14290, -14245, -14199, -14154, -14109, -14063, -14018, -13972, -13927, -13881,
+  -13836, -13790, -13744, -13698, -13653, -13607, -13561, -13515, -13469, -13424, -13378, -13332, -13286, -13240, -13194, -13148,
+  -13101, -13055, -13009, -12963, -12917, -12870, -12824, -12778, -12731, -12685, -12639, -12592, -12546, -12499, -12453, -12406,
+  -12359, -12313, -12266, -12219, -12173, -12126, -12079, -12032, -11986, -11939, -11892, -11845, -11798, -11751, -11704, -11657,
+  -11610, -11563, -11516, -11469, -11421, -11374, -11327, -11280, -11232, -11185, -11138, -11091, -11043, -10996, -10948, -10901,
+  -10853, -10806, -10758, -10711, -10663, -10616, -10568, -10520, -10473, -10425, -10377, -10329, -10282, -10234, -10186, -10138,
+  -10090, -10042, -9994, -9947, -9899, -9851, -9803, -9755, -9706, -9658, -9610, -9562, -9514, -9466, -9418, -9369,
+  -9321, -9273, -9225, -9176, -9128, -9080, -9031, -8983, -8934, -8886, -8838, -8789, -8741, -8692, -8644, -8595,
+  -8546, -8498, -8449, -8401, -8352, -8303, -8254, -8206, -8157, -8108, -8059, -8011, -7962, -7913, -7864, -7815,
+  -7766, -7718, -7669, -7620, -7571, -7522, -7473, -7424, -7375, -7326, -7277, -7227, -7178, -7129, -7080, -7031,
+  -6982, -6933, -6883, -6834, -6785, -6736, -6686, -6637, -6588, -6539, -6489, -6440, -6390, -6341, -6292, -6242,
+  -6193, -6143, -6094, -6045, -5995, -5946, -5896, -5847, -5797, -5748, -5698, -5648, -5599, -5549, -5500, -5450,
+  -5400, -5351, -5301, -5251, -5202, -5152, -5102, -5052, -5003, -4953, -4903, -4853, -4804, -4754, -4704, -4654,
+  -4604, -4555, -4505, -4455, -4405, -4355, -4305, -4255, -4205, -4156, -4106, -4056, -4006, -3956, -3906, -3856,
+  -3806, -3756, -3706, -3656, -3606, -3556, -3506, -3456, -3406, -3356, -3305, -3255, -3205, -3155, -3105, -3055,
+  -3005, -2955, -2905, -2854, -2804, -2754, -2704, -2654, -2604, -2554, -2503, -2453, -2403, -2353, -2303, -2252,
+  -2202, -2152, -2102, -2051, -2001, -1951, -1901, -1850, -1800, -1750, -1700, -1649, -1599, -1549, -1499, -1448,
+  -1398, -1348, -1297, -1247, -1197, -1147, -1096, -1046, -996, -945, -895, -845, -794, -744, -694, -643,
+  -593, -543, -492, -442, -392, -341, -291, -241, -190, -140, -90, -39, 10, 60, 111, 161,
+  211, 262, 312, 362, 413, 463, 513, 564, 614, 664, 714, 765, 815, 865, 916, 966,
+  1016, 1067, 1117, 1167, 1218, 1268, 1318, 1368, 1419, 1469, 1519, 1570, 1620, 1670, 1720, 1771,
+  1821, 1871, 1921, 1972, 2022, 2072, 2122, 2173, 2223, 2273, 2323, 2373, 2424, 2474, 2524, 2574,
+  2624, 2675, 2725, 2775, 2825, 2875, 2925, 2975, 3026, 3076, 3126, 3176, 3226, 3276, 3326, 3376,
+  3426, 3476, 3526, 3576, 3626, 3676, 3726, 3776, 3826, 3876, 3926, 3976, 4026, 4076, 4126, 4176,
+  4226, 4276, 4326, 4376, 4426, 4475, 4525, 4575, 4625, 4675, 4725, 4774, 4824, 4874, 4924, 4974,
+  5023, 5073, 5123, 5172, 5222, 5272, 5321, 5371, 5421, 5470, 5520, 5570, 5619, 5669, 5718, 5768,
+  5817, 5867, 5917, 5966, 6015, 6065, 6114, 6164, 6213, 6263, 6312, 6361, 6411, 6460, 6510, 6559,
+  6608, 6657, 6707, 6756, 6805, 6854, 6904, 6953, 7002, 7051, 7100, 7149, 7199, 7248, 7297, 7346,
+  7395, 7444, 7493, 7542, 7591, 7640, 7689, 7738, 7787, 7835, 7884, 7933, 7982, 8031, 8080, 8128,
+  8177, 8226, 8275, 8323, 8372, 8421, 8469, 8518, 8566, 8615, 8664, 8712, 8761, 8809, 8858, 8906,
+  8954, 9003, 9051, 9100, 9148, 9196, 9245, 9293, 9341, 9389, 9437, 9486, 9534, 9582, 9630, 9678,
+  9726, 9774, 9822, 9870, 9918, 9966, 10014, 10062, 10110, 10158, 10206, 10254, 10301, 10349, 10397, 10445,
+  10492, 10540, 10588, 10635, 10683, 10730, 10778, 10825, 10873, 10920, 10968, 11015, 11063, 11110, 11157, 11205,
+  11252, 11299, 11346, 11394, 11441, 11488, 11535, 11582, 11629, 11676, 11723, 11770, 11817, 11864, 11911, 11958,
+  12005, 12052, 12098, 12145, 12192, 12239, 12285, 12332, 12379, 12425, 12472, 12518, 12565, 12611, 12658, 12704,
+  12750, 12797, 12843, 12889, 12936, 12982, 13028, 13074, 13120, 13167, 13213, 13259, 13305, 13351, 13397, 13443,
+  13488, 13534, 13580, 13626, 13672, 13717, 13763, 13809, 13854, 13900, 13945, 13991, 14037, 14082, 14127, 14173,
+  14218, 14264, 14309, 14354, 14399, 14444, 14490, 14535, 14580, 14625, 14670, 14715, 14760, 14805, 14850, 14895,
+  14939, 14984, 15029, 15074, 15118, 15163, 15207, 15252, 15297, 15341, 15386, 15430, 15474, 15519, 15563, 15607,
+  15652, 15696, 15740, 15784, 15828, 15872, 15916, 15960, 16004, 16048, 16092, 16136, 16179, 16223, 16267, 16311,
+  16354, 16398, 16441, 16485, 16528, 16572, 16615, 16659, 16702, 16745, 16788, 16832, 16875, 16918, 16961, 17004,
+  17047, 17090, 17133, 17176, 17219, 17261, 17304, 17347, 17390, 17432, 17475, 17517, 17560, 17602, 17645, 17687,
+  17730, 17772, 17814, 17856, 17899, 17941, 17983, 18025, 18067, 18109, 18151, 18193, 18234, 18276, 18318, 18360,
+  18401, 18443, 18485, 18526, 18568, 18609, 18651, 18692, 18733, 18774, 18816, 18857, 18898, 18939, 18980, 19021,
+  19062, 19103, 19144, 19185, 19226, 19266, 19307, 19348, 19388, 19429, 19469, 19510, 19550, 19590, 19631, 19671,
+  19711, 19752, 19792, 19832, 19872, 19912, 19952, 19992, 20031, 20071, 20111, 20151, 20190, 20230, 20270, 20309,
+  20349, 20388, 20427, 20467, 20506, 20545, 20584, 20624, 20663, 20702, 20741, 20780, 20819, 20857, 20896, 20935,
+  20974, 21012, 21051, 21089, 21128, 21166, 21205, 21243, 21281, 21320, 21358, 21396, 21434, 21472, 21510, 21548,
+  21586, 21624, 21662, 21699, 21737, 21775, 21812, 21850, 21887, 21925, 21962, 21999, 22037, 22074, 22111, 22148,
+  22185, 22222, 22259, 22296, 22333, 22370, 22407, 22443, 22480, 22516, 22553, 22589, 22626, 22662, 22699, 22735,
+  22771, 22807, 22843, 22879, 22915, 22951, 22987, 23023, 23059, 23095, 23130, 23166, 23202, 23237, 23273, 23308,
+  23343, 23379, 23414, 23449, 23484, 23519, 23554, 23589, 23624, 23659, 23694, 23728, 23763, 23798, 23832, 23867,
+  23901, 23936, 23970, 24004, 24039, 24073, 24107, 24141, 24175, 24209, 24243, 24277, 24310, 24344, 24378, 24411,
+  24445, 24478, 24512, 24545, 24578, 24612, 24645, 24678, 24711, 24744, 24777, 24810, 24843, 24876, 24908, 24941,
+  24974, 25006, 25039, 25071, 25104, 25136, 25168, 25200, 25233, 25265, 25297, 25329, 25360, 25392, 25424, 25456,
+  25487, 25519, 25551, 25582, 25614, 25645, 25676, 25707, 25739, 25770, 25801, 25832, 25863, 25894, 25924, 25955,
+  25986, 26016, 26047, 26078, 26108, 26138, 26169, 26199, 26229, 26259, 26289, 26319, 26349, 26379, 26409, 26439,
+  26468, 26498, 26528, 26557, 26587, 26616, 26645, 26675, 26704, 26733, 26762, 26791, 26820, 26849, 26878, 26906,
+  26935, 26964, 26992, 27021, 27049, 27078, 27106, 27134, 27162, 27191, 27219, 27247, 27274, 27302, 27330, 27358,
+  27386, 27413, 27441, 27468, 27496, 27523, 27550, 27577, 27605, 27632, 27659, 27686, 27713, 27739, 27766, 27793,
+  27819, 27846, 27872, 27899, 27925, 27952, 27978, 28004, 28030, 28056, 28082, 28108, 28134, 28160, 28185, 28211,
+  28236, 28262, 28287, 28313, 28338, 28363, 28388, 28414, 28439, 28464, 28488, 28513, 28538, 28563, 28587, 28612,
+  28636, 28661, 28685, 28710, 28734, 28758, 28782, 28806, 28830, 28854, 28878, 28901, 28925, 28949, 28972, 28996,
+  29019, 29043, 29066, 29089, 29112, 29135, 29158, 29181, 29204, 29227, 29249, 29272, 29295, 29317, 29340, 29362,
+  29384, 29407, 29429, 29451, 29473, 29495, 29517, 29539, 29560, 29582, 29604, 29625, 29647, 29668, 29689, 29711,
+  29732, 29753, 29774, 29795, 29816, 29837, 29857, 29878, 29899, 29919, 29940, 29960, 29981, 30001, 30021, 30041,
+  30061, 30081, 30101, 30121, 30141, 30160, 30180, 30200, 30219, 30239, 30258, 30277, 30296, 30316, 30335, 30354,
+  30373, 30391, 30410, 30429, 30448, 30466, 30485, 30503, 30521, 30540, 30558, 30576, 30594, 30612, 30630, 30648,
+  30666, 30683, 30701, 30718, 30736, 30753, 30771, 30788, 30805, 30822, 30839, 30856, 30873, 30890, 30907, 30923,
+  30940, 30956, 30973, 30989, 31006, 31022, 31038, 31054, 31070, 31086, 31102, 31118, 31134, 31149, 31165, 31180,
+  31196, 31211, 31226, 31242, 31257, 31272, 31287, 31302, 31317, 31331, 31346, 31361, 31375, 31390, 31404, 31418,
+  31433, 31447, 31461, 31475, 31489, 31503, 31517, 31530, 31544, 31558, 31571, 31584, 31598, 31611, 31624, 31637,
+  31651, 31664, 31676, 31689, 31702, 31715, 31727, 31740, 31752, 31765, 31777, 31789, 31801, 31814, 31826, 31837,
+  31849, 31861, 31873, 31884, 31896, 31908, 31919, 31930, 31942, 31953, 31964, 31975, 31986, 31997, 32008, 32018,
+  32029, 32039, 32050, 32060, 32071, 32081, 32091, 32101, 32111, 32121, 32131, 32141, 32151, 32161, 32170, 32180,
+  32189, 32198, 32208, 32217, 32226, 32235, 32244, 32253, 32262, 32271, 32279, 32288, 32297, 32305, 32313, 32322,
+  32330, 32338, 32346, 32354, 32362, 32370, 32378, 32385, 32393, 32401, 32408, 32415, 32423, 32430, 32437, 32444,
+  32451, 32458, 32465, 32472, 32478, 32485, 32492, 32498, 32504, 32511, 32517, 32523, 32529, 32535, 32541, 32547,
+  32553, 32558, 32564, 32570, 32575, 32581, 32586, 32591, 32596, 32601, 32606, 32611, 32616, 32621, 32626, 32630,
+  32635, 32639, 32644, 32648, 32652, 32656, 32660, 32664, 32668, 32672, 32676, 32680, 32683, 32687, 32690, 32694,
+  32697, 32700, 32703, 32707, 32710, 32712, 32715, 32718, 32721, 32723, 32726, 32728, 32731, 32733, 32735, 32737,
+  32740, 32742, 32744, 32745, 32747, 32749, 32750, 32752, 32753, 32755, 32756, 32757, 32758, 32760, 32761, 32761,
+  32762, 32763, 32764, 32764, 32765, 32765, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766
+};
+
+const int16_t oscFlashTri[4096] = {
+  32767, 32735, 32703, 32671, 32639, 32607, 32575, 32543, 32511, 32479, 32447, 32415, 32383, 32351, 32319, 32287,
+  32255, 32223, 32191, 32159, 32127, 32095, 32063, 32031, 31999, 31967, 31935, 31903, 31871, 31839, 31807, 31775,
+  31743, 31711, 31679, 31647, 31615, 31583, 31551, 31519, 31487, 31455, 31423, 31391, 31359, 31327, 31295, 31263,
+  31231, 31199, 31167, 31135, 31103, 31071, 31039, 31007, 30975, 30943, 30911, 30879, 30847, 30815, 30783, 30751,
+  30719, 30687, 30655, 30623, 30591, 30559, 30527, 30495, 30463, 30431, 30399, 30367, 30335, 30303, 30271, 30239,
+  30207, 30175, 30143, 30111, 30079, 30047, 30015, 29983, 29951, 29919, 29887, 29855, 29823, 29791, 29759, 29727,
+  29695, 29663, 29631, 29599, 29567, 29535, 29503, 29471, 29439, 29407, 29375, 29343, 29311, 29279, 29247, 29215,
+  29183, 29151, 29119, 29087, 29055, 29023, 28991, 28959, 28927, 28895, 28863, 28831, 28799, 28767, 28735, 28703,
+  28671, 28639, 28607, 28575, 28543, 28511, 28479, 28447, 28415, 28383, 28351, 28319, 28287, 28255, 28223, 28191,
+  28159, 28127, 28095, 28063, 28031, 27999, 27967, 27935, 27903, 27871, 27839, 27807, 27775, 27743, 27711, 27679,
+  27647, 27615, 27583, 27551, 27519, 27487, 27455, 27423, 27391, 27359, 27327, 27295, 27263, 27231, 27199, 27167,
+  27135, 27103, 27071, 27039, 27007, 26975, 26943, 26911, 26879, 26847, 26815, 26783, 26751, 26719, 26687, 26655,
+  26623, 26591, 26559, 26527, 26495, 26463, 26431, 26399, 26367, 26335, 26303, 26271, 26239, 26207, 26175, 26143,
+  26111, 26079, 26047, 26015, 25983, 25951, 25919, 25887, 25855, 25823, 25791, 25759, 25727, 25695, 25663, 25631,
+  25599, 25567, 25535, 25503, 25471, 25439, 25407, 25375, 25343, 25311, 25279, 25247, 25215, 25183, 25151, 25119,
+  25087, 25055, 25023, 24991, 24959, 24927, 24895, 24863, 24831, 24799, 24767, 24735, 24703, 24671, 24639, 24607,
+  24575, 24543, 24511, 24479, 24447, 24415, 24383, 24351, 24319, 24287, 24255, 24223, 24191, 24159, 24127, 24095,
+  24063, 24031, 23999, 23967, 23935, 23903, 23871, 23839, 23807, 23775, 23743, 23711, 23679, 23647, 23615, 23583,
+  23551, 23519, 23487, 23455, 23423, 23391, 23359, 23327, 23295, 23263, 23231, 23199, 23167, 23135, 23103, 23071,
+  23039, 23007, 22975, 22943, 22911, 22879, 22847, 22815, 22783, 22751, 22719, 22687, 22655, 22623, 22591, 22559,
+  22527, 22495, 22463, 22431, 22399, 22367, 22335, 22303, 22271, 22239, 22207, 22175, 22143, 22111, 22079, 22047,
+  22015, 21983, 21951, 21919, 21887, 21855, 21823, 21791, 21759, 21727, 21695, 21663, 21631, 21599, 21567, 21535,
+  21503, 21471, 21439, 21407, 21375, 21343, 21311, 21279, 21247, 21215, 21183, 21151, 21119, 21087, 21055, 21023,
+  20991, 20959, 20927, 20895, 20863, 20831, 20799, 20767, 20735, 20703, 20671, 20639, 20607, 20575, 20543, 20511,
+  20479, 20447, 20415, 20383, 20351, 20319, 20287, 20255, 20223, 20191, 20159, 20127, 20095, 20063, 20031, 19999,
+  19967, 19935, 19903, 19871, 19839, 19807, 19775, 19743, 19711, 19679, 19647, 19615, 19583, 19551, 19519, 19487,
+  19455, 19423, 19391, 19359, 19327, 19295, 19263, 19231, 19199, 19167, 19135, 19103, 19071, 19039, 19007, 18975,
+  18943, 18911, 18879, 18847, 18815, 18783, 18751, 18719, 18687, 18655, 18623, 18591, 18559, 18527, 18495, 18463,
+  18431, 18399, 18367, 18335, 18303, 18271, 18239, 18207, 18175, 18143, 18111, 18079, 18047, 18015, 17983, 17951,
+  17919, 17887, 17855, 17823, 17791, 17759, 17727, 17695, 17663, 17631, 17599, 17567, 17535, 17503, 17471, 17439,
+  17407, 17375, 17343, 17311, 17279, 17247, 17215, 17183, 17151, 17119, 17087, 17055, 17023, 16991, 16959, 16927,
+  16895, 16863, 16831, 16799, 16767, 16735, 16703, 16671, 16639, 16607, 16575, 16543, 16511, 16479, 16447, 16415,
+  16383, 16351, 16319, 16287, 16255, 16223, 16191, 16159, 16127, 16095, 16063, 16031, 15999, 15967, 15935, 15903,
+  15871, 15839, 15807, 15775, 15743, 15711, 15679, 15647, 15615, 15583, 15551, 15519, 15487, 15455, 15423, 15391,
+  15359, 15327, 15295, 15263, 15231, 15199, 15167, 15135, 15103, 15071, 15039, 15007, 14975, 14943, 14911, 14879,
+  14847, 14815, 14783, 14751, 14719, 14687, 14655, 14623, 14591, 14559, 14527, 14495, 14463, 14431, 14399, 14367,
+  14335, 14303, 14271, 14239, 14207, 14175, 14143, 14111, 14079, 14047, 14015, 13983, 13951, 13919, 13887, 13855,
+  13823, 13791, 13759, 13727, 13695, 13663, 13631, 13599, 13567, 13535, 13503, 13471, 13439, 13407, 13375, 13343,
+  13311, 13279, 13247, 13215, 13183, 13151, 13119, 13087, 13055, 13023, 12991, 12959, 12927, 12895, 12863, 12831,
+  12799, 12767, 12735, 12703, 12671, 12639, 12607, 12575, 12543, 12511, 12479, 12447, 12415, 12383, 12351, 12319,
+  12287, 12255, 12223, 12191, 12159, 12127, 12095, 12063, 12031, 11999, 11967, 11935, 11903, 11871, 11839, 11807,
+  11775, 11743, 11711, 11679, 11647, 11615, 11583, 11551, 11519, 11487, 11455, 11423, 11391, 11359, 11327, 11295,
+  11263, 11231, 11199, 11167, 11135, 11103, 11071, 11039, 11007, 10975, 10943, 10911, 10879, 10847, 10815, 10783,
+  10751, 10719, 10687, 10655, 10623, 10591, 10559, 10527, 10495, 10463, 10431, 10399, 10367, 10335, 10303, 10271,
+  10239, 10207, 10175, 10143, 10111, 10079, 10047, 10015, 9983, 9951, 9919, 9887, 9855, 9823, 9791, 9759,
+  9727, 9695, 9663, 9631, 9599, 9567, 9535, 9503, 9471, 9439, 9407, 9375, 9343, 9311, 9279, 9247,
+  9215, 9183, 9151, 9119, 9087, 9055, 9023, 8991, 8959, 8927, 8895, 8863, 8831, 8799, 8767, 8735,
+  8703, 8671, 8639, 8607, 8575, 8543, 8511, 8479, 8447, 8415, 8383, 8351, 8319, 8287, 8255, 8223,
+  8191, 8159, 8127, 8095, 8063, 8031, 7999, 7967, 7935, 7903, 7871, 7839, 7807, 7775, 7743, 7711,
+  7679, 7647, 7615, 7583, 7551, 7519, 7487, 7455, 7423, 7391, 7359, 7327, 7295, 7263, 7231, 7199,
+  7167, 7135, 7103, 7071, 7039, 7007, 6975, 6943, 6911, 6879, 6847, 6815, 6783, 6751, 6719, 6687,
+  6655, 6623, 6591, 6559, 6527, 6495, 6463, 6431, 6399, 6367, 6335, 6303, 6271, 6239, 6207, 6175,
+  6143, 6111, 6079, 6047, 6015, 5983, 5951, 5919, 5887, 5855, 5823, 5791, 5759, 5727, 5695, 5663,
+  5631, 5599, 5567, 5535, 5503, 5471, 5439, 5407, 5375, 5343, 5311, 5279, 5247, 5215, 5183, 5151,
+  5119, 5087, 5055, 5023, 4991, 4959, 4927, 4895, 4863, 4831, 4799, 4767, 4735, 4703, 4671, 4639,
+  4607, 4575, 4543, 4511, 4479, 4447, 4415, 4383, 4351, 4319, 4287, 4255, 4223, 4191, 4159, 4127,
+  4095, 4063, 4031, 3999, 3967, 3935, 3903, 3871, 3839, 3807, 3775, 3743, 3711, 3679, 3647, 3615,
+  3583, 3551, 3519, 3487, 3455, 3423, 3391, 3359, 3327, 3295, 3263, 3231, 3199, 3167, 3135, 3103,
+  3071, 3039, 3007, 2975, 2943, 2911, 2879, 2847, 2815, 2783, 2751, 2719, 2687, 2655, 2623, 2591,
+  2559, 2527, 2495, 2463, 2431, 2399, 2367, 2335, 2303, 2271, 2239, 2207, 2175, 2143, 2111, 2079,
+  2047, 2015, 1983, 1951, 1919, 1887, 1855, 1823, 1791, 1759, 1727, 1695, 1663, 1631, 1599, 1567,
+  1535, 1503, 1471, 1439, 1407, 1375, 1343, 1311, 1279, 1247, 1215, 1183, 1151, 1119, 1087, 1055,
+  1023, 991, 959, 927, 895, 863, 831, 799, 767, 735, 703, 671, 639, 607, 575, 543,
+  511, 479, 447, 415, 383, 351, 319, 287, 255, 223, 191, 159, 127, 95, 63, 32,
+  0, -32, -64, -95, -127, -159, -191, -223, -255, -287, -319, -351, -383, -415, -447, -479,
+  -511, -543, -575, -607, -639, -671, -703, -735, -767, -799, -831, -863, -895, -927, -959, -991,
+  -1023, -1055, -1087, -1119, -1151, -1183, -1215, -1247, -1279, -1311, -1343, -1375, -1407, -1439, -1471, -1503,
+  -1535, -1567, -1599, -1631, -1663, -1695, -1727, -1759, -1791, -1823, -1855, -1887, -1919, -1951, -1983, -2015,
+  -2047, -2079, -2111, -2143, -2175, -2207, -2239, -2271, -2303, -2335, -2367, -2399, -2431, -2463, -2495, -2527,
+  -2559, -2591, -2623, -2655, -2687, -2719, -2751, -2783, -2815, -2847, -2879, -2911, -2943, -2975, -3007, -3039,
+  -3071, -3103, -3135, -3167, -3199, -3231, -3263, -3295, -3327, -3359, -3391, -3423, -3455, -3487, -3519, -3551,
+  -3583, -3615, -3647, -3679, -3711, -3743, -3775, -3807, -3839, -3871, -3903, -3935, -3967, -3999, -4031, -4063,
+  -4095, -4127, -4159, -4191, -4223, -4255, -4287, -4319, -4351, -4383, -4415, -4447, -4479, -4511, -4543, -4575,
+  -4607, -4639, -4671, -4703, -4735, -4767, -4799, -4831, -4863, -4895, -4927, -4959, -4991, -5023, -5055, -5087,
+  -5119, -5151, -5183, -5215, -5247, -5279, -5311, -5343, -5375, -5407, -5439, -5471, -5503, -5535, -5567, -5599,
+  -5631, -5663, -5695, -5727, -5759, -5791, -5823, -5855, -5887, -5919, -5951, -5983, -6015, -6047, -6079, -6111,
+  -6143, -6175, -6207, -6239, -6271, -6303, -6335, -6367, -6399, -6431, -6463, -6495, -6527, -6559, -6591, -6623,
+  -6655, -6687, -6719, -6751, -6783, -6815, -6847, -6879, -6911, -6943, -6975, -7007, -7039, -7071, -7103, -7135,
+  -7167, -7199, -7231, -7263, -7295, -7327, -7359, -7391, -7423, -7455, -7487, -7519, -7551, -7583, -7615, -7647,
+  -7679, -7711, -7743, -7775, -7807, -7839, -7871, -7903, -7935, -7967, -7999, -8031, -8063, -8095, -8127, -8159,
+  -8191, -8223, -8255, -8287, -8319, -8351, -8383, -8415, -8447, -8479, -8511, -8543, -8575, -8607, -8639, -8671,
+  -8703, -8735, -8767, -8799, -8831, -8863, -8895, -8927, -8959, -8991, -9023, -9055, -9087, -9119, -9151, -9183,
+  -9215, -9247, -9279, -9311, -9343, -9375, -9407, -9439, -9471, -9503, -9535, -9567, -9599, -9631, -9663, -9695,
+  -9727, -9759, -9791, -9823, -9855, -9887, -9919, -9951, -9983, -10015, -10047, -10079, -10111, -10143, -10175, -10207,
+  -10239, -10271, -10303, -10335, -10367, -10399, -10431, -10463, -10495, -10527, -10559, -10591, -10623, -10655, -10687, -10719,
+  -10751, -10783, -10815, -10847, -10879, -10911, -10943, -10975, -11007, -11039, -11071, -11103, -11135, -11167, -11199, -11231,
+  -11263, -11295, -11327, -11359, -11391, -11423, -11455, -11487, -11519, -11551, -11583, -11615, -11647, -11679, -11711, -11743,
+  -11775, -11807, -11839, -11871, -11903, -11935, -11967, -11999, -12031, -12063, -12095, -12127, -12159, -12191, -12223, -12255,
+  -12287, -12319, -12351, -12383, -12415, -12447, -12479, -12511, -12543, -12575, -12607, -12639, -12671, -12703, -12735, -12767,
+  -12799, -12831, -12863, -12895, -12927, -12959, -12991, -13023, -13055, -13087, -13119, -13151, -13183, -13215, -13247, -13279,
+  -13311, -13343, -13375, -13407, -13439, -13471, -13503, -13535, -13567, -13599, -13631, -13663, -13695, -13727, -13759, -13791,
+  -13823, -13855, -13887, -13919, -13951, -13983, -14015, -14047, -14079, -14111, -14143, -14175, -14207, -14239, -14271, -14303,
+  -14335, -14367, -14399, -14431, -14463, -14495, -14527, -14559, -14591, -14623, -14655, -14687, -14719, -14751, -14783, -14815,
+  -14847, -14879, -14911, -14943, -14975, -15007, -15039, -15071, -15103, -15135, -15167, -15199, -15231, -15263, -15295, -15327,
+  -15359, -15391, -15423, -15455, -15487, -15519, -15551, -15583, -15615, -15647, -15679, -15711, -15743, -15775, -15807, -15839,
+  -15871, -15903, -15935, -15967, -15999, -16031, -16063, -16095, -16127, -16159, -16191, -16223, -16255, -16287, -16319, -16351,
+  -16383, -16415, -16447, -16479, -16511, -16543, -16575, -16607, -16639, -16671, -16703, -16735, -16767, -16799, -16831, -16863,
+  -16895, -16927, -16959, -16991, -17023, -17055, -17087, -17119, -17151, -17183, -17215, -17247, -17279, -17311, -17343, -17375,
+  -17407, -17439, -17471, -17503, -17535, -17567, -17599, -17631, -17663, -17695, -17727, -17759, -17791, -17823, -17855, -17887,
+  -17919, -17951, -17983, -18015, -18047, -18079, -18111, -18143, -18175, -18207, -18239, -18271, -18303, -18335, -18367, -18399,
+  -18431, -18463, -18495, -18527, -18559, -18591, -18623, -18655, -18687, -18719, -18751, -18783, -18815, -18847, -18879, -18911,
+  -18943, -18975, -19007, -19039, -19071, -19103, -19135, -19167, -19199, -19231, -19263, -19295, -19327, -19359, -19391, -19423,
+  -19455, -19487, -19519, -19551, -19583, -19615, -19647, -19679, -19711, -19743, -19775, -19807, -19839, -19871, -19903, -19935,
+  -19967, -19999, -20031, -20063, -20095, -20127, -20159, -20191, -20223, -20255, -20287, -20319, -20351, -20383, -20415, -20447,
+  -20479, -20511, -20543, -20575, -20607, -20639, -20671, -20703, -20735, -20767, -20799, -20831, -20863, -20895, -20927, -20959,
+  -20991, -21023, -21055, -21087, -21119, -21151, -21183, -21215, -21247, -21279, -21311, -21343, -21375, -21407, -21439, -21471,
+  -21503, -21535, -21567, -21599, -21631, -21663, -21695, -21727, -21759, -21791, -21823, -21855, -21887, -21919, -21951, -21983,
+  -22015, -22047, -22079, -22111, -22143, -22175, -22207, -22239, -22271, -22303, -22335, -22367, -22399, -22431, -22463, -22495,
+  -22527, -22559, -22591, -22623, -22655, -22687, -22719, -22751, -22783, -22815, -22847, -22879, -22911, -22943, -22975, -23007,
+  -23039, -23071, -23103, -23135, -23167, -23199, -23231, -23263, -23295, -23327, -23359, -23391, -23423, -23455, -23487, -23519,
+  -23551, -23583, -23615, -23647, -23679, -23711, -23743, -23775, -23807, -23839, -23871, -23903, -23935, -23967, -23999, -24031,
+  -24063, -24095, -24127, -24159, -24191, -24223, -24255, -24287, -24319, -24351, -24383, -24415, -24447, -24479, -24511, -24543,
+  -24575, -24607, -24639, -24671, -24703, -24735, -24767, -24799, -24831, -24863, -24895, -24927, -24959, -24991, -25023, -25055,
+  -25087, -25119, -25151, -25183, -25215, -25247, -25279, -25311, -25343, -25375, -25407, -25439, -25471, -25503, -25535, -25567,
+  -25599, -25631, -25663, -25695, -25727, -25759, -25791, -25823, -25855, -25887, -25919, -25951, -25983, -26015, -26047, -26079,
+  -26111, -26143, -26175, -26207, -26239, -26271, -26303, -26335, -26367, -26399, -26431, -26463, -26495, -26527, -26559, -26591,
+  -26623, -26655, -26687, -26719, -26751, -26783, -26815, -26847, -26879, -26911, -26943, -26975, -27007, -27039, -27071, -27103,
+  -27135, -27167, -27199, -27231, -27263, -27295, -27327, -27359, -27391, -27423, -27455, -27487, -27519, -27551, -27583, -27615,
+  -27647, -27679, -27711, -27743, -27775, -27807, -27839, -27871, -27903, -27935, -27967, -27999, -28031, -28063, -28095, -28127,
+  -28159, -28191, -28223, -28255, -28287, -28319, -28351, -28383, -28415, -28447, -28479, -28511, -28543, -28575, -28607, -28639,
+  -28671, -28703, -28735, -28767, -28799, -28831, -28863, -28895, -28927, -28959, -28991, -29023, -29055, -29087, -29119, -29151,
+  -29183, -29215, -29247, -29279, -29311, -29343, -29375, -29407, -29439, -29471, -29503, -29535, -29567, -29599, -29631, -29663,
+  -29695, -29727, -29759, -29791, -29823, -29855, -29887, -29919, -29951, -29983, -30015, -30047, -30079, -30111, -30143, -30175,
+  -30207, -30239, -30271, -30303, -30335, -30367, -30399, -30431, -30463, -30495, -30527, -30559, -30591, -30623, -30655, -30687,
+  -30719, -30751, -30783, -30815, -30847, -30879, -30911, -30943, -30975, -31007, -31039, -31071, -31103, -31135, -31167, -31199,
+  -31231, -31263, -31295, -31327, -31359, -31391, -31423, -31455, -31487, -31519, -31551, -31583, -31615, -31647, -31679, -31711,
+  -31743, -31775, -31807, -31839, -31871, -31903, -31935, -31967, -31999, -32031, -32063, -32095, -32127, -32159, -32191, -32223,
+  -32255, -32287, -32319, -32351, -32383, -32415, -32447, -32479, -32511, -32543, -32575, -32607, -32639, -32671, -32703, -32735,
+  -32767, -32735, -32703, -32671, -32639, -32607, -32575, -32543, -32511, -32479, -32447, -32415, -32383, -32351, -32319, -32287,
+  -32255, -32223, -32191, -32159, -32127, -32095, -32063, -32031, -31999, -31967, -31935, -31903, -31871, -31839, -31807, -31775,
+  -31743, -31711, -31679, -31647, -31615, -31583, -31551, -31519, -31487, -31455, -31423, -31391, -31359, -31327, -31295, -31263,
+  -31231, -31199, -31167, -31135, -31103, -31071, -31039, -31007, -30975, -30943, -30911, -30879, -30847, -30815, -30783, -30751,
+  -30719, -30687, -30655, -30623, -30591, -30559, -30527, -30495, -30463, -30431, -30399, -30367, -30335, -30303, -30271, -30239,
+  -30207, -30175, -30143, -30111, -30079, -30047, -30015, -29983, -29951, -29919, -29887, -29855, -29823, -29791, -29759, -29727,
+  -29695, -29663, -29631, -29599, -29567, -29535, -29503, -29471, -29439, -29407, -29375, -29343, -29311, -29279, -29247, -29215,
+  -29183, -29151, -29119, -29087, -29055, -29023, -28991, -28959, -28927, -28895, -28863, -28831, -28799, -28767, -28735, -28703,
+  -28671, -28639, -28607, -28575, -28543, -28511, -28479, -28447, -28415, -28383, -28351, -28319, -28287, -28255, -28223, -28191,
+  -28159, -28127, -28095, -28063, -28031, -27999, -27967, -27935, -27903, -27871, -27839, -27807, -27775, -27743, -27711, -27679,
+  -27647, -27615, -27583, -27551, -27519, -27487, -27455, -27423, -27391, -27359, -27327, -27295, -27263, -27231, -27199, -27167,
+  -27135, -27103, -27071, -27039, -27007, -26975, -26943, -26911, -26879, -26847, -26815, -26783, -26751, -26719, -26687, -26655,
+  -26623, -26591, -26559, -26527, -26495, -26463, -26431, -26399, -26367, -26335, -26303, -26271, -26239, -26207, -26175, -26143,
+  -26111, -26079, -26047, -26015, -25983, -25951, -25919, -25887, -25855, -25823, -25791, -25759, -25727, -25695, -25663, -25631,
+  -25599, -25567, -25535, -25503, -25471, -25439, -25407, -25375, -25343, -25311, -25279, -25247, -25215, -25183, -25151, -25119,
+  -25087, -25055, -25023, -24991, -24959, -24927, -24895, -24863, -24831, -24799, -24767, -24735, -24703, -24671, -24639, -24607,
+  -24575, -24543, -24511, -24479, -24447, -24415, -24383, -24351, -24319, -24287, -24255, -24223, -24191, -24159, -24127, -24095,
+  -24063, -24031, -23999, -23967, -23935, -23903, -23871, -23839, -23807, -23775, -23743, -23711, -23679, -23647, -23615, -23583,
+  -23551, -23519, -23487, -23455, -23423, -23391, -23359, -23327, -23295, -23263, -23231, -23199, -23167, -23135, -23103, -23071,
+  -23039, -23007, -22975, -22943, -22911, -22879, -22847, -22815, -22783, -22751, -22719, -22687, -22655, -22623, -22591, -22559,
+  -22527, -22495, -22463, -22431, -22399, -22367, -22335, -22303, -22271, -22239, -22207, -22175, -22143, -22111, -22079, -22047,
+  -22015, -21983, -21951, -21919, -21887, -21855, -21823, -21791, -21759, -21727, -21695, -21663, -21631, -21599, -21567, -21535,
+  -21503, -21471, -21439, -21407, -21375, -21343, -21311, -21279, -21247, -21215, -21183, -21151, -21119, -21087, -21055, -21023,
+  -20991, -20959, -20927, -20895, -20863, -20831, -20799, -20767, -20735, -20703, -20671, -20639, -20607, -20575, -20543, -20511,
+  -20479, -20447, -20415, -20383, -20351, -20319, -20287, -20255, -20223, -20191, -20159, -20127, -20095, -20063, -20031, -19999,
+  -19967, -19935, -19903, -19871, -19839, -19807, -19775, -19743, -19711, -19679, -19647, -19615, -19583, -19551, -19519, -19487,
+  -19455, -19423, -19391, -19359, -19327, -19295, -19263, -19231, -19199, -19167, -19135, -19103, -19071, -19039, -19007, -18975,
+  -18943, -18911, -18879, -18847, -18815, -18783, -18751, -18719, -18687, -18655, -18623, -18591, -18559, -18527, -18495, -18463,
+  -18431, -18399, -18367, -18335, -18303, -18271, -18239, -18207, -18175, -18143, -18111, -18079, -18047, -18015, -17983, -17951,
+  -17919, -17887, -17855, -17823, -17791, -17759, -17727, -17695, -17663, -17631, -17599, -17567, -17535, -17503, -17471, -17439,
+  -17407, -17375, -17343, -17311, -17279, -17247, -17215, -17183, -17151, -17119, -17087, -17055, -17023, -16991, -16959, -16927,
+  -16895, -16863, -16831, -16799, -16767, -16735, -16703, -16671, -16639, -16607, -16575, -16543, -16511, -16479, -16447, -16415,
+  -16383, -16351, -16319, -16287, -16255, -16223, -16191, -16159, -16127, -16095, -16063, -16031, -15999, -15967, -15935, -15903,
+  -15871, -15839, -15807, -15775, -15743, -15711, -15679, -15647, -15615, -15583, -15551, -15519, -15487, -15455, -15423, -15391,
+  -15359, -15327, -15295, -15263, -15231, -15199, -15167, -15135, -15103, -15071, -15039, -15007, -14975, -14943, -14911, -14879,
+  -14847, -14815, -14783, -14751, -14719, -14687, -14655, -14623, -14591, -14559, -14527, -14495, -14463, -14431, -14399, -14367,
+  -14335, -14303, -14271, -14239, -14207, -14175, -14143, -14111, -14079, -14047, -14015, -13983, -13951, -13919, -13887, -13855,
+  -13823, -13791, -13759, -13727, -13695, -13663, -13631, -13599, -13567, -13535, -13503, -13471, -13439, -13407, -13375, -13343,
+  -13311, -13279, -13247, -13215, -13183, -13151, -13119, -13087, -13055, -13023, -12991, -12959, -12927, -12895, -12863, -12831,
+  -12799, -12767, -12735, -12703, -12671, -12639, -12607, -12575, -12543, -12511, -12479, -12447, -12415, -12383, -12351, -12319,
+  -12287, -12255, -12223, -12191, -12159, -12127, -12095, -12063, -12031, -11999, -11967, -11935, -11903, -11871, -11839, -11807,
+  -11775, -11743, -11711, -11679, -11647, -11615, -11583, -11551, -11519, -11487, -11455, -11423, -11391, -11359, -11327, -11295,
+  -11263, -11231, -11199, -11167, -11135, -11103, -11071, -11039, -11007, -10975, -10943, -10911, -10879, -10847, -10815, -10783,
+  -10751, -10719, -10687, -10655, -10623, -10591, -10559, -10527, -10495, -10463, -10431, -10399, -10367, -10335, -10303, -10271,
+  -10239, -10207, -10175, -10143, -10111, -10079, -10047, -10015, -9983, -9951, -9919, -9887, -9855, -9823, -9791, -9759,
+  -9727, -9695, -9663, -9631, -9599, -9567, -9535, -9503, -9471, -9439, -9407, -9375, -9343, -9311, -9279, -9247,
+  -9215, -9183, -9151, -9119, -9087, -9055, -9023, -8991, -8959, -8927, -8895, -8863, -8831, -8799, -8767, -8735,
+  -8703, -8671, -8639, -8607, -8575, -8543, -8511, -8479, -8447, -8415, -8383, -8351, -8319, -8287, -8255, -8223,
+  -8191, -8159, -8127, -8095, -8063, -8031, -7999, -7967, -7935, -7903, -7871, -7839, -7807, -7775, -7743, -7711,
+  -7679, -7647, -7615, -7583, -7551, -7519, -7487, -7455, -7423, -7391, -7359, -7327, -7295, -7263, -7231, -7199,
+  -7167, -7135, -7103, -7071, -7039, -7007, -6975, -6943, -6911, -6879, -6847, -6815, -6783, -6751, -6719, -6687,
+  -6655, -6623, -6591, -6559, -6527, -6495, -6463, -6431, -6399, -6367, -6335, -6303, -6271, -6239, -6207, -6175,
+  -6143, -6111, -6079, -6047, -6015, -5983, -5951, -5919, -5887, -5855, -5823, -5791, -5759, -5727, -5695, -5663,
+  -5631, -5599, -5567, -5535, -5503, -5471, -5439, -5407, -5375, -5343, -5311, -5279, -5247, -5215, -5183, -5151,
+  -5119, -5087, -5055, -5023, -4991, -4959, -4927, -4895, -4863, -4831, -4799, -4767, -4735, -4703, -4671, -4639,
+  -4607, -4575, -4543, -4511, -4479, -4447, -4415, -4383, -4351, -4319, -4287, -4255, -4223, -4191, -4159, -4127,
+  -4095, -4063, -4031, -3999, -3967, -3935, -3903, -3871, -3839, -3807, -3775, -3743, -3711, -3679, -3647, -3615,
+  -3583, -3551, -3519, -3487, -3455, -3423, -3391, -3359, -3327, -3295, -3263, -3231, -3199, -3167, -3135, -3103,
+  -3071, -3039, -3007, -2975, -2943, -2911, -2879, -2847, -2815, -2783, -2751, -2719, -2687, -2655, -2623, -2591,
+  -2559, -2527, -2495, -2463, -2431, -2399, -2367, -2335, -2303, -2271, -2239, -2207, -2175, -2143, -2111, -2079,
+  -2047, -2015, -1983, -1951, -1919, -1887, -1855, -1823, -1791, -1759, -1727, -1695, -1663, -1631, -1599, -1567,
+  -1535, -1503, -1471, -1439, -1407, -1375, -1343, -1311, -1279, -1247, -1215, -1183, -1151, -1119, -1087, -1055,
+  -1023, -991, -959, -927, -895, -863, -831, -799, -767, -735, -703, -671, -639, -607, -575, -543,
+  -511, -479, -447, -415, -383, -351, -319, -287, -255, -223, -191, -159, -127, -95, -63, -32,
+  0, 32, 64, 95, 127, 159, 191, 223, 255, 287, 319, 351, 383, 415, 447, 479,
+  511, 543, 575, 607, 639, 671, 703, 735, 767, 799, 831, 863, 895, 927, 959, 991,
+  1023, 1055, 1087, 1119, 1151, 1183, 1215, 1247, 1279, 1311, 1343, 1375, 1407, 1439, 1471, 1503,
+  1535, 1567, 1599, 1631, 1663, 1695, 1727, 1759, 1791, 1823, 1855, 1887, 1919, 1951, 1983, 2015,
+  2047, 2079, 2111, 2143, 2175, 2207, 2239, 2271, 2303, 2335, 2367, 2399, 2431, 2463, 2495, 2527,
+  2559, 2591, 2623, 2655, 2687, 2719, 2751, 2783, 2815, 2847, 2879, 2911, 2943, 2975, 3007, 3039,
+  3071, 3103, 3135, 3167, 3199, 3231, 3263, 3295, 3327, 3359, 3391, 3423, 3455, 3487, 3519, 3551,
+  3583, 3615, 3647, 3679, 3711, 3743, 3775, 3807, 3839, 3871, 3903, 3935, 3967, 3999, 4031, 4063,
+  4095, 4127, 4159, 4191, 4223, 4255, 4287, 4319, 4351, 4383, 4415, 4447, 4479, 4511, 4543, 4575,
+  4607, 4639, 4671, 4703, 4735, 4767, 4799, 4831, 4863, 4895, 4927, 4959, 4991, 5023, 5055, 5087,
+  5119, 5151, 5183, 5215, 5247, 5279, 5311, 5343, 5375, 5407, 5439, 5471, 5503, 5535, 5567, 5599,
+  5631, 5663, 5695, 5727, 5759, 5791, 5823, 5855, 5887, 5919, 5951, 5983, 6015, 6047, 6079, 6111,
+  6143, 6175, 6207, 6239, 6271, 6303, 6335, 6367, 6399, 6431, 6463, 6495, 6527, 6559, 6591, 6623,
+  6655, 6687, 6719, 6751, 6783, 6815, 6847, 6879, 6911, 6943, 6975, 7007, 7039, 7071, 7103, 7135,
+  7167, 7199, 7231, 7263, 7295, 7327, 7359, 7391, 7423, 7455, 7487, 7519, 7551, 7583, 7615, 7647,
+  7679, 7711, 7743, 7775, 7807, 7839, 7871, 7903, 7935, 7967, 7999, 8031, 8063, 8095, 8127, 8159,
+  8191, 8223, 8255, 8287, 8319, 8351, 8383, 8415, 8447, 8479, 8511, 8543, 8575, 8607, 8639, 8671,
+  8703, 8735, 8767, 8799, 8831, 8863, 8895, 8927, 8959, 8991, 9023, 9055, 9087, 9119, 9151, 9183,
+  9215, 9247, 9279, 9311, 9343, 9375, 9407, 9439, 9471, 9503, 9535, 9567, 9599, 9631, 9663, 9695,
+  9727, 9759, 9791, 9823, 9855, 9887, 9919, 9951, 9983, 10015, 10047, 10079, 10111, 10143, 10175, 10207,
+  10239, 10271, 10303, 10335, 10367, 10399, 10431, 10463, 10495, 10527, 10559, 10591, 10623, 10655, 10687, 10719,
+  10751, 10783, 10815, 10847, 10879, 10911, 10943, 10975, 11007, 11039, 11071, 11103, 11135, 11167, 11199, 11231,
+  11263, 11295, 11327, 11359, 11391, 11423, 11455, 11487, 11519, 11551, 11583, 11615, 11647, 11679, 11711, 11743,
+  11775, 11807, 11839, 11871, 11903, 11935, 11967, 11999, 12031, 12063, 12095, 12127, 12159, 12191, 12223, 12255,
+  12287, 12319, 12351, 12383, 12415, 12447, 12479, 12511, 12543, 12575, 12607, 12639, 12671, 12703, 12735, 12767,
+  12799, 12831, 12863, 12895, 12927, 12959, 12991, 13023, 13055, 13087, 13119, 13151, 13183, 13215, 13247, 13279,
+  13311, 13343, 13375, 13407, 13439, 13471, 13503, 13535, 13567, 13599, 13631, 13663, 13695, 13727, 13759, 13791,
+  13823, 13855, 13887, 13919, 13951, 13983, 14015, 14047, 14079, 14111, 14143, 14175, 14207, 14239, 14271, 14303,
+  14335, 14367, 14399, 14431, 14463, 14495, 14527, 14559, 14591, 14623, 14655, 14687, 14719, 14751, 14783, 14815,
+  14847, 14879, 14911, 14943, 14975, 15007, 15039, 15071, 15103, 15135, 15167, 15199, 15231, 15263, 15295, 15327,
+  15359, 15391, 15423, 15455, 15487, 15519, 15551, 15583, 15615, 15647, 15679, 15711, 15743, 15775, 15807, 15839,
+  15871, 15903, 15935, 15967, 15999, 16031, 16063, 16095, 16127, 16159, 16191, 16223, 16255, 16287, 16319, 16351,
+  16383, 16415, 16447, 16479, 16511, 16543, 16575, 16607, 16639, 16671, 16703, 16735, 16767, 16799, 16831, 16863,
+  16895, 16927, 16959, 16991, 17023, 17055, 17087, 17119, 17151, 17183, 17215, 17247, 17279, 17311, 17343, 17375,
+  17407, 17439, 17471, 17503, 17535, 17567, 17599, 17631, 17663, 17695, 17727, 17759, 17791, 17823, 17855, 17887,
+  17919, 17951, 17983, 18015, 18047, 18079, 18111, 18143, 18175, 18207, 18239, 18271, 18303, 18335, 18367, 18399,
+  18431, 18463, 18495, 18527, 18559, 18591, 18623, 18655, 18687, 18719, 18751, 18783, 18815, 18847, 18879, 18911,
+  18943, 18975, 19007, 19039, 19071, 19103, 19135, 19167, 19199, 19231, 19263, 19295, 19327, 19359, 19391, 19423,
+  19455, 19487, 19519, 19551, 19583, 19615, 19647, 19679, 19711, 19743, 19775, 19807, 19839, 19871, 19903, 19935,
+  19967, 19999, 20031, 20063, 20095, 20127, 20159, 20191, 20223, 20255, 20287, 20319, 20351, 20383, 20415, 20447,
+  20479, 20511, 20543, 20575, 20607, 20639, 20671, 20703, 20735, 20767, 20799, 20831, 20863, 20895, 20927, 20959,
+  20991, 21023, 21055, 21087, 21119, 21151, 21183, 21215, 21247, 21279, 21311, 21343, 21375, 21407, 21439, 21471,
+  21503, 21535, 21567, 21599, 21631, 21663, 21695, 21727, 21759, 21791, 21823, 21855, 21887, 21919, 21951, 21983,
+  22015, 22047, 22079, 22111, 22143, 22175, 22207, 22239, 22271, 22303, 22335, 22367, 22399, 22431, 22463, 22495,
+  22527, 22559, 22591, 22623, 22655, 22687, 22719, 22751, 22783, 22815, 22847, 22879, 22911, 22943, 22975, 23007,
+  23039, 23071, 23103, 23135, 23167, 23199, 23231, 23263, 23295, 23327, 23359, 23391, 23423, 23455, 23487, 23519,
+  23551, 23583, 23615, 23647, 23679, 23711, 23743, 23775, 23807, 23839, 23871, 23903, 23935, 23967, 23999, 24031,
+  24063, 24095, 24127, 24159, 24191, 24223, 24255, 24287, 24319, 24351, 24383, 24415, 24447, 24479, 24511, 24543,
+  24575, 24607, 24639, 24671, 24703, 24735, 24767, 24799, 24831, 24863, 24895, 24927, 24959, 24991, 25023, 25055,
+  25087, 25119, 25151, 25183, 25215, 25247, 25279, 25311, 25343, 25375, 25407, 25439, 25471, 25503, 25535, 25567,
+  25599, 25631, 25663, 25695, 25727, 25759, 25791, 25823, 25855, 25887, 25919, 25951, 25983, 26015, 26047, 26079,
+  26111, 26143, 26175, 26207, 26239, 26271, 26303, 26335, 26367, 26399, 26431, 26463, 26495, 26527, 26559, 26591,
+  26623, 26655, 26687, 26719, 26751, 26783, 26815, 26847, 26879, 26911, 26943, 26975, 27007, 27039, 27071, 27103,
+  27135, 27167, 27199, 27231, 27263, 27295, 27327, 27359, 27391, 27423, 27455, 27487, 27519, 27551, 27583, 27615,
+  27647, 27679, 27711, 27743, 27775, 27807, 27839, 27871, 27903, 27935, 27967, 27999, 28031, 28063, 28095, 28127,
+  28159, 28191, 28223, 28255, 28287, 28319, 28351, 28383, 28415, 28447, 28479, 28511, 28543, 28575, 28607, 28639,
+  28671, 28703, 28735, 28767, 28799, 28831, 28863, 28895, 28927, 28959, 28991, 29023, 29055, 29087, 29119, 29151,
+  29183, 29215, 29247, 29279, 29311, 29343, 29375, 29407, 29439, 29471, 29503, 29535, 29567, 29599, 29631, 29663,
+  29695, 29727, 29759, 29791, 29823, 29855, 29887, 29919, 29951, 29983, 30015, 30047, 30079, 30111, 30143, 30175,
+  30207, 30239, 30271, 30303, 30335, 30367, 30399, 30431, 30463, 30495, 30527, 30559, 30591, 30623, 30655, 30687,
+  30719, 30751, 30783, 30815, 30847, 30879, 30911, 30943, 30975, 31007, 31039, 31071, 31103, 31135, 31167, 31199,
+  31231, 31263, 31295, 31327, 31359, 31391, 31423, 31455, 31487, 31519, 31551, 31583, 31615, 31647, 31679, 31711,
+  31743, 31775, 31807, 31839, 31871, 31903, 31935, 31967, 31999, 32031, 32063, 32095, 32127, 32159, 32191, 32223,
+  32255, 32287, 32319, 32351, 32383, 32415, 32447, 32479, 32511, 32543, 32575, 32607, 32639, 32671, 32703, 32735
+};
+
+const int16_t oscFlashSaw[4096] = {
+  32767, 32751, 32735, 32719, 32703, 32687, 32671, 32655, 32639, 32623, 32607, 32591, 32575, 32559, 32543, 32527,
+  32511, 32495, 32479, 32463, 32447, 32431, 32415, 32399, 32383, 32367, 32351, 32335, 32319, 32303, 32287, 32271,
+  32255, 32239, 32223, 32207, 32191, 32175, 32159, 32143, 32127, 32111, 32095, 32079, 32063, 32047, 32031, 32015,
+  31999, 31983, 31967, 31951, 31935, 31919, 31903, 31887, 31871, 31855, 31839, 31823, 31807, 31791, 31775, 31759,
+  31743, 31727, 31711, 31695, 31679, 31663, 31647, 31631, 31615, 31599, 31583, 31567, 31551, 31535, 31519, 31503,
+  31487, 31471, 31455, 31439, 31423, 31407, 31391, 31375, 31359, 31343, 31327, 31311, 31295, 31279, 31263, 31247,
+  31231, 31215, 31199, 31183, 31167, 31151, 31135, 31119, 31103, 31087, 31071, 31055, 31039, 31023, 31007, 30991,
+  30975, 30959, 30943, 30927, 30911, 30895, 30879, 30863, 30847, 30831, 30815, 30799, 30783, 30767, 30751, 30735,
+  30719, 30703, 30687, 30671, 30655, 30639, 30623, 30607, 30591, 30575, 30559, 30543, 30527, 30511, 30495, 30479,
+  30463, 30447, 30431, 30415, 30399, 30383, 30367, 30351, 30335, 30319, 30303, 30287, 30271, 30255, 30239, 30223,
+  30207, 30191, 30175, 30159, 30143, 30127, 30111, 30095, 30079, 30063, 30047, 30031, 30015, 29999, 29983, 29967,
+  29951, 29935, 29919, 29903, 29887, 29871, 29855, 29839, 29823, 29807, 29791, 29775, 29759, 29743, 29727, 29711,
+  29695, 29679, 29663, 29647, 29631, 29615, 29599, 29583, 29567, 29551, 29535, 29519, 29503, 29487, 29471, 29455,
+  29439, 29423, 29407, 29391, 29375, 29359, 29343, 29327, 29311, 29295, 29279, 29263, 29247, 29231, 29215, 29199,
+  29183, 29167, 29151, 29135, 29119, 29103, 29087, 29071, 29055, 29039, 29023, 29007, 28991, 28975, 28959, 28943,
+  28927, 28911, 28895, 28879, 28863, 28847, 28831, 28815, 28799, 28783, 28767, 28751, 28735, 28719, 28703, 28687,
+  28671, 28655, 28639, 28623, 28607, 28591, 28575, 28559, 28543, 28527, 28511, 28495, 28479, 28463, 28447, 28431,
+  28415, 28399, 28383, 28367, 28351, 28335, 28319, 28303, 28287, 28271, 28255, 28239, 28223, 28207, 28191, 28175,
+  28159, 28143, 28127, 28111, 28095, 28079, 28063, 28047, 28031, 28015, 27999, 27983, 27967, 27951, 27935, 27919,
+  27903, 27887, 27871, 27855, 27839, 27823, 27807, 27791, 27775, 27759, 27743, 27727, 27711, 27695, 27679, 27663,
+  27647, 27631, 27615, 27599, 27583, 27567, 27551, 27535, 27519, 27503, 27487, 27471, 27455, 27439, 27423, 27407,
+  27391, 27375, 27359, 27343, 27327, 27311, 27295, 27279, 27263, 27247, 27231, 27215, 27199, 27183, 27167, 27151,
+  27135, 27119, 27103, 27087, 27071, 27055, 27039, 27023, 27007, 26991, 26975, 26959, 26943, 26927, 26911, 26895,
+  26879, 26863, 26847, 26831, 26815, 26799, 26783, 26767, 26751, 26735, 26719, 26703, 26687, 26671, 26655, 26639,
+  26623, 26607, 26591, 26575, 26559, 26543, 26527, 26511, 26495, 26479, 26463, 26447, 26431, 26415, 26399, 26383,
+  26367, 26351, 26335, 26319, 26303, 26287, 26271, 26255, 26239, 26223, 26207, 26191, 26175, 26159, 26143, 26127,
+  26111, 26095, 26079, 26063, 26047, 26031, 26015, 25999, 25983, 25967, 25951, 25935, 25919, 25903, 25887, 25871,
+  25855, 25839, 25823, 25807, 25791, 25775, 25759, 25743, 25727, 25711, 25695, 25679, 25663, 25647, 25631, 25615,
+  25599, 25583, 25567, 25551, 25535, 25519, 25503, 25487, 25471, 25455, 25439, 25423, 25407, 25391, 25375, 25359,
+  25343, 25327, 25311, 25295, 25279, 25263, 25247, 25231, 25215, 25199, 25183, 25167, 25151, 25135, 25119, 25103,
+  25087, 25071, 25055, 25039, 25023, 25007, 24991, 24975, 24959, 24943, 24927, 24911, 24895, 24879, 24863, 24847,
+  24831, 24815, 24799, 24783, 24767, 24751, 24735, 24719, 24703, 24687, 24671, 24655, 24639, 24623, 24607, 24591,
+  24575, 24559, 24543, 24527, 24511, 24495, 24479, 24463, 24447, 24431, 24415, 24399, 24383, 24367, 24351, 24335,
+  24319, 24303, 24287, 24271, 24255, 24239, 24223, 24207, 24191, 24175, 24159, 24143, 24127, 24111, 24095, 24079,
+  24063, 24047, 24031, 24015, 23999, 23983, 23967, 23951, 23935, 23919, 23903, 23887, 23871, 23855, 23839, 23823,
+  23807, 23791, 23775, 23759, 23743, 23727, 23711, 23695, 23679, 23663, 23647, 23631, 23615, 23599, 23583, 23567,
+  23551, 23535, 23519, 23503, 23487, 23471, 23455, 23439, 23423, 23407, 23391, 23375, 23359, 23343, 23327, 23311,
+  23295, 23279, 23263, 23247, 23231, 23215, 23199, 23183, 23167, 23151, 23135, 23119, 23103, 23087, 23071, 23055,
+  23039, 23023, 23007, 22991, 22975, 22959, 22943, 22927, 22911, 22895, 22879, 22863, 22847, 22831, 22815, 22799,
+  22783, 22767, 22751, 22735, 22719, 22703, 22687, 22671, 22655, 22639, 22623, 22607, 22591, 22575, 22559, 22543,
+  22527, 22511, 22495, 22479, 22463, 22447, 22431, 22415, 22399, 22383, 22367, 22351, 22335, 22319, 22303, 22287,
+  22271, 22255, 22239, 22223, 22207, 22191, 22175, 22159, 22143, 22127, 22111, 22095, 22079, 22063, 22047, 22031,
+  22015, 21999, 21983, 21967, 21951, 21935, 21919, 21903, 21887, 21871, 21855, 21839, 21823, 21807, 21791, 21775,
+  21759, 21743, 21727, 21711, 21695, 21679, 21663, 21647, 21631, 21615, 21599, 21583, 21567, 21551, 21535, 21519,
+  21503, 21487, 21471, 21455, 21439, 21423, 21407, 21391, 21375, 21359, 21343, 21327, 21311, 21295, 21279, 21263,
+  21247, 21231, 21215, 21199, 21183, 21167, 21151, 21135, 21119, 21103, 21087, 21071, 21055, 21039, 21023, 21007,
+  20991, 20975, 20959, 20943, 20927, 20911, 20895, 20879, 20863, 20847, 20831, 20815, 20799, 20783, 20767, 20751,
+  20735, 20719, 20703, 20687, 20671, 20655, 20639, 20623, 20607, 20591, 20575, 20559, 20543, 20527, 20511, 20495,
+  20479, 20463, 20447, 20431, 20415, 20399, 20383, 20367, 20351, 20335, 20319, 20303, 20287, 20271, 20255, 20239,
+  20223, 20207, 20191, 20175, 20159, 20143, 20127, 20111, 20095, 20079, 20063, 20047, 20031, 20015, 19999, 19983,
+  19967, 19951, 19935, 19919, 19903, 19887, 19871, 19855, 19839, 19823, 19807, 19791, 19775, 19759, 19743, 19727,
+  19711, 19695, 19679, 19663, 19647, 19631, 19615, 19599, 19583, 19567, 19551, 19535, 19519, 19503, 19487, 19471,
+  19455, 19439, 19423, 19407, 19391, 19375, 19359, 19343, 19327, 19311, 19295, 19279, 19263, 19247, 19231, 19215,
+  19199, 19183, 19167, 19151, 19135, 19119, 19103, 19087, 19071, 19055, 19039, 19023, 19007, 18991, 18975, 18959,
+  18943, 18927, 18911, 18895, 18879, 18863, 18847, 18831, 18815, 18799, 18783, 18767, 18751, 18735, 18719, 18703,
+  18687, 18671, 18655, 18639, 18623, 18607, 18591, 18575, 18559, 18543, 18527, 18511, 18495, 18479, 18463, 18447,
+  18431, 18415, 18399, 18383, 18367, 18351, 18335, 18319, 18303, 18287, 18271, 18255, 18239, 18223, 18207, 18191,
+  18175, 18159, 18143, 18127, 18111, 18095, 18079, 18063, 18047, 18031, 18015, 17999, 17983, 17967, 17951, 17935,
+  17919, 17903, 17887, 17871, 17855, 17839, 17823, 17807, 17791, 17775, 17759, 17743, 17727, 17711, 17695, 17679,
+  17663, 17647, 17631, 17615, 17599, 17583, 17567, 17551, 17535, 17519, 17503, 17487, 17471, 17455, 17439, 17423,
+  17407, 17391, 17375, 17359, 17343, 17327, 17311, 17295, 17279, 17263, 17247, 17231, 17215, 17199, 17183, 17167,
+  17151, 17135, 17119, 17103, 17087, 17071, 17055, 17039, 17023, 17007, 16991, 16975, 16959, 16943, 16927, 16911,
+  16895, 16879, 16863, 16847, 16831, 16815, 16799, 16783, 16767, 16751, 16735, 16719, 16703, 16687, 16671, 16655,
+  16639, 16623, 16607, 16591, 16575, 16559, 16543, 16527, 16511, 16495, 16479, 16463, 16447, 16431, 16415, 16399,
+  16383, 16367, 16351, 16335, 16319, 16303, 16287, 16271, 16255, 16239, 16223, 16207, 16191, 16175, 16159, 16143,
+  16127, 16111, 16095, 16079, 16063, 16047, 16031, 16015, 15999, 15983, 15967, 15951, 15935, 15919, 15903, 15887,
+  15871, 15855, 15839, 15823, 15807, 15791, 15775, 15759, 15743, 15727, 15711, 15695, 15679, 15663, 15647, 15631,
+  15615, 15599, 15583, 15567, 15551, 15535, 15519, 15503, 15487, 15471, 15455, 15439, 15423, 15407, 15391, 15375,
+  15359, 15343, 15327, 15311, 15295, 15279, 15263, 15247, 15231, 15215, 15199, 15183, 15167, 15151, 15135, 15119,
+  15103, 15087, 15071, 15055, 15039, 15023, 15007, 14991, 14975, 14959, 14943, 14927, 14911, 14895, 14879, 14863,
+  14847, 14831, 14815, 14799, 14783, 14767, 14751, 14735, 14719, 14703, 14687, 14671, 14655, 14639, 14623, 14607,
+  14591, 14575, 14559, 14543, 14527, 14511, 14495, 14479, 14463, 14447, 14431, 14415, 14399, 14383, 14367, 14351,
+  14335, 14319, 14303, 14287, 14271, 14255, 14239, 14223, 14207, 14191, 14175, 14159, 14143, 14127, 14111, 14095,
+  14079, 14063, 14047, 14031, 14015, 13999, 13983, 13967, 13951, 13935, 13919, 13903, 13887, 13871, 13855, 13839,
+  13823, 13807, 13791, 13775, 13759, 13743, 13727, 13711, 13695, 13679, 13663, 13647, 13631, 13615, 13599, 13583,
+  13567, 13551, 13535, 13519, 13503, 13487, 13471, 13455, 13439, 13423, 13407, 13391, 13375, 13359, 13343, 13327,
+  13311, 13295, 13279, 13263, 13247, 13231, 13215, 13199, 13183, 13167, 13151, 13135, 13119, 13103, 13087, 13071,
+  13055, 13039, 13023, 13007, 12991, 12975, 12959, 12943, 12927, 12911, 12895, 12879, 12863, 12847, 12831, 12815,
+  12799, 12783, 12767, 12751, 12735, 12719, 12703, 12687, 12671, 12655, 12639, 12623, 12607, 12591, 12575, 12559,
+  12543, 12527, 12511, 12495, 12479, 12463, 12447, 12431, 12415, 12399, 12383, 12367, 12351, 12335, 12319, 12303,
+  12287, 12271, 12255, 12239, 12223, 12207, 12191, 12175, 12159, 12143, 12127, 12111, 12095, 12079, 12063, 12047,
+  12031, 12015, 11999, 11983, 11967, 11951, 11935, 11919, 11903, 11887, 11871, 11855, 11839, 11823, 11807, 11791,
+  11775, 11759, 11743, 11727, 11711, 11695, 11679, 11663, 11647, 11631, 11615, 11599, 11583, 11567, 11551, 11535,
+  11519, 11503, 11487, 11471, 11455, 11439, 11423, 11407, 11391, 11375, 11359, 11343, 11327, 11311, 11295, 11279,
+  11263, 11247, 11231, 11215, 11199, 11183, 11167, 11151, 11135, 11119, 11103, 11087, 11071, 11055, 11039, 11023,
+  11007, 10991, 10975, 10959, 10943, 10927, 10911, 10895, 10879, 10863, 10847, 10831, 10815, 10799, 10783, 10767,
+  10751, 10735, 10719, 10703, 10687, 10671, 10655, 10639, 10623, 10607, 10591, 10575, 10559, 10543, 10527, 10511,
+  10495, 10479, 10463, 10447, 10431, 10415, 10399, 10383, 10367, 10351, 10335, 10319, 10303, 10287, 10271, 10255,
+  10239, 10223, 10207, 10191, 10175, 10159, 10143, 10127, 10111, 10095, 10079, 10063, 10047, 10031, 10015, 9999,
+  9983, 9967, 9951, 9935, 9919, 9903, 9887, 9871, 9855, 9839, 9823, 9807, 9791, 9775, 9759, 9743,
+  9727, 9711, 9695, 9679, 9663, 9647, 9631, 9615, 9599, 9583, 9567, 9551, 9535, 9519, 9503, 9487,
+  9471, 9455, 9439, 9423, 9407, 9391, 9375, 9359, 9343, 9327, 9311, 9295, 9279, 9263, 9247, 9231,
+  9215, 9199, 9183, 9167, 9151, 9135, 9119, 9103, 9087, 9071, 9055, 9039, 9023, 9007, 8991, 8975,
+  8959, 8943, 8927, 8911, 8895, 8879, 8863, 8847, 8831, 8815, 8799, 8783, 8767, 8751, 8735, 8719,
+  8703, 8687, 8671, 8655, 8639, 8623, 8607, 8591, 8575, 8559, 8543, 8527, 8511, 8495, 8479, 8463,
+  8447, 8431, 8415, 8399, 8383, 8367, 8351, 8335, 8319, 8303, 8287, 8271, 8255, 8239, 8223, 8207,
+  8191, 8175, 8159, 8143, 8127, 8111, 8095, 8079, 8063, 8047, 8031, 8015, 7999, 7983, 7967, 7951,
+  7935, 7919, 7903, 7887, 7871, 7855, 7839, 7823, 7807, 7791, 7775, 7759, 7743, 7727, 7711, 7695,
+  7679, 7663, 7647, 7631, 7615, 7599, 7583, 7567, 7551, 7535, 7519, 7503, 7487, 7471, 7455, 7439,
+  7423, 7407, 7391, 7375, 7359, 7343, 7327, 7311, 7295, 7279, 7263, 7247, 7231, 7215, 7199, 7183,
+  7167, 7151, 7135, 7119, 7103, 7087, 7071, 7055, 7039, 7023, 7007, 6991, 6975, 6959, 6943, 6927,
+  6911, 6895, 6879, 6863, 6847, 6831, 6815, 6799, 6783, 6767, 6751, 6735, 6719, 6703, 6687, 6671,
+  6655, 6639, 6623, 6607, 6591, 6575, 6559, 6543, 6527, 6511, 6495, 6479, 6463, 6447, 6431, 6415,
+  6399, 6383, 6367, 6351, 6335, 6319, 6303, 6287, 6271, 6255, 6239, 6223, 6207, 6191, 6175, 6159,
+  6143, 6127, 6111, 6095, 6079, 6063, 6047, 6031, 6015, 5999, 5983, 5967, 5951, 5935, 5919, 5903,
+  5887, 5871, 5855, 5839, 5823, 5807, 5791, 5775, 5759, 5743, 5727, 5711, 5695, 5679, 5663, 5647,
+  5631, 5615, 5599, 5583, 5567, 5551, 5535, 5519, 5503, 5487, 5471, 5455, 5439, 5423, 5407, 5391,
+  5375, 5359, 5343, 5327, 5311, 5295, 5279, 5263, 5247, 5231, 5215, 5199, 5183, 5167, 5151, 5135,
+  5119, 5103, 5087, 5071, 5055, 5039, 5023, 5007, 4991, 4975, 4959, 4943, 4927, 4911, 4895, 4879,
+  4863, 4847, 4831, 4815, 4799, 4783, 4767, 4751, 4735, 4719, 4703, 4687, 4671, 4655, 4639, 4623,
+  4607, 4591, 4575, 4559, 4543, 4527, 4511, 4495, 4479, 4463, 4447, 4431, 4415, 4399, 4383, 4367,
+  4351, 4335, 4319, 4303, 4287, 4271, 4255, 4239, 4223, 4207, 4191, 4175, 4159, 4143, 4127, 4111,
+  4095, 4079, 4063, 4047, 4031, 4015, 3999, 3983, 3967, 3951, 3935, 3919, 3903, 3887, 3871, 3855,
+  3839, 3823, 3807, 3791, 3775, 3759, 3743, 3727, 3711, 3695, 3679, 3663, 3647, 3631, 3615, 3599,
+  3583, 3567, 3551, 3535, 3519, 3503, 3487, 3471, 3455, 3439, 3423, 3407, 3391, 3375, 3359, 3343,
+  3327, 3311, 3295, 3279, 3263, 3247, 3231, 3215, 3199, 3183, 3167, 3151, 3135, 3119, 3103, 3087,
+  3071, 3055, 3039, 3023, 3007, 2991, 2975, 2959, 2943, 2927, 2911, 2895, 2879, 2863, 2847, 2831,
+  2815, 2799, 2783, 2767, 2751, 2735, 2719, 2703, 2687, 2671, 2655, 2639, 2623, 2607, 2591, 2575,
+  2559, 2543, 2527, 2511, 2495, 2479, 2463, 2447, 2431, 2415, 2399, 2383, 2367, 2351, 2335, 2319,
+  2303, 2287, 2271, 2255, 2239, 2223, 2207, 2191, 2175, 2159, 2143, 2127, 2111, 2095, 2079, 2063,
+  2047, 2031, 2015, 1999, 1983, 1967, 1951, 1935, 1919, 1903, 1887, 1871, 1855, 1839, 1823, 1807,
+  1791, 1775, 1759, 1743, 1727, 1711, 1695, 1679, 1663, 1647, 1631, 1615, 1599, 1583, 1567, 1551,
+  1535, 1519, 1503, 1487, 1471, 1455, 1439, 1423, 1407, 1391, 1375, 1359, 1343, 1327, 1311, 1295,
+  1279, 1263, 1247, 1231, 1215, 1199, 1183, 1167, 1151, 1135, 1119, 1103, 1087, 1071, 1055, 1039,
+  1023, 1007, 991, 975, 959, 943, 927, 911, 895, 879, 863, 847, 831, 815, 799, 783,
+  767, 751, 735, 719, 703, 687, 671, 655, 639, 623, 607, 591, 575, 559, 543, 527,
+  511, 495, 479, 463, 447, 431, 415, 399, 383, 367, 351, 335, 319, 303, 287, 271,
+  255, 239, 223, 207, 191, 175, 159, 143, 127, 111, 95, 79, 63, 47, 32, 16,
+  0, -16, -32, -48, -64, -79, -95, -111, -127, -143, -159, -175, -191, -207, -223, -239,
+  -255, -271, -287, -303, -319, -335, -351, -367, -383, -399, -415, -431, -447, -463, -479, -495,
+  -511, -527, -543, -559, -575, -591, -607, -623, -639, -655, -671, -687, -703, -719, -735, -751,
+  -767, -783, -799, -815, -831, -847, -863, -879, -895, -911, -927, -943, -959, -975, -991, -1007,
+  -1023, -1039, -1055, -1071, -1087, -1103, -1119, -1135, -1151, -1167, -1183, -1199, -1215, -1231, -1247, -1263,
+  -1279, -1295, -1311, -1327, -1343, -1359, -1375, -1391, -1407, -1423, -1439, -1455, -1471, -1487, -1503, -1519,
+  -1535, -1551, -1567, -1583, -1599, -1615, -1631, -1647, -1663, -1679, -1695, -1711, -1727, -1743, -1759, -1775,
+  -1791, -1807, -1823, -1839, -1855, -1871, -1887, -1903, -1919, -1935, -1951, -1967, -1983, -1999, -2015, -2031,
+  -2047, -2063, -2079, -2095, -2111, -2127, -2143, -2159, -2175, -2191, -2207, -2223, -2239, -2255, -2271, -2287,
+  -2303, -2319, -2335, -2351, -2367, -2383, -2399, -2415, -2431, -2447, -2463, -2479, -2495, -2511, -2527, -2543,
+  -2559, -2575, -2591, -2607, -2623, -2639, -2655, -2671, -2687, -2703, -2719, -2735, -2751, -2767, -2783, -2799,
+  -2815, -2831, -2847, -2863, -2879, -2895, -2911, -2927, -2943, -2959, -2975, -2991, -3007, -3023, -3039, -3055,
+  -3071, -3087, -3103, -3119, -3135, -3151, -3167, -3183, -3199, -3215, -3231, -3247, -3263, -3279, -3295, -3311,
+  -3327, -3343, -3359, -3375, -3391, -3407, -3423, -3439, -3455, -3471, -3487, -3503, -3519, -3535, -3551, -3567,
+  -3583, -3599, -3615, -3631, -3647, -3663, -3679, -3695, -3711, -3727, -3743, -3759, -3775, -3791, -3807, -3823,
+  -3839, -3855, -3871, -3887, -3903, -3919, -3935, -3951, -3967, -3983, -3999, -4015, -4031, -4047, -4063, -4079,
+  -4095, -4111, -4127, -4143, -4159, -4175, -4191, -4207, -4223, -4239, -4255, -4271, -4287, -4303, -4319, -4335,
+  -4351, -4367, -4383, -4399, -4415, -4431, -4447, -4463, -4479, -4495, -4511, -4527, -4543, -4559, -4575, -4591,
+  -4607, -4623, -4639, -4655, -4671, -4687, -4703, -4719, -4735, -4751, -4767, -4783, -4799, -4815, -4831, -4847,
+  -4863, -4879, -4895, -4911, -4927, -4943, -4959, -4975, -4991, -5007, -5023, -5039, -5055, -5071, -5087, -5103,
+  -5119, -5135, -5151, -5167, -5183, -5199, -5215, -5231, -5247, -5263, -5279, -5295, -5311, -5327, -5343, -5359,
+  -5375, -5391, -5407, -5423, -5439, -5455, -5471, -5487, -5503, -5519, -5535, -5551, -5567, -5583, -5599, -5615,
+  -5631, -5647, -5663, -5679, -5695, -5711, -5727, -5743, -5759, -5775, -5791, -5807, -5823, -5839, -5855, -5871,
+  -5887, -5903, -5919, -5935, -5951, -5967, -5983, -5999, -6015, -6031, -6047, -6063, -6079, -6095, -6111, -6127,
+  -6143, -6159, -6175, -6191, -6207, -6223, -6239, -6255, -6271, -6287, -6303, -6319, -6335, -6351, -6367, -6383,
+  -6399, -6415, -6431, -6447, -6463, -6479, -6495, -6511, -6527, -6543, -6559, -6575, -6591, -6607, -6623, -6639,
+  -6655, -6671, -6687, -6703, -6719, -6735, -6751, -6767, -6783, -6799, -6815, -6831, -6847, -6863, -6879, -6895,
+  -6911, -6927, -6943, -6959, -6975, -6991, -7007, -7023, -7039, -7055, -7071, -7087, -7103, -7119, -7135, -7151,
+  -7167, -7183, -7199, -7215, -7231, -7247, -7263, -7279, -7295, -7311, -7327, -7343, -7359, -7375, -7391, -7407,
+  -7423, -7439, -7455, -7471, -7487, -7503, -7519, -7535, -7551, -7567, -7583, -7599, -7615, -7631, -7647, -7663,
+  -7679, -7695, -7711, -7727, -7743, -7759, -7775, -7791, -7807, -7823, -7839, -7855, -7871, -7887, -7903, -7919,
+  -7935, -7951, -7967, -7983, -7999, -8015, -8031, -8047, -8063, -8079, -8095, -8111, -8127, -8143, -8159, -8175,
+  -8191, -8207, -8223, -8239, -8255, -8271, -8287, -8303, -8319, -8335, -8351, -8367, -8383, -8399, -8415, -8431,
+  -8447, -8463, -8479, -8495, -8511, -8527, -8543, -8559, -8575, -8591, -8607, -8623, -8639, -8655, -8671, -8687,
+  -8703, -8719, -8735, -8751, -8767, -8783, -8799, -8815, -8831, -8847, -8863, -8879, -8895, -8911, -8927, -8943,
+  -8959, -8975, -8991, -9007, -9023, -9039, -9055, -9071, -9087, -9103, -9119, -9135, -9151, -9167, -9183, -9199,
+  -9215, -9231, -9247, -9263, -9279, -9295, -9311, -9327, -9343, -9359, -9375, -9391, -9407, -9423, -9439, -9455,
+  -9471, -9487, -9503, -9519, -9535, -9551, -9567, -9583, -9599, -9615, -9631, -9647, -9663, -9679, -9695, -9711,
+  -9727, -9743, -9759, -9775, -9791, -9807, -9823, -9839, -9855, -9871, -9887, -9903, -9919, -9935, -9951, -9967,
+  -9983, -9999, -10015, -10031, -10047, -10063, -10079, -10095, -10111, -10127, -10143, -10159, -10175, -10191, -10207, -10223,
+  -10239, -10255, -10271, -10287, -10303, -10319, -10335, -10351, -10367, -10383, -10399, -10415, -10431, -10447, -10463, -10479,
+  -10495, -10511, -10527, -10543, -10559, -10575, -10591, -10607, -10623, -10639, -10655, -10671, -10687, -10703, -10719, -10735,
+  -10751, -10767, -10783, -10799, -10815, -10831, -10847, -10863, -10879, -10895, -10911, -10927, -10943, -10959, -10975, -10991,
+  -11007, -11023, -11039, -11055, -11071, -11087, -11103, -11119, -11135, -11151, -11167, -11183, -11199, -11215, -11231, -11247,
+  -11263, -11279, -11295, -11311, -11327, -11343, -11359, -11375, -11391, -11407, -11423, -11439, -11455, -11471, -11487, -11503,
+  -11519, -11535, -11551, -11567, -11583, -11599, -11615, -11631, -11647, -11663, -11679, -11695, -11711, -11727, -11743, -11759,
+  -11775, -11791, -11807, -11823, -11839, -11855, -11871, -11887, -11903, -11919, -11935, -11951, -11967, -11983, -11999, -12015,
+  -12031, -12047, -12063, -12079, -12095, -12111, -12127, -12143, -12159, -12175, -12191, -12207, -12223, -12239, -12255, -12271,
+  -12287, -12303, -12319, -12335, -12351, -12367, -12383, -12399, -12415, -12431, -12447, -12463, -12479, -12495, -12511, -12527,
+  -12543, -12559, -12575, -12591, -12607, -12623, -12639, -12655, -12671, -12687, -12703, -12719, -12735, -12751, -12767, -12783,
+  -12799, -12815, -12831, -12847, -12863, -12879, -12895, -12911, -12927, -12943, -12959, -12975, -12991, -13007, -13023, -13039,
+  -13055, -13071, -13087, -13103, -13119, -13135, -13151, -13167, -13183, -13199, -13215, -13231, -13247, -13263, -13279, -13295,
+  -13311, -13327, -13343, -13359, -13375, -13391, -13407, -13423, -13439, -13455, -13471, -13487, -13503, -13519, -13535, -13551,
+  -13567, -13583, -13599, -13615, -13631, -13647, -13663, -13679, -13695, -13711, -13727, -13743, -13759, -13775, -13791, -13807,
+  -13823, -13839, -13855, -13871, -13887, -13903, -13919, -13935, -13951, -13967, -13983, -13999, -14015, -14031, -14047, -14063,
+  -14079, -14095, -14111, -14127, -14143, -14159, -14175, -14191, -14207, -14223, -14239, -14255, -14271, -14287, -14303, -14319,
+  -14335, -14351, -14367, -14383, -14399, -14415, -14431, -14447, -14463, -14479, -14495, -14511, -14527, -14543, -14559, -14575,
+  -14591, -14607, -14623, -14639, -14655, -14671, -14687, -14703, -14719, -14735, -14751, -14767, -14783, -14799, -14815, -14831,
+  -14847, -14863, -14879, -14895, -14911, -14927, -14943, -14959, -14975, -14991, -15007, -15023, -15039, -15055, -15071, -15087,
+  -15103, -15119, -15135, -15151, -15167, -15183, -15199, -15215, -15231, -15247, -15263, -15279, -15295, -15311, -15327, -15343,
+  -15359, -15375, -15391, -15407, -15423, -15439, -15455, -15471, -15487, -15503, -15519, -15535, -15551, -15567, -15583, -15599,
+  -15615, -15631, -15647, -15663, -15679, -15695, -15711, -15727, -15743, -15759, -15775, -15791, -15807, -15823, -15839, -15855,
+  -15871, -15887, -15903, -15919, -15935, -15951, -15967, -15983, -15999, -16015, -16031, -16047, -16063, -16079, -16095, -16111,
+  -16127, -16143, -16159, -16175, -16191, -16207, -16223, -16239, -16255, -16271, -16287, -16303, -16319, -16335, -16351, -16367,
+  -16383, -16399, -16415, -16431, -16447, -16463, -16479, -16495, -16511, -16527, -16543, -16559, -16575, -16591, -16607, -16623,
+  -16639, -16655, -16671, -16687, -16703, -16719, -16735, -16751, -16767, -16783, -16799, -16815, -16831, -16847, -16863, -16879,
+  -16895, -16911, -16927, -16943, -16959, -16975, -16991, -17007, -17023, -17039, -17055, -17071, -17087, -17103, -17119, -17135,
+  -17151, -17167, -17183, -17199, -17215, -17231, -17247, -17263, -17279, -17295, -17311, -17327, -17343, -17359, -17375, -17391,
+  -17407, -17423, -17439, -17455, -17471, -17487, -17503, -17519, -17535, -17551, -17567, -17583, -17599, -17615, -17631, -17647,
+  -17663, -17679, -17695, -17711, -17727, -17743, -17759, -17775, -17791, -17807, -17823, -17839, -17855, -17871, -17887, -17903,
+  -17919, -17935, -17951, -17967, -17983, -17999, -18015, -18031, -18047, -18063, -18079, -18095, -18111, -18127, -18143, -18159,
+  -18175, -18191, -18207, -18223, -18239, -18255, -18271, -18287, -18303, -18319, -18335, -18351, -18367, -18383, -18399, -18415,
+  -18431, -18447, -18463, -18479, -18495, -18511, -18527, -18543, -18559, -18575, -18591, -18607, -18623, -18639, -18655, -18671,
+  -18687, -18703, -18719, -18735, -18751, -18767, -18783, -18799, -18815, -18831, -18847, -18863, -18879, -18895, -18911, -18927,
+  -18943, -18959, -18975, -18991, -19007, -19023, -19039, -19055, -19071, -19087, -19103, -19119, -19135, -19151, -19167, -19183,
+  -19199, -19215, -19231, -19247, -19263, -19279, -19295, -19311, -19327, -19343, -19359, -19375, -19391, -19407, -19423, -19439,
+  -19455, -19471, -19487, -19503, -19519, -19535, -19551, -19567, -19583, -19599, -19615, -19631, -19647, -19663, -19679, -19695,
+  -19711, -19727, -19743, -19759, -19775, -19791, -19807, -19823, -19839, -19855, -19871, -19887, -19903, -19919, -19935, -19951,
+  -19967, -19983, -19999, -20015, -20031, -20047, -20063, -20079, -20095, -20111, -20127, -20143, -20159, -20175, -20191, -20207,
+  -20223, -20239, -20255, -20271, -20287, -20303, -20319, -20335, -20351, -20367, -20383, -20399, -20415, -20431, -20447, -20463,
+  -20479, -20495, -20511, -20527, -20543, -20559, -20575, -20591, -20607, -20623, -20639, -20655, -20671, -20687, -20703, -20719,
+  -20735, -20751, -20767, -20783, -20799, -20815, -20831, -20847, -20863, -20879, -20895, -20911, -20927, -20943, -20959, -20975,
+  -20991, -21007, -21023, -21039, -21055, -21071, -21087, -21103, -21119, -21135, -21151, -21167, -21183, -21199, -21215, -21231,
+  -21247, -21263, -21279, -21295, -21311, -21327, -21343, -21359, -21375, -21391, -21407, -21423, -21439, -21455, -21471, -21487,
+  -21503, -21519, -21535, -21551, -21567, -21583, -21599, -21615, -21631, -21647, -21663, -21679, -21695, -21711, -21727, -21743,
+  -21759, -21775, -21791, -21807, -21823, -21839, -21855, -21871, -21887, -21903, -21919, -21935, -21951, -21967, -21983, -21999,
+  -22015, -22031, -22047, -22063, -22079, -22095, -22111, -22127, -22143, -22159, -22175, -22191, -22207, -22223, -22239, -22255,
+  -22271, -22287, -22303, -22319, -22335, -22351, -22367, -22383, -22399, -22415, -22431, -22447, -22463, -22479, -22495, -22511,
+  -22527, -22543, -22559, -22575, -22591, -22607, -22623, -22639, -22655, -22671, -22687, -22703, -22719, -22735, -22751, -22767,
+  -22783, -22799, -22815, -22831, -22847, -22863, -22879, -22895, -22911, -22927, -22943, -22959, -22975, -22991, -23007, -23023,
+  -23039, -23055, -23071, -23087, -23103, -23119, -23135, -23151, -23167, -23183, -23199, -23215, -23231, -23247, -23263, -23279,
+  -23295, -23311, -23327, -23343, -23359, -23375, -23391, -23407, -23423, -23439, -23455, -23471, -23487, -23503, -23519, -23535,
+  -23551, -23567, -23583, -23599, -23615, -23631, -23647, -23663, -23679, -23695, -23711, -23727, -23743, -23759, -23775, -23791,
+  -23807, -23823, -23839, -23855, -23871, -23887, -23903, -23919, -23935, -23951, -23967, -23983, -23999, -24015, -24031, -24047,
+  -24063, -24079, -24095, -24111, -24127, -24143, -24159, -24175, -24191, -24207, -24223, -24239, -24255, -24271, -24287, -24303,
+  -24319, -24335, -24351, -24367, -24383, -24399, -24415, -24431, -24447, -24463, -24479, -24495, -24511, -24527, -24543, -24559,
+  -24575, -24591, -24607, -24623, -24639, -24655, -24671, -24687, -24703, -24719, -24735, -24751, -24767, -24783, -24799, -24815,
+  -24831, -24847, -24863, -24879, -24895, -24911, -24927, -24943, -24959, -24975, -24991, -25007, -25023, -25039, -25055, -25071,
+  -25087, -25103, -25119, -25135, -25151, -25167, -25183, -25199, -25215, -25231, -25247, -25263, -25279, -25295, -25311, -25327,
+  -25343, -25359, -25375, -25391, -25407, -25423, -25439, -25455, -25471, -25487, -25503, -25519, -25535, -25551, -25567, -25583,
+  -25599, -25615, -25631, -25647, -25663, -25679, -25695, -25711, -25727, -25743, -25759, -25775, -25791, -25807, -25823, -25839,
+  -25855, -25871, -25887, -25903, -25919, -25935, -25951, -25967, -25983, -25999, -26015, -26031, -26047, -26063, -26079, -26095,
+  -26111, -26127, -26143, -26159, -26175, -26191, -26207, -26223, -26239, -26255, -26271, -26287, -26303, -26319, -26335, -26351,
+  -26367, -26383, -26399, -26415, -26431, -26447, -26463, -26479, -26495, -26511, -26527, -26543, -26559, -26575, -26591, -26607,
+  -26623, -26639, -26655, -26671, -26687, -26703, -26719, -26735, -26751, -26767, -26783, -26799, -26815, -26831, -26847, -26863,
+  -26879, -26895, -26911, -26927, -26943, -26959, -26975, -26991, -27007, -27023, -27039, -27055, -27071, -27087, -27103, -27119,
+  -27135, -27151, -27167, -27183, -27199, -27215, -27231, -27247, -27263, -27279, -27295, -27311, -27327, -27343, -27359, -27375,
+  -27391, -27407, -27423, -27439, -27455, -27471, -27487, -27503, -27519, -27535, -27551, -27567, -27583, -27599, -27615, -27631,
+  -27647, -27663, -27679, -27695, -27711, -27727, -27743, -27759, -27775, -27791, -27807, -27823, -27839, -27855, -27871, -27887,
+  -27903, -27919, -27935, -27951, -27967, -27983, -27999, -28015, -28031, -28047, -28063, -28079, -28095, -28111, -28127, -28143,
+  -28159, -28175, -28191, -28207, -28223, -28239, -28255, -28271, -28287, -28303, -28319, -28335, -28351, -28367, -28383, -28399,
+  -28415, -28431, -28447, -28463, -28479, -28495, -28511, -28527, -28543, -28559, -28575, -28591, -28607, -28623, -28639, -28655,
+  -28671, -28687, -28703, -28719, -28735, -28751, -28767, -28783, -28799, -28815, -28831, -28847, -28863, -28879, -28895, -28911,
+  -28927, -28943, -28959, -28975, -28991, -29007, -29023, -29039, -29055, -29071, -29087, -29103, -29119, -29135, -29151, -29167,
+  -29183, -29199, -29215, -29231, -29247, -29263, -29279, -29295, -29311, -29327, -29343, -29359, -29375, -29391, -29407, -29423,
+  -29439, -29455, -29471, -29487, -29503, -29519, -29535, -29551, -29567, -29583, -29599, -29615, -29631, -29647, -29663, -29679,
+  -29695, -29711, -29727, -29743, -29759, -29775, -29791, -29807, -29823, -29839, -29855, -29871, -29887, -29903, -29919, -29935,
+  -29951, -29967, -29983, -29999, -30015, -30031, -30047, -30063, -30079, -30095, -30111, -30127, -30143, -30159, -30175, -30191,
+  -30207, -30223, -30239, -30255, -30271, -30287, -30303, -30319, -30335, -30351, -30367, -30383, -30399, -30415, -30431, -30447,
+  -30463, -30479, -30495, -30511, -30527, -30543, -30559, -30575, -30591, -30607, -30623, -30639, -30655, -30671, -30687, -30703,
+  -30719, -30735, -30751, -30767, -30783, -30799, -30815, -30831, -30847, -30863, -30879, -30895, -30911, -30927, -30943, -30959,
+  -30975, -30991, -31007, -31023, -31039, -31055, -31071, -31087, -31103, -31119, -31135, -31151, -31167, -31183, -31199, -31215,
+  -31231, -31247, -31263, -31279, -31295, -31311, -31327, -31343, -31359, -31375, -31391, -31407, -31423, -31439, -31455, -31471,
+  -31487, -31503, -31519, -31535, -31551, -31567, -31583, -31599, -31615, -31631, -31647, -31663, -31679, -31695, -31711, -31727,
+  -31743, -31759, -31775, -31791, -31807, -31823, -31839, -31855, -31871, -31887, -31903, -31919, -31935, -31951, -31967, -31983,
+  -31999, -32015, -32031, -32047, -32063, -32079, -32095, -32111, -32127, -32143, -32159, -32175, -32191, -32207, -32223, -32239,
+  -32255, -32271, -32287, -32303, -32319, -32335, -32351, -32367, -32383, -32399, -32415, -32431, -32447, -32463, -32479, -32495,
+  -32511, -32527, -32543, -32559, -32575, -32591, -32607, -32623, -32639, -32655, -32671, -32687, -32703, -32719, -32735, -32751
+};
+
+const int16_t oscFlashSqr[4096] = {
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767
+};
+
+const int16_t oscFlashSawMip[8192] = {
+  32767, 32751, 32735, 32719, 32703, 32687, 32671, 32655, 32639, 32623, 32607, 32591, 32575, 32559, 32543, 32527,
+  32511, 32495, 32479, 32463, 32447, 32431, 32415, 32399, 32383, 32367, 32351, 32335, 32319, 32303, 32287, 32271,
+  32255, 32239, 32223, 32207, 32191, 32175, 32159, 32143, 32127, 32111, 32095, 32079, 32063, 32047, 32031, 32015,
+  31999, 31983, 31967, 31951, 31935, 31919, 31903, 31887, 31871, 31855, 31839, 31823, 31807, 31791, 31775, 31759,
+  31743, 31727, 31711, 31695, 31679, 31663, 31647, 31631, 31615, 31599, 31583, 31567, 31551, 31535, 31519, 31503,
+  31487, 31471, 31455, 31439, 31423, 31407, 31391, 31375, 31359, 31343, 31327, 31311, 31295, 31279, 31263, 31247,
+  31231, 31215, 31199, 31183, 31167, 31151, 31135, 31119, 31103, 31087, 31071, 31055, 31039, 31023, 31007, 30991,
+  30975, 30959, 30943, 30927, 30911, 30895, 30879, 30863, 30847, 30831, 30815, 30799, 30783, 30767, 30751, 30735,
+  30719, 30703, 30687, 30671, 30655, 30639, 30623, 30607, 30591, 30575, 30559, 30543, 30527, 30511, 30495, 30479,
+  30463, 30447, 30431, 30415, 30399, 30383, 30367, 30351, 30335, 30319, 30303, 30287, 30271, 30255, 30239, 30223,
+  30207, 30191, 30175, 30159, 30143, 30127, 30111, 30095, 30079, 30063, 30047, 30031, 30015, 29999, 29983, 29967,
+  29951, 29935, 29919, 29903, 29887, 29871, 29855, 29839, 29823, 29807, 29791, 29775, 29759, 29743, 29727, 29711,
+  29695, 29679, 29663, 29647, 29631, 29615, 29599, 29583, 29567, 29551, 29535, 29519, 29503, 29487, 29471, 29455,
+  29439, 29423, 29407, 29391, 29375, 29359, 29343, 29327, 29311, 29295, 29279, 29263, 29247, 29231, 29215, 29199,
+  29183, 29167, 29151, 29135, 29119, 29103, 29087, 29071, 29055, 29039, 29023, 29007, 28991, 28975, 28959, 28943,
+  28927, 28911, 28895, 28879, 28863, 28847, 28831, 28815, 28799, 28783, 28767, 28751, 28735, 28719, 28703, 28687,
+  28671, 28655, 28639, 28623, 28607, 28591, 28575, 28559, 28543, 28527, 28511, 28495, 28479, 28463, 28447, 28431,
+  28415, 28399, 28383, 28367, 28351, 28335, 28319, 28303, 28287, 28271, 28255, 28239, 28223, 28207, 28191, 28175,
+  28159, 28143, 28127, 28111, 28095, 28079, 28063, 28047, 28031, 28015, 27999, 27983, 27967, 27951, 27935, 27919,
+  27903, 27887, 27871, 27855, 27839, 27823, 27807, 27791, 27775, 27759, 27743, 27727, 27711, 27695, 27679, 27663,
+  27647, 27631, 27615, 27599, 27583, 27567, 27551, 27535, 27519, 27503, 27487, 27471, 27455, 27439, 27423, 27407,
+  27391, 27375, 27359, 27343, 27327, 27311, 27295, 27279, 27263, 27247, 27231, 27215, 27199, 27183, 27167, 27151,
+  27135, 27119, 27103, 27087, 27071, 27055, 27039, 27023, 27007, 26991, 26975, 26959, 26943, 26927, 26911, 26895,
+  26879, 26863, 26847, 26831, 26815, 26799, 26783, 26767, 26751, 26735, 26719, 26703, 26687, 26671, 26655, 26639,
+  26623, 26607, 26591, 26575, 26559, 26543, 26527, 26511, 26495, 26479, 26463, 26447, 26431, 26415, 26399, 26383,
+  26367, 26351, 26335, 26319, 26303, 26287, 26271, 26255, 26239, 26223, 26207, 26191, 26175, 26159, 26143, 26127,
+  26111, 26095, 26079, 26063, 26047, 26031, 26015, 25999, 25983, 25967, 25951, 25935, 25919, 25903, 25887, 25871,
+  25855, 25839, 25823, 25807, 25791, 25775, 25759, 25743, 25727, 25711, 25695, 25679, 25663, 25647, 25631, 25615,
+  25599, 25583, 25567, 25551, 25535, 25519, 25503, 25487, 25471, 25455, 25439, 25423, 25407, 25391, 25375, 25359,
+  25343, 25327, 25311, 25295, 25279, 25263, 25247, 25231, 25215, 25199, 25183, 25167, 25151, 25135, 25119, 25103,
+  25087, 25071, 25055, 25039, 25023, 25007, 24991, 24975, 24959, 24943, 24927, 24911, 24895, 24879, 24863, 24847,
+  24831, 24815, 24799, 24783, 24767, 24751, 24735, 24719, 24703, 24687, 24671, 24655, 24639, 24623, 24607, 24591,
+  24575, 24559, 24543, 24527, 24511, 24495, 24479, 24463, 24447, 24431, 24415, 24399, 24383, 24367, 24351, 24335,
+  24319, 24303, 24287, 24271, 24255, 24239, 24223, 24207, 24191, 24175, 24159, 24143, 24127, 24111, 24095, 24079,
+  24063, 24047, 24031, 24015, 23999, 23983, 23967, 23951, 23935, 23919, 23903, 23887, 23871, 23855, 23839, 23823,
+  23807, 23791, 23775, 23759, 23743, 23727, 23711, 23695, 23679, 23663, 23647, 23631, 23615, 23599, 23583, 23567,
+  23551, 23535, 23519, 23503, 23487, 23471, 23455, 23439, 23423, 23407, 23391, 23375, 23359, 23343, 23327, 23311,
+  23295, 23279, 23263, 23247, 23231, 23215, 23199, 23183, 23167, 23151, 23135, 23119, 23103, 23087, 23071, 23055,
+  23039, 23023, 23007, 22991, 22975, 22959, 22943, 22927, 22911, 22895, 22879, 22863, 22847, 22831, 22815, 22799,
+  22783, 22767, 22751, 22735, 22719, 22703, 22687, 22671, 22655, 22639, 22623, 22607, 22591, 22575, 22559, 22543,
+  22527, 22511, 22495, 22479, 22463, 22447, 22431, 22415, 22399, 22383, 22367, 22351, 22335, 22319, 22303, 22287,
+  22271, 22255, 22239, 22223, 22207, 22191, 22175, 22159, 22143, 22127, 22111, 22095, 22079, 22063, 22047, 22031,
+  22015, 21999, 21983, 21967, 21951, 21935, 21919, 21903, 21887, 21871, 21855, 21839, 21823, 21807, 21791, 21775,
+  21759, 21743, 21727, 21711, 21695, 21679, 21663, 21647, 21631, 21615, 21599, 21583, 21567, 21551, 21535, 21519,
+  21503, 21487, 21471, 21455, 21439, 21423, 21407, 21391, 21375, 21359, 21343, 21327, 21311, 21295, 21279, 21263,
+  21247, 21231, 21215, 21199, 21183, 21167, 21151, 21135, 21119, 21103, 21087, 21071, 21055, 21039, 21023, 21007,
+  20991, 20975, 20959, 20943, 20927, 20911, 20895, 20879, 20863, 20847, 20831, 20815, 20799, 20783, 20767, 20751,
+  20735, 20719, 20703, 20687, 20671, 20655, 20639, 20623, 20607, 20591, 20575, 20559, 20543, 20527, 20511, 20495,
+  20479, 20463, 20447, 20431, 20415, 20399, 20383, 20367, 20351, 20335, 20319, 20303, 20287, 20271, 20255, 20239,
+  20223, 20207, 20191, 20175, 20159, 20143, 20127, 20111, 20095, 20079, 20063, 20047, 20031, 20015, 19999, 19983,
+  19967, 19951, 19935, 19919, 19903, 19887, 19871, 19855, 19839, 19823, 19807, 19791, 19775, 19759, 19743, 19727,
+  19711, 19695, 19679, 19663, 19647, 19631, 19615, 19599, 19583, 19567, 19551, 19535, 19519, 19503, 19487, 19471,
+  19455, 19439, 19423, 19407, 19391, 19375, 19359, 19343, 19327, 19311, 19295, 19279, 19263, 19247, 19231, 19215,
+  19199, 19183, 19167, 19151, 19135, 19119, 19103, 19087, 19071, 19055, 19039, 19023, 19007, 18991, 18975, 18959,
+  18943, 18927, 18911, 18895, 18879, 18863, 18847, 18831, 18815, 18799, 18783, 18767, 18751, 18735, 18719, 18703,
+  18687, 18671, 18655, 18639, 18623, 18607, 18591, 18575, 18559, 18543, 18527, 18511, 18495, 18479, 18463, 18447,
+  18431, 18415, 18399, 18383, 18367, 18351, 18335, 18319, 18303, 18287, 18271, 18255, 18239, 18223, 18207, 18191,
+  18175, 18159, 18143, 18127, 18111, 18095, 18079, 18063, 18047, 18031, 18015, 17999, 17983, 17967, 17951, 17935,
+  17919, 17903, 17887, 17871, 17855, 17839, 17823, 17807, 17791, 17775, 17759, 17743, 17727, 17711, 17695, 17679,
+  17663, 17647, 17631, 17615, 17599, 17583, 17567, 17551, 17535, 17519, 17503, 17487, 17471, 17455, 17439, 17423,
+  17407, 17391, 17375, 17359, 17343, 17327, 17311, 17295, 17279, 17263, 17247, 17231, 17215, 17199, 17183, 17167,
+  17151, 17135, 17119, 17103, 17087, 17071, 17055, 17039, 17023, 17007, 16991, 16975, 16959, 16943, 16927, 16911,
+  16895, 16879, 16863, 16847, 16831, 16815, 16799, 16783, 16767, 16751, 16735, 16719, 16703, 16687, 16671, 16655,
+  16639, 16623, 16607, 16591, 16575, 16559, 16543, 16527, 16511, 16495, 16479, 16463, 16447, 16431, 16415, 16399,
+  16383, 16367, 16351, 16335, 16319, 16303, 16287, 16271, 16255, 16239, 16223, 16207, 16191, 16175, 16159, 16143,
+  16127, 16111, 16095, 16079, 16063, 16047, 16031, 16015, 15999, 15983, 15967, 15951, 15935, 15919, 15903, 15887,
+  15871, 15855, 15839, 15823, 15807, 15791, 15775, 15759, 15743, 15727, 15711, 15695, 15679, 15663, 15647, 15631,
+  15615, 15599, 15583, 15567, 15551, 15535, 15519, 15503, 15487, 15471, 15455, 15439, 15423, 15407, 15391, 15375,
+  15359, 15343, 15327, 15311, 15295, 15279, 15263, 15247, 15231, 15215, 15199, 15183, 15167, 15151, 15135, 15119,
+  15103, 15087, 15071, 15055, 15039, 15023, 15007, 14991, 14975, 14959, 14943, 14927, 14911, 14895, 14879, 14863,
+  14847, 14831, 14815, 14799, 14783, 14767, 14751, 14735, 14719, 14703, 14687, 14671, 14655, 14639, 14623, 14607,
+  14591, 14575, 14559, 14543, 14527, 14511, 14495, 14479, 14463, 14447, 14431, 14415, 14399, 14383, 14367, 14351,
+  14335, 14319, 14303, 14287, 14271, 14255, 14239, 14223, 14207, 14191, 14175, 14159, 14143, 14127, 14111, 14095,
+  14079, 14063, 14047, 14031, 14015, 13999, 13983, 13967, 13951, 13935, 13919, 13903, 13887, 13871, 13855, 13839,
+  13823, 13807, 13791, 13775, 13759, 13743, 13727, 13711, 13695, 13679, 13663, 13647, 13631, 13615, 13599, 13583,
+  13567, 13551, 13535, 13519, 13503, 13487, 13471, 13455, 13439, 13423, 13407, 13391, 13375, 13359, 13343, 13327,
+  13311, 13295, 13279, 13263, 13247, 13231, 13215, 13199, 13183, 13167, 13151, 13135, 13119, 13103, 13087, 13071,
+  13055, 13039, 13023, 13007, 12991, 12975, 12959, 12943, 12927, 12911, 12895, 12879, 12863, 12847, 12831, 12815,
+  12799, 12783, 12767, 12751, 12735, 12719, 12703, 12687, 12671, 12655, 12639, 12623, 12607, 12591, 12575, 12559,
+  12543, 12527, 12511, 12495, 12479, 12463, 12447, 12431, 12415, 12399, 12383, 12367, 12351, 12335, 12319, 12303,
+  12287, 12271, 12255, 12239, 12223, 12207, 12191, 12175, 12159, 12143, 12127, 12111, 12095, 12079, 12063, 12047,
+  12031, 12015, 11999, 11983, 11967, 11951, 11935, 11919, 11903, 11887, 11871, 11855, 11839, 11823, 11807, 11791,
+  11775, 11759, 11743, 11727, 11711, 11695, 11679, 11663, 11647, 11631, 11615, 11599, 11583, 11567, 11551, 11535,
+  11519, 11503, 11487, 11471, 11455, 11439, 11423, 11407, 11391, 11375, 11359, 11343, 11327, 11311, 11295, 11279,
+  11263, 11247, 11231, 11215, 11199, 11183, 11167, 11151, 11135, 11119, 11103, 11087, 11071, 11055, 11039, 11023,
+  11007, 10991, 10975, 10959, 10943, 10927, 10911, 10895, 10879, 10863, 10847, 10831, 10815, 10799, 10783, 10767,
+  10751, 10735, 10719, 10703, 10687, 10671, 10655, 10639, 10623, 10607, 10591, 10575, 10559, 10543, 10527, 10511,
+  10495, 10479, 10463, 10447, 10431, 10415, 10399, 10383, 10367, 10351, 10335, 10319, 10303, 10287, 10271, 10255,
+  10239, 10223, 10207, 10191, 10175, 10159, 10143, 10127, 10111, 10095, 10079, 10063, 10047, 10031, 10015, 9999,
+  9983, 9967, 9951, 9935, 9919, 9903, 9887, 9871, 9855, 9839, 9823, 9807, 9791, 9775, 9759, 9743,
+  9727, 9711, 9695, 9679, 9663, 9647, 9631, 9615, 9599, 9583, 9567, 9551, 9535, 9519, 9503, 9487,
+  9471, 9455, 9439, 9423, 9407, 9391, 9375, 9359, 9343, 9327, 9311, 9295, 9279, 9263, 9247, 9231,
+  9215, 9199, 9183, 9167, 9151, 9135, 9119, 9103, 9087, 9071, 9055, 9039, 9023, 9007, 8991, 8975,
+  8959, 8943, 8927, 8911, 8895, 8879, 8863, 8847, 8831, 8815, 8799, 8783, 8767, 8751, 8735, 8719,
+  8703, 8687, 8671, 8655, 8639, 8623, 8607, 8591, 8575, 8559, 8543, 8527, 8511, 8495, 8479, 8463,
+  8447, 8431, 8415, 8399, 8383, 8367, 8351, 8335, 8319, 8303, 8287, 8271, 8255, 8239, 8223, 8207,
+  8191, 8175, 8159, 8143, 8127, 8111, 8095, 8079, 8063, 8047, 8031, 8015, 7999, 7983, 7967, 7951,
+  7935, 7919, 7903, 7887, 7871, 7855, 7839, 7823, 7807, 7791, 7775, 7759, 7743, 7727, 7711, 7695,
+  7679, 7663, 7647, 7631, 7615, 7599, 7583, 7567, 7551, 7535, 7519, 7503, 7487, 7471, 7455, 7439,
+  7423, 7407, 7391, 7375, 7359, 7343, 7327, 7311, 7295, 7279, 7263, 7247, 7231, 7215, 7199, 7183,
+  7167, 7151, 7135, 7119, 7103, 7087, 7071, 7055, 7039, 7023, 7007, 6991, 6975, 6959, 6943, 6927,
+  6911, 6895, 6879, 6863, 6847, 6831, 6815, 6799, 6783, 6767, 6751, 6735, 6719, 6703, 6687, 6671,
+  6655, 6639, 6623, 6607, 6591, 6575, 6559, 6543, 6527, 6511, 6495, 6479, 6463, 6447, 6431, 6415,
+  6399, 6383, 6367, 6351, 6335, 6319, 6303, 6287, 6271, 6255, 6239, 6223, 6207, 6191, 6175, 6159,
+  6143, 6127, 6111, 6095, 6079, 6063, 6047, 6031, 6015, 5999, 5983, 5967, 5951, 5935, 5919, 5903,
+  5887, 5871, 5855, 5839, 5823, 5807, 5791, 5775, 5759, 5743, 5727, 5711, 5695, 5679, 5663, 5647,
+  5631, 5615, 5599, 5583, 5567, 5551, 5535, 5519, 5503, 5487, 5471, 5455, 5439, 5423, 5407, 5391,
+  5375, 5359, 5343, 5327, 5311, 5295, 5279, 5263, 5247, 5231, 5215, 5199, 5183, 5167, 5151, 5135,
+  5119, 5103, 5087, 5071, 5055, 5039, 5023, 5007, 4991, 4975, 4959, 4943, 4927, 4911, 4895, 4879,
+  4863, 4847, 4831, 4815, 4799, 4783, 4767, 4751, 4735, 4719, 4703, 4687, 4671, 4655, 4639, 4623,
+  4607, 4591, 4575, 4559, 4543, 4527, 4511, 4495, 4479, 4463, 4447, 4431, 4415, 4399, 4383, 4367,
+  4351, 4335, 4319, 4303, 4287, 4271, 4255, 4239, 4223, 4207, 4191, 4175, 4159, 4143, 4127, 4111,
+  4095, 4079, 4063, 4047, 4031, 4015, 3999, 3983, 3967, 3951, 3935, 3919, 3903, 3887, 3871, 3855,
+  3839, 3823, 3807, 3791, 3775, 3759, 3743, 3727, 3711, 3695, 3679, 3663, 3647, 3631, 3615, 3599,
+  3583, 3567, 3551, 3535, 3519, 3503, 3487, 3471, 3455, 3439, 3423, 3407, 3391, 3375, 3359, 3343,
+  3327, 3311, 3295, 3279, 3263, 3247, 3231, 3215, 3199, 3183, 3167, 3151, 3135, 3119, 3103, 3087,
+  3071, 3055, 3039, 3023, 3007, 2991, 2975, 2959, 2943, 2927, 2911, 2895, 2879, 2863, 2847, 2831,
+  2815, 2799, 2783, 2767, 2751, 2735, 2719, 2703, 2687, 2671, 2655, 2639, 2623, 2607, 2591, 2575,
+  2559, 2543, 2527, 2511, 2495, 2479, 2463, 2447, 2431, 2415, 2399, 2383, 2367, 2351, 2335, 2319,
+  2303, 2287, 2271, 2255, 2239, 2223, 2207, 2191, 2175, 2159, 2143, 2127, 2111, 2095, 2079, 2063,
+  2047, 2031, 2015, 1999, 1983, 1967, 1951, 1935, 1919, 1903, 1887, 1871, 1855, 1839, 1823, 1807,
+  1791, 1775, 1759, 1743, 1727, 1711, 1695, 1679, 1663, 1647, 1631, 1615, 1599, 1583, 1567, 1551,
+  1535, 1519, 1503, 1487, 1471, 1455, 1439, 1423, 1407, 1391, 1375, 1359, 1343, 1327, 1311, 1295,
+  1279, 1263, 1247, 1231, 1215, 1199, 1183, 1167, 1151, 1135, 1119, 1103, 1087, 1071, 1055, 1039,
+  1023, 1007, 991, 975, 959, 943, 927, 911, 895, 879, 863, 847, 831, 815, 799, 783,
+  767, 751, 735, 719, 703, 687, 671, 655, 639, 623, 607, 591, 575, 559, 543, 527,
+  511, 495, 479, 463, 447, 431, 415, 399, 383, 367, 351, 335, 319, 303, 287, 271,
+  255, 239, 223, 207, 191, 175, 159, 143, 127, 111, 95, 79, 63, 47, 32, 16,
+  0, -16, -32, -48, -64, -79, -95, -111, -127, -143, -159, -175, -191, -207, -223, -239,
+  -255, -271, -287, -303, -319, -335, -351, -367, -383, -399, -415, -431, -447, -463, -479, -495,
+  -511, -527, -543, -559, -575, -591, -607, -623, -639, -655, -671, -687, -703, -719, -735, -751,
+  -767, -783, -799, -815, -831, -847, -863, -879, -895, -911, -927, -943, -959, -975, -991, -1007,
+  -1023, -1039, -1055, -1071, -1087, -1103, -1119, -1135, -1151, -1167, -1183, -1199, -1215, -1231, -1247, -1263,
+  -1279, -1295, -1311, -1327, -1343, -1359, -1375, -1391, -1407, -1423, -1439, -1455, -1471, -1487, -1503, -1519,
+  -1535, -1551, -1567, -1583, -1599, -1615, -1631, -1647, -1663, -1679, -1695, -1711, -1727, -1743, -1759, -1775,
+  -1791, -1807, -1823, -1839, -1855, -1871, -1887, -1903, -1919, -1935, -1951, -1967, -1983, -1999, -2015, -2031,
+  -2047, -2063, -2079, -2095, -2111, -2127, -2143, -2159, -2175, -2191, -2207, -2223, -2239, -2255, -2271, -2287,
+  -2303, -2319, -2335, -2351, -2367, -2383, -2399, -2415, -2431, -2447, -2463, -2479, -2495, -2511, -2527, -2543,
+  -2559, -2575, -2591, -2607, -2623, -2639, -2655, -2671, -2687, -2703, -2719, -2735, -2751, -2767, -2783, -2799,
+  -2815, -2831, -2847, -2863, -2879, -2895, -2911, -2927, -2943, -2959, -2975, -2991, -3007, -3023, -3039, -3055,
+  -3071, -3087, -3103, -3119, -3135, -3151, -3167, -3183, -3199, -3215, -3231, -3247, -3263, -3279, -3295, -3311,
+  -3327, -3343, -3359, -3375, -3391, -3407, -3423, -3439, -3455, -3471, -3487, -3503, -3519, -3535, -3551, -3567,
+  -3583, -3599, -3615, -3631, -3647, -3663, -3679, -3695, -3711, -3727, -3743, -3759, -3775, -3791, -3807, -3823,
+  -3839, -3855, -3871, -3887, -3903, -3919, -3935, -3951, -3967, -3983, -3999, -4015, -4031, -4047, -4063, -4079,
+  -4095, -4111, -4127, -4143, -4159, -4175, -4191, -4207, -4223, -4239, -4255, -4271, -4287, -4303, -4319, -4335,
+  -4351, -4367, -4383, -4399, -4415, -4431, -4447, -4463, -4479, -4495, -4511, -4527, -4543, -4559, -4575, -4591,
+  -4607, -4623, -4639, -4655, -4671, -4687, -4703, -4719, -4735, -4751, -4767, -4783, -4799, -4815, -4831, -4847,
+  -4863, -4879, -4895, -4911, -4927, -4943, -4959, -4975, -4991, -5007, -5023, -5039, -5055, -5071, -5087, -5103,
+  -5119, -5135, -5151, -5167, -5183, -5199, -5215, -5231, -5247, -5263, -5279, -5295, -5311, -5327, -5343, -5359,
+  -5375, -5391, -5407, -5423, -5439, -5455, -5471, -5487, -5503, -5519, -5535, -5551, -5567, -5583, -5599, -5615,
+  -5631, -5647, -5663, -5679, -5695, -5711, -5727, -5743, -5759, -5775, -5791, -5807, -5823, -5839, -5855, -5871,
+  -5887, -5903, -5919, -5935, -5951, -5967, -5983, -5999, -6015, -6031, -6047, -6063, -6079, -6095, -6111, -6127,
+  -6143, -6159, -6175, -6191, -6207, -6223, -6239, -6255, -6271, -6287, -6303, -6319, -6335, -6351, -6367, -6383,
+  -6399, -6415, -6431, -6447, -6463, -6479, -6495, -6511, -6527, -6543, -6559, -6575, -6591, -6607, -6623, -6639,
+  -6655, -6671, -6687, -6703, -6719, -6735, -6751, -6767, -6783, -6799, -6815, -6831, -6847, -6863, -6879, -6895,
+  -6911, -6927, -6943, -6959, -6975, -6991, -7007, -7023, -7039, -7055, -7071, -7087, -7103, -7119, -7135, -7151,
+  -7167, -7183, -7199, -7215, -7231, -7247, -7263, -7279, -7295, -7311, -7327, -7343, -7359, -7375, -7391, -7407,
+  -7423, -7439, -7455, -7471, -7487, -7503, -7519, -7535, -7551, -7567, -7583, -7599, -7615, -7631, -7647, -7663,
+  -7679, -7695, -7711, -7727, -7743, -7759, -7775, -7791, -7807, -7823, -7839, -7855, -7871, -7887, -7903, -7919,
+  -7935, -7951, -7967, -7983, -7999, -8015, -8031, -8047, -8063, -8079, -8095, -8111, -8127, -8143, -8159, -8175,
+  -8191, -8207, -8223, -8239, -8255, -8271, -8287, -8303, -8319, -8335, -8351, -8367, -8383, -8399, -8415, -8431,
+  -8447, -8463, -8479, -8495, -8511, -8527, -8543, -8559, -8575, -8591, -8607, -8623, -8639, -8655, -8671, -8687,
+  -8703, -8719, -8735, -8751, -8767, -8783, -8799, -8815, -8831, -8847, -8863, -8879, -8895, -8911, -8927, -8943,
+  -8959, -8975, -8991, -9007, -9023, -9039, -9055, -9071, -9087, -9103, -9119, -9135, -9151, -9167, -9183, -9199,
+  -9215, -9231, -9247, -9263, -9279, -9295, -9311, -9327, -9343, -9359, -9375, -9391, -9407, -9423, -9439, -9455,
+  -9471, -9487, -9503, -9519, -9535, -9551, -9567, -9583, -9599, -9615, -9631, -9647, -9663, -9679, -9695, -9711,
+  -9727, -9743, -9759, -9775, -9791, -9807, -9823, -9839, -9855, -9871, -9887, -9903, -9919, -9935, -9951, -9967,
+  -9983, -9999, -10015, -10031, -10047, -10063, -10079, -10095, -10111, -10127, -10143, -10159, -10175, -10191, -10207, -10223,
+  -10239, -10255, -10271, -10287, -10303, -10319, -10335, -10351, -10367, -10383, -10399, -10415, -10431, -10447, -10463, -10479,
+  -10495, -10511, -10527, -10543, -10559, -10575, -10591, -10607, -10623, -10639, -10655, -10671, -10687, -10703, -10719, -10735,
+  -10751, -10767, -10783, -10799, -10815, -10831, -10847, -10863, -10879, -10895, -10911, -10927, -10943, -10959, -10975, -10991,
+  -11007, -11023, -11039, -11055, -11071, -11087, -11103, -11119, -11135, -11151, -11167, -11183, -11199, -11215, -11231, -11247,
+  -11263, -11279, -11295, -11311, -11327, -11343, -11359, -11375, -11391, -11407, -11423, -11439, -11455, -11471, -11487, -11503,
+  -11519, -11535, -11551, -11567, -11583, -11599, -11615, -11631, -11647, -11663, -11679, -11695, -11711, -11727, -11743, -11759,
+  -11775, -11791, -11807, -11823, -11839, -11855, -11871, -11887, -11903, -11919, -11935, -11951, -11967, -11983, -11999, -12015,
+  -12031, -12047, -12063, -12079, -12095, -12111, -12127, -12143, -12159, -12175, -12191, -12207, -12223, -12239, -12255, -12271,
+  -12287, -12303, -12319, -12335, -12351, -12367, -12383, -12399, -12415, -12431, -12447, -12463, -12479, -12495, -12511, -12527,
+  -12543, -12559, -12575, -12591, -12607, -12623, -12639, -12655, -12671, -12687, -12703, -12719, -12735, -12751, -12767, -12783,
+  -12799, -12815, -12831, -12847, -12863, -12879, -12895, -12911, -12927, -12943, -12959, -12975, -12991, -13007, -13023, -13039,
+  -13055, -13071, -13087, -13103, -13119, -13135, -13151, -13167, -13183, -13199, -13215, -13231, -13247, -13263, -13279, -13295,
+  -13311, -13327, -13343, -13359, -13375, -13391, -13407, -13423, -13439, -13455, -13471, -13487, -13503, -13519, -13535, -13551,
+  -13567, -13583, -13599, -13615, -13631, -13647, -13663, -13679, -13695, -13711, -13727, -13743, -13759, -13775, -13791, -13807,
+  -13823, -13839, -13855, -13871, -13887, -13903, -13919, -13935, -13951, -13967, -13983, -13999, -14015, -14031, -14047, -14063,
+  -14079, -14095, -14111, -14127, -14143, -14159, -14175, -14191, -14207, -14223, -14239, -14255, -14271, -14287, -14303, -14319,
+  -14335, -14351, -14367, -14383, -14399, -14415, -14431, -14447, -14463, -14479, -14495, -14511, -14527, -14543, -14559, -14575,
+  -14591, -14607, -14623, -14639, -14655, -14671, -14687, -14703, -14719, -14735, -14751, -14767, -14783, -14799, -14815, -14831,
+  -14847, -14863, -14879, -14895, -14911, -14927, -14943, -14959, -14975, -14991, -15007, -15023, -15039, -15055, -15071, -15087,
+  -15103, -15119, -15135, -15151, -15167, -15183, -15199, -15215, -15231, -15247, -15263, -15279, -15295, -15311, -15327, -15343,
+  -15359, -15375, -15391, -15407, -15423, -15439, -15455, -15471, -15487, -15503, -15519, -15535, -15551, -15567, -15583, -15599,
+  -15615, -15631, -15647, -15663, -15679, -15695, -15711, -15727, -15743, -15759, -15775, -15791, -15807, -15823, -15839, -15855,
+  -15871, -15887, -15903, -15919, -15935, -15951, -15967, -15983, -15999, -16015, -16031, -16047, -16063, -16079, -16095, -16111,
+  -16127, -16143, -16159, -16175, -16191, -16207, -16223, -16239, -16255, -16271, -16287, -16303, -16319, -16335, -16351, -16367,
+  -16383, -16399, -16415, -16431, -16447, -16463, -16479, -16495, -16511, -16527, -16543, -16559, -16575, -16591, -16607, -16623,
+  -16639, -16655, -16671, -16687, -16703, -16719, -16735, -16751, -16767, -16783, -16799, -16815, -16831, -16847, -16863, -16879,
+  -16895, -16911, -16927, -16943, -16959, -16975, -16991, -17007, -17023, -17039, -17055, -17071, -17087, -17103, -17119, -17135,
+  -17151, -17167, -17183, -17199, -17215, -17231, -17247, -17263, -17279, -17295, -17311, -17327, -17343, -17359, -17375, -17391,
+  -17407, -17423, -17439, -17455, -17471, -17487, -17503, -17519, -17535, -17551, -17567, -17583, -17599, -17615, -17631, -17647,
+  -17663, -17679, -17695, -17711, -17727, -17743, -17759, -17775, -17791, -17807, -17823, -17839, -17855, -17871, -17887, -17903,
+  -17919, -17935, -17951, -17967, -17983, -17999, -18015, -18031, -18047, -18063, -18079, -18095, -18111, -18127, -18143, -18159,
+  -18175, -18191, -18207, -18223, -18239, -18255, -18271, -18287, -18303, -18319, -18335, -18351, -18367, -18383, -18399, -18415,
+  -18431, -18447, -18463, -18479, -18495, -18511, -18527, -18543, -18559, -18575, -18591, -18607, -18623, -18639, -18655, -18671,
+  -18687, -18703, -18719, -18735, -18751, -18767, -18783, -18799, -18815, -18831, -18847, -18863, -18879, -18895, -18911, -18927,
+  -18943, -18959, -18975, -18991, -19007, -19023, -19039, -19055, -19071, -19087, -19103, -19119, -19135, -19151, -19167, -19183,
+  -19199, -19215, -19231, -19247, -19263, -19279, -19295, -19311, -19327, -19343, -19359, -19375, -19391, -19407, -19423, -19439,
+  -19455, -19471, -19487, -19503, -19519, -19535, -19551, -19567, -19583, -19599, -19615, -19631, -19647, -19663, -19679, -19695,
+  -19711, -19727, -19743, -19759, -19775, -19791, -19807, -19823, -19839, -19855, -19871, -19887, -19903, -19919, -19935, -19951,
+  -19967, -19983, -19999, -20015, -20031, -20047, -20063, -20079, -20095, -20111, -20127, -20143, -20159, -20175, -20191, -20207,
+  -20223, -20239, -20255, -20271, -20287, -20303, -20319, -20335, -20351, -20367, -20383, -20399, -20415, -20431, -20447, -20463,
+  -20479, -20495, -20511, -20527, -20543, -20559, -20575, -20591, -20607, -20623, -20639, -20655, -20671, -20687, -20703, -20719,
+  -20735, -20751, -20767, -20783, -20799, -20815, -20831, -20847, -20863, -20879, -20895, -20911, -20927, -20943, -20959, -20975,
+  -20991, -21007, -21023, -21039, -21055, -21071, -21087, -21103, -21119, -21135, -21151, -21167, -21183, -21199, -21215, -21231,
+  -21247, -21263, -21279, -21295, -21311, -21327, -21343, -21359, -21375, -21391, -21407, -21423, -21439, -21455, -21471, -21487,
+  -21503, -21519, -21535, -21551, -21567, -21583, -21599, -21615, -21631, -21647, -21663, -21679, -21695, -21711, -21727, -21743,
+  -21759, -21775, -21791, -21807, -21823, -21839, -21855, -21871, -21887, -21903, -21919, -21935, -21951, -21967, -21983, -21999,
+  -22015, -22031, -22047, -22063, -22079, -22095, -22111, -22127, -22143, -22159, -22175, -22191, -22207, -22223, -22239, -22255,
+  -22271, -22287, -22303, -22319, -22335, -22351, -22367, -22383, -22399, -22415, -22431, -22447, -22463, -22479, -22495, -22511,
+  -22527, -22543, -22559, -22575, -22591, -22607, -22623, -22639, -22655, -22671, -22687, -22703, -22719, -22735, -22751, -22767,
+  -22783, -22799, -22815, -22831, -22847, -22863, -22879, -22895, -22911, -22927, -22943, -22959, -22975, -22991, -23007, -23023,
+  -23039, -23055, -23071, -23087, -23103, -23119, -23135, -23151, -23167, -23183, -23199, -23215, -23231, -23247, -23263, -23279,
+  -23295, -23311, -23327, -23343, -23359, -23375, -23391, -23407, -23423, -23439, -23455, -23471, -23487, -23503, -23519, -23535,
+  -23551, -23567, -23583, -23599, -23615, -23631, -23647, -23663, -23679, -23695, -23711, -23727, -23743, -23759, -23775, -23791,
+  -23807, -23823, -23839, -23855, -23871, -23887, -23903, -23919, -23935, -23951, -23967, -23983, -23999, -24015, -24031, -24047,
+  -24063, -24079, -24095, -24111, -24127, -24143, -24159, -24175, -24191, -24207, -24223, -24239, -24255, -24271, -24287, -24303,
+  -24319, -24335, -24351, -24367, -24383, -24399, -24415, -24431, -24447, -24463, -24479, -24495, -24511, -24527, -24543, -24559,
+  -24575, -24591, -24607, -24623, -24639, -24655, -24671, -24687, -24703, -24719, -24735, -24751, -24767, -24783, -24799, -24815,
+  -24831, -24847, -24863, -24879, -24895, -24911, -24927, -24943, -24959, -24975, -24991, -25007, -25023, -25039, -25055, -25071,
+  -25087, -25103, -25119, -25135, -25151, -25167, -25183, -25199, -25215, -25231, -25247, -25263, -25279, -25295, -25311, -25327,
+  -25343, -25359, -25375, -25391, -25407, -25423, -25439, -25455, -25471, -25487, -25503, -25519, -25535, -25551, -25567, -25583,
+  -25599, -25615, -25631, -25647, -25663, -25679, -25695, -25711, -25727, -25743, -25759, -25775, -25791, -25807, -25823, -25839,
+  -25855, -25871, -25887, -25903, -25919, -25935, -25951, -25967, -25983, -25999, -26015, -26031, -26047, -26063, -26079, -26095,
+  -26111, -26127, -26143, -26159, -26175, -26191, -26207, -26223, -26239, -26255, -26271, -26287, -26303, -26319, -26335, -26351,
+  -26367, -26383, -26399, -26415, -26431, -26447, -26463, -26479, -26495, -26511, -26527, -26543, -26559, -26575, -26591, -26607,
+  -26623, -26639, -26655, -26671, -26687, -26703, -26719, -26735, -26751, -26767, -26783, -26799, -26815, -26831, -26847, -26863,
+  -26879, -26895, -26911, -26927, -26943, -26959, -26975, -26991, -27007, -27023, -27039, -27055, -27071, -27087, -27103, -27119,
+  -27135, -27151, -27167, -27183, -27199, -27215, -27231, -27247, -27263, -27279, -27295, -27311, -27327, -27343, -27359, -27375,
+  -27391, -27407, -27423, -27439, -27455, -27471, -27487, -27503, -27519, -27535, -27551, -27567, -27583, -27599, -27615, -27631,
+  -27647, -27663, -27679, -27695, -27711, -27727, -27743, -27759, -27775, -27791, -27807, -27823, -27839, -27855, -27871, -27887,
+  -27903, -27919, -27935, -27951, -27967, -27983, -27999, -28015, -28031, -28047, -28063, -28079, -28095, -28111, -28127, -28143,
+  -28159, -28175, -28191, -28207, -28223, -28239, -28255, -28271, -28287, -28303, -28319, -28335, -28351, -28367, -28383, -28399,
+  -28415, -28431, -28447, -28463, -28479, -28495, -28511, -28527, -28543, -28559, -28575, -28591, -28607, -28623, -28639, -28655,
+  -28671, -28687, -28703, -28719, -28735, -28751, -28767, -28783, -28799, -28815, -28831, -28847, -28863, -28879, -28895, -28911,
+  -28927, -28943, -28959, -28975, -28991, -29007, -29023, -29039, -29055, -29071, -29087, -29103, -29119, -29135, -29151, -29167,
+  -29183, -29199, -29215, -29231, -29247, -29263, -29279, -29295, -29311, -29327, -29343, -29359, -29375, -29391, -29407, -29423,
+  -29439, -29455, -29471, -29487, -29503, -29519, -29535, -29551, -29567, -29583, -29599, -29615, -29631, -29647, -29663, -29679,
+  -29695, -29711, -29727, -29743, -29759, -29775, -29791, -29807, -29823, -29839, -29855, -29871, -29887, -29903, -29919, -29935,
+  -29951, -29967, -29983, -29999, -30015, -30031, -30047, -30063, -30079, -30095, -30111, -30127, -30143, -30159, -30175, -30191,
+  -30207, -30223, -30239, -30255, -30271, -30287, -30303, -30319, -30335, -30351, -30367, -30383, -30399, -30415, -30431, -30447,
+  -30463, -30479, -30495, -30511, -30527, -30543, -30559, -30575, -30591, -30607, -30623, -30639, -30655, -30671, -30687, -30703,
+  -30719, -30735, -30751, -30767, -30783, -30799, -30815, -30831, -30847, -30863, -30879, -30895, -30911, -30927, -30943, -30959,
+  -30975, -30991, -31007, -31023, -31039, -31055, -31071, -31087, -31103, -31119, -31135, -31151, -31167, -31183, -31199, -31215,
+  -31231, -31247, -31263, -31279, -31295, -31311, -31327, -31343, -31359, -31375, -31391, -31407, -31423, -31439, -31455, -31471,
+  -31487, -31503, -31519, -31535, -31551, -31567, -31583, -31599, -31615, -31631, -31647, -31663, -31679, -31695, -31711, -31727,
+  -31743, -31759, -31775, -31791, -31807, -31823, -31839, -31855, -31871, -31887, -31903, -31919, -31935, -31951, -31967, -31983,
+  -31999, -32015, -32031, -32047, -32063, -32079, -32095, -32111, -32127, -32143, -32159, -32175, -32191, -32207, -32223, -32239,
+  -32255, -32271, -32287, -32303, -32319, -32335, -32351, -32367, -32383, -32399, -32415, -32431, -32447, -32463, -32479, -32495,
+  -32511, -32527, -32543, -32559, -32575, -32591, -32607, -32623, -32639, -32655, -32671, -32687, -32703, -32719, -32735, -32751,
+  0, 29321, 32767, 32321, 32426, 32332, 32333, 32282, 32263, 32222, 32197, 32160, 32132, 32098, 32068, 32035,
+  32004, 31971, 31941, 31908, 31877, 31845, 31813, 31781, 31750, 31718, 31686, 31654, 31623, 31591, 31559, 31527,
+  31496, 31464, 31432, 31400, 31369, 31337, 31305, 31273, 31242, 31210, 31178, 31146, 31115, 31083, 31051, 31019,
+  30988, 30956, 30924, 30892, 30861, 30829, 30797, 30765, 30734, 30702, 30670, 30638, 30607, 30575, 30543, 30511,
+  30480, 30448, 30416, 30384, 30353, 30321, 30289, 30257, 30226, 30194, 30162, 30130, 30099, 30067, 30035, 30003,
+  29972, 29940, 29908, 29876, 29845, 29813, 29781, 29749, 29718, 29686, 29654, 29622, 29591, 29559, 29527, 29495,
+  29464, 29432, 29400, 29368, 29337, 29305, 29273, 29241, 29210, 29178, 29146, 29114, 29083, 29051, 29019, 28987,
+  28956, 28924, 28892, 28860, 28829, 28797, 28765, 28733, 28702, 28670, 28638, 28606, 28575, 28543, 28511, 28479,
+  28448, 28416, 28384, 28352, 28321, 28289, 28257, 28225, 28194, 28162, 28130, 28098, 28067, 28035, 28003, 27971,
+  27940, 27908, 27876, 27844, 27813, 27781, 27749, 27717, 27686, 27654, 27622, 27591, 27559, 27527, 27495, 27463,
+  27432, 27400, 27368, 27336, 27305, 27273, 27241, 27209, 27178, 27146, 27114, 27082, 27051, 27019, 26987, 26955,
+  26924, 26892, 26860, 26828, 26797, 26765, 26733, 26701, 26670, 26638, 26606, 26574, 26543, 26511, 26479, 26447,
+  26416, 26384, 26352, 26320, 26289, 26257, 26225, 26193, 26162, 26130, 26098, 26066, 26035, 26003, 25971, 25939,
+  25908, 25876, 25844, 25812, 25781, 25749, 25717, 25685, 25654, 25622, 25590, 25558, 25527, 25495, 25463, 25431,
+  25400, 25368, 25336, 25304, 25273, 25241, 25209, 25177, 25146, 25114, 25082, 25050, 25019, 24987, 24955, 24923,
+  24892, 24860, 24828, 24796, 24765, 24733, 24701, 24669, 24638, 24606, 24574, 24542, 24511, 24479, 24447, 24415,
+  24384, 24352, 24320, 24288, 24257, 24225, 24193, 24161, 24130, 24098, 24066, 24034, 24003, 23971, 23939, 23907,
+  23876, 23844, 23812, 23780, 23749, 23717, 23685, 23653, 23622, 23590, 23558, 23526, 23495, 23463, 23431, 23399,
+  23368, 23336, 23304, 23272, 23241, 23209, 23177, 23145, 23114, 23082, 23050, 23018, 22987, 22955, 22923, 22892,
+  22860, 22828, 22796, 22764, 22733, 22701, 22669, 22637, 22606, 22574, 22542, 22510, 22479, 22447, 22415, 22383,
+  22352, 22320, 22288, 22256, 22225, 22193, 22161, 22129, 22098, 22066, 22034, 22002, 21971, 21939, 21907, 21875,
+  21844, 21812, 21780, 21748, 21717, 21685, 21653, 21621, 21590, 21558, 21526, 21494, 21463, 21431, 21399, 21367,
+  21336, 21304, 21272, 21240, 21209, 21177, 21145, 21113, 21082, 21050, 21018, 20986, 20955, 20923, 20891, 20859,
+  20828, 20796, 20764, 20732, 20701, 20669, 20637, 20605, 20574, 20542, 20510, 20478, 20447, 20415, 20383, 20351,
+  20320, 20288, 20256, 20224, 20193, 20161, 20129, 20097, 20066, 20034, 20002, 19970, 19939, 19907, 19875, 19843,
+  19812, 19780, 19748, 19716, 19685, 19653, 19621, 19589, 19558, 19526, 19494, 19462, 19431, 19399, 19367, 19335,
+  19304, 19272, 19240, 19208, 19177, 19145, 19113, 19081, 19050, 19018, 18986, 18954, 18923, 18891, 18859, 18827,
+  18796, 18764, 18732, 18700, 18669, 18637, 18605, 18573, 18542, 18510, 18478, 18446, 18415, 18383, 18351, 18319,
+  18288, 18256, 18224, 18192, 18161, 18129, 18097, 18065, 18034, 18002, 17970, 17938, 17907, 17875, 17843, 17811,
+  17780, 17748, 17716, 17684, 17653, 17621, 17589, 17557, 17526, 17494, 17462, 17430, 17399, 17367, 17335, 17303,
+  17272, 17240, 17208, 17176, 17145, 17113, 17081, 17049, 17018, 16986, 16954, 16922, 16891, 16859, 16827, 16795,
+  16764, 16732, 16700, 16668, 16637, 16605, 16573, 16541, 16510, 16478, 16446, 16414, 16383, 16351, 16319, 16287,
+  16256, 16224, 16192, 16160, 16129, 16097, 16065, 16033, 16002, 15970, 15938, 15906, 15875, 15843, 15811, 15779,
+  15748, 15716, 15684, 15652, 15621, 15589, 15557, 15525, 15494, 15462, 15430, 15398, 15367, 15335, 15303, 15271,
+  15240, 15208, 15176, 15144, 15113, 15081, 15049, 15017, 14986, 14954, 14922, 14890, 14859, 14827, 14795, 14763,
+  14732, 14700, 14668, 14636, 14605, 14573, 14541, 14509, 14478, 14446, 14414, 14382, 14351, 14319, 14287, 14255,
+  14224, 14192, 14160, 14128, 14097, 14065, 14033, 14001, 13970, 13938, 13906, 13874, 13843, 13811, 13779, 13747,
+  13716, 13684, 13652, 13620, 13589, 13557, 13525, 13493, 13462, 13430, 13398, 13366, 13335, 13303, 13271, 13239,
+  13208, 13176, 13144, 13112, 13081, 13049, 13017, 12985, 12954, 12922, 12890, 12858, 12827, 12795, 12763, 12731,
+  12700, 12668, 12636, 12604, 12573, 12541, 12509, 12477, 12446, 12414, 12382, 12350, 12319, 12287, 12255, 12223,
+  12192, 12160, 12128, 12096, 12065, 12033, 12001, 11969, 11938, 11906, 11874, 11842, 11811, 11779, 11747, 11715,
+  11684, 11652, 11620, 11588, 11557, 11525, 11493, 11461, 11430, 11398, 11366, 11334, 11303, 11271, 11239, 11207,
+  11176, 11144, 11112, 11080, 11049, 11017, 10985, 10953, 10922, 10890, 10858, 10826, 10795, 10763, 10731, 10699,
+  10668, 10636, 10604, 10572, 10541, 10509, 10477, 10445, 10414, 10382, 10350, 10318, 10287, 10255, 10223, 10191,
+  10160, 10128, 10096, 10064, 10033, 10001, 9969, 9937, 9906, 9874, 9842, 9810, 9779, 9747, 9715, 9683,
+  9652, 9620, 9588, 9556, 9525, 9493, 9461, 9429, 9398, 9366, 9334, 9302, 9271, 9239, 9207, 9175,
+  9144, 9112, 9080, 9048, 9017, 8985, 8953, 8921, 8890, 8858, 8826, 8794, 8763, 8731, 8699, 8667,
+  8636, 8604, 8572, 8540, 8509, 8477, 8445, 8413, 8382, 8350, 8318, 8286, 8255, 8223, 8191, 8159,
+  8128, 8096, 8064, 8032, 8001, 7969, 7937, 7905, 7874, 7842, 7810, 7778, 7747, 7715, 7683, 7651,
+  7620, 7588, 7556, 7524, 7493, 7461, 7429, 7397, 7366, 7334, 7302, 7270, 7239, 7207, 7175, 7143,
+  7112, 7080, 7048, 7016, 6985, 6953, 6921, 6889, 6858, 6826, 6794, 6762, 6731, 6699, 6667, 6635,
+  6604, 6572, 6540, 6508, 6477, 6445, 6413, 6381, 6350, 6318, 6286, 6254, 6223, 6191, 6159, 6127,
+  6096, 6064, 6032, 6000, 5969, 5937, 5905, 5873, 5842, 5810, 5778, 5746, 5715, 5683, 5651, 5619,
+  5588, 5556, 5524, 5492, 5461, 5429, 5397, 5365, 5334, 5302, 5270, 5238, 5207, 5175, 5143, 5111,
+  5080, 5048, 5016, 4984, 4953, 4921, 4889, 4857, 4826, 4794, 4762, 4730, 4699, 4667, 4635, 4603,
+  4572, 4540, 4508, 4476, 4445, 4413, 4381, 4349, 4318, 4286, 4254, 4222, 4191, 4159, 4127, 4095,
+  4064, 4032, 4000, 3968, 3937, 3905, 3873, 3841, 3810, 3778, 3746, 3714, 3683, 3651, 3619, 3587,
+  3556, 3524, 3492, 3460, 3429, 3397, 3365, 3333, 3302, 3270, 3238, 3206, 3175, 3143, 3111, 3079,
+  3048, 3016, 2984, 2952, 2921, 2889, 2857, 2825, 2794, 2762, 2730, 2698, 2667, 2635, 2603, 2571,
+  2540, 2508, 2476, 2444, 2413, 2381, 2349, 2317, 2286, 2254, 2222, 2190, 2159, 2127, 2095, 2063,
+  2032, 2000, 1968, 1936, 1905, 1873, 1841, 1809, 1778, 1746, 1714, 1682, 1651, 1619, 1587, 1555,
+  1524, 1492, 1460, 1428, 1397, 1365, 1333, 1301, 1270, 1238, 1206, 1174, 1143, 1111, 1079, 1047,
+  1016, 984, 952, 920, 889, 857, 825, 793, 762, 730, 698, 666, 635, 603, 571, 539,
+  508, 476, 444, 412, 381, 349, 317, 285, 254, 222, 190, 158, 127, 95, 63, 31,
+  0, -31, -63, -95, -127, -158, -190, -222, -254, -285, -317, -349, -381, -412, -444, -476,
+  -508, -539, -571, -603, -635, -666, -698, -730, -762, -793, -825, -857, -889, -920, -952, -984,
+  -1016, -1047, -1079, -1111, -1143, -1174, -1206, -1238, -1270, -1301, -1333, -1365, -1397, -1428, -1460, -1492,
+  -1524, -1555, -1587, -1619, -1651, -1682, -1714, -1746, -1778, -1809, -1841, -1873, -1905, -1936, -1968, -2000,
+  -2032, -2063, -2095, -2127, -2159, -2190, -2222, -2254, -2286, -2317, -2349, -2381, -2413, -2444, -2476, -2508,
+  -2540, -2571, -2603, -2635, -2667, -2698, -2730, -2762, -2794, -2825, -2857, -2889, -2921, -2952, -2984, -3016,
+  -3048, -3079, -3111, -3143, -3175, -3206, -3238, -3270, -3302, -3333, -3365, -3397, -3429, -3460, -3492, -3524,
+  -3556, -3587, -3619, -3651, -3683, -3714, -3746, -3778, -3810, -3841, -3873, -3905, -3937, -3968, -4000, -4032,
+  -4064, -4095, -4127, -4159, -4191, -4222, -4254, -4286, -4318, -4349, -4381, -4413, -4445, -4476, -4508, -4540,
+  -4572, -4603, -4635, -4667, -4699, -4730, -4762, -4794, -4826, -4857, -4889, -4921, -4953, -4984, -5016, -5048,
+  -5080, -5111, -5143, -5175, -5207, -5238, -5270, -5302, -5334, -5365, -5397, -5429, -5461, -5492, -5524, -5556,
+  -5588, -5619, -5651, -5683, -5715, -5746, -5778, -5810, -5842, -5873, -5905, -5937, -5969, -6000, -6032, -6064,
+  -6096, -6127, -6159, -6191, -6223, -6254, -6286, -6318, -6350, -6381, -6413, -6445, -6477, -6508, -6540, -6572,
+  -6604, -6635, -6667, -6699, -6731, -6762, -6794, -6826, -6858, -6889, -6921, -6953, -6985, -7016, -7048, -7080,
+  -7112, -7143, -7175, -7207, -7239, -7270, -7302, -7334, -7366, -7397, -7429, -7461, -7493, -7524, -7556, -7588,
+  -7620, -7651, -7683, -7715, -7747, -7778, -7810, -7842, -7874, -7905, -7937, -7969, -8001, -8032, -8064, -8096,
+  -8128, -8159, -8191, -8223, -8255, -8286, -8318, -8350, -8382, -8413, -8445, -8477, -8509, -8540, -8572, -8604,
+  -8636, -8667, -8699, -8731, -8763, -8794, -8826, -8858, -8890, -8921, -8953, -8985, -9017, -9048, -9080, -9112,
+  -9144, -9175, -9207, -9239, -9271, -9302, -9334, -9366, -9398, -9429, -9461, -9493, -9525, -9556, -9588, -9620,
+  -9652, -9683, -9715, -9747, -9779, -9810, -9842, -9874, -9906, -9937, -9969, -10001, -10033, -10064, -10096, -10128,
+  -10160, -10191, -10223, -10255, -10287, -10318, -10350, -10382, -10414, -10445, -10477, -10509, -10541, -10572, -10604, -10636,
+  -10668, -10699, -10731, -10763, -10795, -10826, -10858, -10890, -10922, -10953, -10985, -11017, -11049, -11080, -11112, -11144,
+  -11176, -11207, -11239, -11271, -11303, -11334, -11366, -11398, -11430, -11461, -11493, -11525, -11557, -11588, -11620, -11652,
+  -11684, -11715, -11747, -11779, -11811, -11842, -11874, -11906, -11938, -11969, -12001, -12033, -12065, -12096, -12128, -12160,
+  -12192, -12223, -12255, -12287, -12319, -12350, -12382, -12414, -12446, -12477, -12509, -12541, -12573, -12604, -12636, -12668,
+  -12700, -12731, -12763, -12795, -12827, -12858, -12890, -12922, -12954, -12985, -13017, -13049, -13081, -13112, -13144, -13176,
+  -13208, -13239, -13271, -13303, -13335, -13366, -13398, -13430, -13462, -13493, -13525, -13557, -13589, -13620, -13652, -13684,
+  -13716, -13747, -13779, -13811, -13843, -13874, -13906, -13938, -13970, -14001, -14033, -14065, -14097, -14128, -14160, -14192,
+  -14224, -14255, -14287, -14319, -14351, -14382, -14414, -14446, -14478, -14509, -14541, -14573, -14605, -14636, -14668, -14700,
+  -14732, -14763, -14795, -14827, -14859, -14890, -14922, -14954, -14986, -15017, -15049, -15081, -15113, -15144, -15176, -15208,
+  -15240, -15271, -15303, -15335, -15367, -15398, -15430, -15462, -15494, -15525, -15557, -15589, -15621, -15652, -15684, -15716,
+  -15748, -15779, -15811, -15843, -15875, -15906, -15938, -15970, -16002, -16033, -16065, -16097, -16129, -16160, -16192, -16224,
+  -16256, -16287, -16319, -16351, -16383, -16414, -16446, -16478, -16510, -16541, -16573, -16605, -16637, -16668, -16700, -16732,
+  -16764, -16795, -16827, -16859, -16891, -16922, -16954, -16986, -17018, -17049, -17081, -17113, -17145, -17176, -17208, -17240,
+  -17272, -17303, -17335, -17367, -17399, -17430, -17462, -17494, -17526, -17557, -17589, -17621, -17653, -17684, -17716, -17748,
+  -17780, -17811, -17843, -17875, -17907, -17938, -17970, -18002, -18034, -18065, -18097, -18129, -18161, -18192, -18224, -18256,
+  -18288, -18319, -18351, -18383, -18415, -18446, -18478, -18510, -18542, -18573, -18605, -18637, -18669, -18700, -18732, -18764,
+  -18796, -18827, -18859, -18891, -18923, -18954, -18986, -19018, -19050, -19081, -19113, -19145, -19177, -19208, -19240, -19272,
+  -19304, -19335, -19367, -19399, -19431, -19462, -19494, -19526, -19558, -19589, -19621, -19653, -19685, -19716, -19748, -19780,
+  -19812, -19843, -19875, -19907, -19939, -19970, -20002, -20034, -20066, -20097, -20129, -20161, -20193, -20224, -20256, -20288,
+  -20320, -20351, -20383, -20415, -20447, -20478, -20510, -20542, -20574, -20605, -20637, -20669, -20701, -20732, -20764, -20796,
+  -20828, -20859, -20891, -20923, -20955, -20986, -21018, -21050, -21082, -21113, -21145, -21177, -21209, -21240, -21272, -21304,
+  -21336, -21367, -21399, -21431, -21463, -21494, -21526, -21558, -21590, -21621, -21653, -21685, -21717, -21748, -21780, -21812,
+  -21844, -21875, -21907, -21939, -21971, -22002, -22034, -22066, -22098, -22129, -22161, -22193, -22225, -22256, -22288, -22320,
+  -22352, -22383, -22415, -22447, -22479, -22510, -22542, -22574, -22606, -22637, -22669, -22701, -22733, -22764, -22796, -22828,
+  -22860, -22892, -22923, -22955, -22987, -23018, -23050, -23082, -23114, -23145, -23177, -23209, -23241, -23272, -23304, -23336,
+  -23368, -23399, -23431, -23463, -23495, -23526, -23558, -23590, -23622, -23653, -23685, -23717, -23749, -23780, -23812, -23844,
+  -23876, -23907, -23939, -23971, -24003, -24034, -24066, -24098, -24130, -24161, -24193, -24225, -24257, -24288, -24320, -24352,
+  -24384, -24415, -24447, -24479, -24511, -24542, -24574, -24606, -24638, -24669, -24701, -24733, -24765, -24796, -24828, -24860,
+  -24892, -24923, -24955, -24987, -25019, -25050, -25082, -25114, -25146, -25177, -25209, -25241, -25273, -25304, -25336, -25368,
+  -25400, -25431, -25463, -25495, -25527, -25558, -25590, -25622, -25654, -25685, -25717, -25749, -25781, -25812, -25844, -25876,
+  -25908, -25939, -25971, -26003, -26035, -26066, -26098, -26130, -26162, -26193, -26225, -26257, -26289, -26320, -26352, -26384,
+  -26416, -26447, -26479, -26511, -26543, -26574, -26606, -26638, -26670, -26701, -26733, -26765, -26797, -26828, -26860, -26892,
+  -26924, -26955, -26987, -27019, -27051, -27082, -27114, -27146, -27178, -27209, -27241, -27273, -27305, -27336, -27368, -27400,
+  -27432, -27463, -27495, -27527, -27559, -27591, -27622, -27654, -27686, -27717, -27749, -27781, -27813, -27844, -27876, -27908,
+  -27940, -27971, -28003, -28035, -28067, -28098, -28130, -28162, -28194, -28225, -28257, -28289, -28321, -28352, -28384, -28416,
+  -28448, -28479, -28511, -28543, -28575, -28606, -28638, -28670, -28702, -28733, -28765, -28797, -28829, -28860, -28892, -28924,
+  -28956, -28987, -29019, -29051, -29083, -29114, -29146, -29178, -29210, -29241, -29273, -29305, -29337, -29368, -29400, -29432,
+  -29464, -29495, -29527, -29559, -29591, -29622, -29654, -29686, -29718, -29749, -29781, -29813, -29845, -29876, -29908, -29940,
+  -29972, -30003, -30035, -30067, -30099, -30130, -30162, -30194, -30226, -30257, -30289, -30321, -30353, -30384, -30416, -30448,
+  -30480, -30511, -30543, -30575, -30607, -30638, -30670, -30702, -30734, -30765, -30797, -30829, -30861, -30892, -30924, -30956,
+  -30988, -31019, -31051, -31083, -31115, -31146, -31178, -31210, -31242, -31273, -31305, -31337, -31369, -31400, -31432, -31464,
+  -31496, -31527, -31559, -31591, -31623, -31654, -31686, -31718, -31750, -31781, -31813, -31845, -31877, -31908, -31941, -31971,
+  -32004, -32035, -32068, -32098, -32132, -32160, -32197, -32222, -32263, -32282, -32333, -32332, -32426, -32321, -32767, -29321,
+  0, 29346, 32766, 32288, 32361, 32236, 32205, 32122, 32071, 31999, 31941, 31873, 31813, 31747, 31685, 31620,
+  31557, 31493, 31430, 31366, 31303, 31238, 31175, 31111, 31048, 30984, 30921, 30857, 30793, 30730, 30666, 30602,
+  30539, 30475, 30412, 30348, 30284, 30221, 30157, 30093, 30030, 29966, 29903, 29839, 29775, 29712, 29648, 29584,
+  29521, 29457, 29394, 29330, 29266, 29203, 29139, 29076, 29012, 28948, 28885, 28821, 28757, 28694, 28630, 28567,
+  28503, 28439, 28376, 28312, 28248, 28185, 28121, 28058, 27994, 27930, 27867, 27803, 27739, 27676, 27612, 27549,
+  27485, 27421, 27358, 27294, 27230, 27167, 27103, 27040, 26976, 26912, 26849, 26785, 26721, 26658, 26594, 26531,
+  26467, 26403, 26340, 26276, 26212, 26149, 26085, 26022, 25958, 25894, 25831, 25767, 25703, 25640, 25576, 25513,
+  25449, 25385, 25322, 25258, 25194, 25131, 25067, 25004, 24940, 24876, 24813, 24749, 24686, 24622, 24558, 24495,
+  24431, 24367, 24304, 24240, 24177, 24113, 24049, 23986, 23922, 23858, 23795, 23731, 23668, 23604, 23540, 23477,
+  23413, 23349, 23286, 23222, 23159, 23095, 23031, 22968, 22904, 22840, 22777, 22713, 22650, 22586, 22522, 22459,
+  22395, 22331, 22268, 22204, 22141, 22077, 22013, 21950, 21886, 21822, 21759, 21695, 21632, 21568, 21504, 21441,
+  21377, 21313, 21250, 21186, 21123, 21059, 20995, 20932, 20868, 20804, 20741, 20677, 20614, 20550, 20486, 20423,
+  20359, 20295, 20232, 20168, 20105, 20041, 19977, 19914, 19850, 19786, 19723, 19659, 19596, 19532, 19468, 19405,
+  19341, 19277, 19214, 19150, 19087, 19023, 18959, 18896, 18832, 18768, 18705, 18641, 18578, 18514, 18450, 18387,
+  18323, 18260, 18196, 18132, 18069, 18005, 17941, 17878, 17814, 17751, 17687, 17623, 17560, 17496, 17432, 17369,
+  17305, 17242, 17178, 17114, 17051, 16987, 16923, 16860, 16796, 16733, 16669, 16605, 16542, 16478, 16414, 16351,
+  16287, 16224, 16160, 16096, 16033, 15969, 15905, 15842, 15778, 15715, 15651, 15587, 15524, 15460, 15396, 15333,
+  15269, 15206, 15142, 15078, 15015, 14951, 14887, 14824, 14760, 14697, 14633, 14569, 14506, 14442, 14378, 14315,
+  14251, 14188, 14124, 14060, 13997, 13933, 13869, 13806, 13742, 13679, 13615, 13551, 13488, 13424, 13360, 13297,
+  13233, 13170, 13106, 13042, 12979, 12915, 12851, 12788, 12724, 12661, 12597, 12533, 12470, 12406, 12343, 12279,
+  12215, 12152, 12088, 12024, 11961, 11897, 11834, 11770, 11706, 11643, 11579, 11515, 11452, 11388, 11325, 11261,
+  11197, 11134, 11070, 11006, 10943, 10879, 10816, 10752, 10688, 10625, 10561, 10497, 10434, 10370, 10307, 10243,
+  10179, 10116, 10052, 9988, 9925, 9861, 9798, 9734, 9670, 9607, 9543, 9479, 9416, 9352, 9289, 9225,
+  9161, 9098, 9034, 8970, 8907, 8843, 8780, 8716, 8652, 8589, 8525, 8461, 8398, 8334, 8271, 8207,
+  8143, 8080, 8016, 7952, 7889, 7825, 7762, 7698, 7634, 7571, 7507, 7443, 7380, 7316, 7253, 7189,
+  7125, 7062, 6998, 6934, 6871, 6807, 6744, 6680, 6616, 6553, 6489, 6425, 6362, 6298, 6235, 6171,
+  6107, 6044, 5980, 5917, 5853, 5789, 5726, 5662, 5598, 5535, 5471, 5408, 5344, 5280, 5217, 5153,
+  5089, 5026, 4962, 4899, 4835, 4771, 4708, 4644, 4580, 4517, 4453, 4390, 4326, 4262, 4199, 4135,
+  4071, 4008, 3944, 3881, 3817, 3753, 3690, 3626, 3562, 3499, 3435, 3372, 3308, 3244, 3181, 3117,
+  3053, 2990, 2926, 2863, 2799, 2735, 2672, 2608, 2544, 2481, 2417, 2354, 2290, 2226, 2163, 2099,
+  2035, 1972, 1908, 1845, 1781, 1717, 1654, 1590, 1526, 1463, 1399, 1336, 1272, 1208, 1145, 1081,
+  1017, 954, 890, 827, 763, 699, 636, 572, 508, 445, 381, 318, 254, 190, 127, 63,
+  0, -63, -127, -190, -254, -318, -381, -445, -508, -572, -636, -699, -763, -827, -890, -954,
+  -1017, -1081, -1145, -1208, -1272, -1336, -1399, -1463, -1526, -1590, -1654, -1717, -1781, -1845, -1908, -1972,
+  -2035, -2099, -2163, -2226, -2290, -2354, -2417, -2481, -2544, -2608, -2672, -2735, -2799, -2863, -2926, -2990,
+  -3053, -3117, -3181, -3244, -3308, -3372, -3435, -3499, -3562, -3626, -3690, -3753, -3817, -3881, -3944, -4008,
+  -4071, -4135, -4199, -4262, -4326, -4390, -4453, -4517, -4580, -4644, -4708, -4771, -4835, -4899, -4962, -5026,
+  -5089, -5153, -5217, -5280, -5344, -5408, -5471, -5535, -5598, -5662, -5726, -5789, -5853, -5917, -5980, -6044,
+  -6107, -6171, -6235, -6298, -6362, -6425, -6489, -6553, -6616, -6680, -6744, -6807, -6871, -6934, -6998, -7062,
+  -7125, -7189, -7253, -7316, -7380, -7443, -7507, -7571, -7634, -7698, -7762, -7825, -7889, -7952, -8016, -8080,
+  -8143, -8207, -8271, -8334, -8398, -8461, -8525, -8589, -8652, -8716, -8780, -8843, -8907, -8970, -9034, -9098,
+  -9161, -9225, -9289, -9352, -9416, -9479, -9543, -9607, -9670, -9734, -9798, -9861, -9925, -9988, -10052, -10116,
+  -10179, -10243, -10307, -10370, -10434, -10497, -10561, -10625, -10688, -10752, -10816, -10879, -10943, -11006, -11070, -11134,
+  -11197, -11261, -11325, -11388, -11452, -11515, -11579, -11643, -11706, -11770, -11834, -11897, -11961, -12024, -12088, -12152,
+  -12215, -12279, -12343, -12406, -12470, -12533, -12597, -12661, -12724, -12788, -12851, -12915, -12979, -13042, -13106, -13170,
+  -13233, -13297, -13360, -13424, -13488, -13551, -13615, -13679, -13742, -13806, -13869, -13933, -13997, -14060, -14124, -14188,
+  -14251, -14315, -14378, -14442, -14506, -14569, -14633, -14697, -14760, -14824, -14887, -14951, -15015, -15078, -15142, -15206,
+  -15269, -15333, -15396, -15460, -15524, -15587, -15651, -15715, -15778, -15842, -15905, -15969, -16033, -16096, -16160, -16224,
+  -16287, -16351, -16414, -16478, -16542, -16605, -16669, -16733, -16796, -16860, -16923, -16987, -17051, -17114, -17178, -17242,
+  -17305, -17369, -17432, -17496, -17560, -17623, -17687, -17751, -17814, -17878, -17941, -18005, -18069, -18132, -18196, -18260,
+  -18323, -18387, -18450, -18514, -18578, -18641, -18705, -18768, -18832, -18896, -18959, -19023, -19087, -19150, -19214, -19277,
+  -19341, -19405, -19468, -19532, -19596, -19659, -19723, -19786, -19850, -19914, -19977, -20041, -20105, -20168, -20232, -20295,
+  -20359, -20423, -20486, -20550, -20614, -20677, -20741, -20804, -20868, -20932, -20995, -21059, -21123, -21186, -21250, -21313,
+  -21377, -21441, -21504, -21568, -21632, -21695, -21759, -21822, -21886, -21950, -22013, -22077, -22141, -22204, -22268, -22331,
+  -22395, -22459, -22522, -22586, -22650, -22713, -22777, -22840, -22904, -22968, -23031, -23095, -23159, -23222, -23286, -23349,
+  -23413, -23477, -23540, -23604, -23668, -23731, -23795, -23858, -23922, -23986, -24049, -24113, -24177, -24240, -24304, -24367,
+  -24431, -24495, -24558, -24622, -24686, -24749, -24813, -24876, -24940, -25004, -25067, -25131, -25194, -25258, -25322, -25385,
+  -25449, -25513, -25576, -25640, -25703, -25767, -25831, -25894, -25958, -26022, -26085, -26149, -26212, -26276, -26340, -26403,
+  -26467, -26531, -26594, -26658, -26721, -26785, -26849, -26912, -26976, -27040, -27103, -27167, -27230, -27294, -27358, -27421,
+  -27485, -27549, -27612, -27676, -27739, -27803, -27867, -27930, -27994, -28058, -28121, -28185, -28248, -28312, -28376, -28439,
+  -28503, -28567, -28630, -28694, -28757, -28821, -28885, -28948, -29012, -29076, -29139, -29203, -29266, -29330, -29394, -29457,
+  -29521, -29584, -29648, -29712, -29775, -29839, -29903, -29966, -30030, -30093, -30157, -30221, -30284, -30348, -30412, -30475,
+  -30539, -30602, -30666, -30730, -30793, -30857, -30921, -30984, -31048, -31111, -31175, -31238, -31303, -31366, -31430, -31493,
+  -31557, -31620, -31685, -31747, -31813, -31873, -31941, -31999, -32071, -32122, -32205, -32236, -32361, -32288, -32766, -29346,
+  0, 29396, 32767, 32222, 32232, 32042, 31948, 31800, 31685, 31548, 31427, 31295, 31170, 31040, 30914, 30785,
+  30659, 30530, 30403, 30274, 30147, 30019, 29892, 29764, 29636, 29508, 29381, 29253, 29125, 28997, 28870, 28742,
+  28614, 28486, 28359, 28231, 28103, 27975, 27848, 27720, 27592, 27464, 27337, 27209, 27081, 26953, 26826, 26698,
+  26570, 26442, 26315, 26187, 26059, 25931, 25804, 25676, 25548, 25420, 25293, 25165, 25037, 24909, 24782, 24654,
+  24526, 24398, 24271, 24143, 24015, 23888, 23760, 23632, 23504, 23377, 23249, 23121, 22993, 22866, 22738, 22610,
+  22482, 22355, 22227, 22099, 21971, 21844, 21716, 21588, 21460, 21333, 21205, 21077, 20949, 20822, 20694, 20566,
+  20438, 20311, 20183, 20055, 19927, 19800, 19672, 19544, 19417, 19289, 19161, 19033, 18906, 18778, 18650, 18522,
+  18395, 18267, 18139, 18011, 17884, 17756, 17628, 17500, 17373, 17245, 17117, 16989, 16862, 16734, 16606, 16478,
+  16351, 16223, 16095, 15967, 15840, 15712, 15584, 15456, 15329, 15201, 15073, 14945, 14818, 14690, 14562, 14435,
+  14307, 14179, 14051, 13924, 13796, 13668, 13540, 13413, 13285, 13157, 13029, 12902, 12774, 12646, 12518, 12391,
+  12263, 12135, 12007, 11880, 11752, 11624, 11496, 11369, 11241, 11113, 10985, 10858, 10730, 10602, 10474, 10347,
+  10219, 10091, 9963, 9836, 9708, 9580, 9453, 9325, 9197, 9069, 8942, 8814, 8686, 8558, 8431, 8303,
+  8175, 8047, 7920, 7792, 7664, 7536, 7409, 7281, 7153, 7025, 6898, 6770, 6642, 6514, 6387, 6259,
+  6131, 6003, 5876, 5748, 5620, 5492, 5365, 5237, 5109, 4981, 4854, 4726, 4598, 4471, 4343, 4215,
+  4087, 3960, 3832, 3704, 3576, 3449, 3321, 3193, 3065, 2938, 2810, 2682, 2554, 2427, 2299, 2171,
+  2043, 1916, 1788, 1660, 1532, 1405, 1277, 1149, 1021, 894, 766, 638, 510, 383, 255, 127,
+  0, -127, -255, -383, -510, -638, -766, -894, -1021, -1149, -1277, -1405, -1532, -1660, -1788, -1916,
+  -2043, -2171, -2299, -2427, -2554, -2682, -2810, -2938, -3065, -3193, -3321, -3449, -3576, -3704, -3832, -3960,
+  -4087, -4215, -4343, -4471, -4598, -4726, -4854, -4981, -5109, -5237, -5365, -5492, -5620, -5748, -5876, -6003,
+  -6131, -6259, -6387, -6514, -6642, -6770, -6898, -7025, -7153, -7281, -7409, -7536, -7664, -7792, -7920, -8047,
+  -8175, -8303, -8431, -8558, -8686, -8814, -8942, -9069, -9197, -9325, -9453, -9580, -9708, -9836, -9963, -10091,
+  -10219, -10347, -10474, -10602, -10730, -10858, -10985, -11113, -11241, -11369, -11496, -11624, -11752, -11880, -12007, -12135,
+  -12263, -12391, -12518, -12646, -12774, -12902, -13029, -13157, -13285, -13413, -13540, -13668, -13796, -13924, -14051, -14179,
+  -14307, -14435, -14562, -14690, -14818, -14945, -15073, -15201, -15329, -15456, -15584, -15712, -15840, -15967, -16095, -16223,
+  -16351, -16478, -16606, -16734, -16862, -16989, -17117, -17245, -17373, -17500, -17628, -17756, -17884, -18011, -18139, -18267,
+  -18395, -18522, -18650, -18778, -18906, -19033, -19161, -19289, -19417, -19544, -19672, -19800, -19927, -20055, -20183, -20311,
+  -20438, -20566, -20694, -20822, -20949, -21077, -21205, -21333, -21460, -21588, -21716, -21844, -21971, -22099, -22227, -22355,
+  -22482, -22610, -22738, -22866, -22993, -23121, -23249, -23377, -23504, -23632, -23760, -23888, -24015, -24143, -24271, -24398,
+  -24526, -24654, -24782, -24909, -25037, -25165, -25293, -25420, -25548, -25676, -25804, -25931, -26059, -26187, -26315, -26442,
+  -26570, -26698, -26826, -26953, -27081, -27209, -27337, -27464, -27592, -27720, -27848, -27975, -28103, -28231, -28359, -28486,
+  -28614, -28742, -28870, -28997, -29125, -29253, -29381, -29508, -29636, -29764, -29892, -30019, -30147, -30274, -30403, -30530,
+  -30659, -30785, -30914, -31040, -31170, -31295, -31427, -31548, -31685, -31800, -31948, -32042, -32232, -32222, -32767, -29396,
+  0, 29498, 32767, 32089, 31970, 31650, 31426, 31149, 30904, 30638, 30387, 30124, 29870, 29610, 29355, 29096,
+  28840, 28581, 28324, 28066, 27809, 27551, 27294, 27036, 26779, 26521, 26264, 26006, 25749, 25491, 25234, 24976,
+  24719, 24461, 24204, 23946, 23689, 23431, 23174, 22916, 22659, 22401, 22144, 21887, 21629, 21372, 21114, 20857,
+  20599, 20342, 20084, 19827, 19569, 19312, 19054, 18797, 18539, 18282, 18024, 17767, 17509, 17252, 16994, 16737,
+  16479, 16222, 15964, 15707, 15449, 15192, 14934, 14677, 14419, 14162, 13904, 13647, 13389, 13132, 12874, 12617,
+  12359, 12102, 11844, 11587, 11329, 11072, 10814, 10557, 10299, 10042, 9784, 9527, 9269, 9012, 8754, 8497,
+  8239, 7982, 7724, 7467, 7209, 6952, 6694, 6437, 6179, 5922, 5664, 5407, 5149, 4892, 4634, 4377,
+  4119, 3862, 3604, 3347, 3089, 2832, 2574, 2317, 2059, 1802, 1544, 1287, 1029, 772, 514, 257,
+  0, -257, -514, -772, -1029, -1287, -1544, -1802, -2059, -2317, -2574, -2832, -3089, -3347, -3604, -3862,
+  -4119, -4377, -4634, -4892, -5149, -5407, -5664, -5922, -6179, -6437, -6694, -6952, -7209, -7467, -7724, -7982,
+  -8239, -8497, -8754, -9012, -9269, -9527, -9784, -10042, -10299, -10557, -10814, -11072, -11329, -11587, -11844, -12102,
+  -12359, -12617, -12874, -13132, -13389, -13647, -13904, -14162, -14419, -14677, -14934, -15192, -15449, -15707, -15964, -16222,
+  -16479, -16737, -16994, -17252, -17509, -17767, -18024, -18282, -18539, -18797, -19054, -19312, -19569, -19827, -20084, -20342,
+  -20599, -20857, -21114, -21372, -21629, -21887, -22144, -22401, -22659, -22916, -23174, -23431, -23689, -23946, -24204, -24461,
+  -24719, -24976, -25234, -25491, -25749, -26006, -26264, -26521, -26779, -27036, -27294, -27551, -27809, -28066, -28324, -28581,
+  -28840, -29096, -29355, -29610, -29870, -30124, -30387, -30638, -30904, -31149, -31426, -31650, -31970, -32089, -32767, -29498,
+  0, 29708, 32767, 31817, 31434, 30847, 30358, 29815, 29305, 28772, 28256, 27728, 27208, 26682, 26161, 25636,
+  25114, 24590, 24068, 23544, 23021, 22497, 21975, 21451, 20928, 20405, 19882, 19358, 18835, 18312, 17789, 17265,
+  16742, 16219, 15696, 15173, 14650, 14126, 13603, 13080, 12557, 12033, 11510, 10987, 10464, 9941, 9417, 8894,
+  8371, 7848, 7324, 6801, 6278, 5755, 5232, 4708, 4185, 3662, 3139, 2616, 2092, 1569, 1046, 523,
+  0, -523, -1046, -1569, -2092, -2616, -3139, -3662, -4185, -4708, -5232, -5755, -6278, -6801, -7324, -7848,
+  -8371, -8894, -9417, -9941, -10464, -10987, -11510, -12033, -12557, -13080, -13603, -14126, -14650, -15173, -15696, -16219,
+  -16742, -17265, -17789, -18312, -18835, -19358, -19882, -20405, -20928, -21451, -21975, -22497, -23021, -23544, -24068, -24590,
+  -25114, -25636, -26161, -26682, -27208, -27728, -28256, -28772, -29305, -29815, -30358, -30847, -31434, -31817, -32767, -29708,
+  0, 30147, 32767, 31245, 30309, 29163, 28117, 27015, 25948, 24857, 23783, 22697, 21620, 20536, 19458, 18375,
+  17295, 16213, 15133, 14051, 12971, 11890, 10809, 9728, 8647, 7566, 6485, 5404, 4323, 3242, 2161, 1080,
+  0, -1080, -2161, -3242, -4323, -5404, -6485, -7566, -8647, -9728, -10809, -11890, -12971, -14051, -15133, -16213,
+  -17295, -18375, -19458, -20536, -21620, -22697, -23783, -24857, -25948, -27015, -28117, -29163, -30309, -31245, -32767, -30147,
+  0, 31120, 32767, 29980, 27821, 25436, 23159, 20822, 18522, 16198, 13890, 11571, 9259, 6942, 4629, 2314,
+  0, -2314, -4629, -6942, -9259, -11571, -13890, -16198, -18522, -20822, -23159, -25436, -27821, -29980, -32767, -31120,
+  0, 32767, 32006, 26205, 21114, 15772, 10544, 5260, 0, -5260, -10544, -15772, -21114, -26205, -32006, -32767,
+  0, 32767, 25566, 12428, 0, -12428, -25566, -32767, 0, 32767, 0, -32767, 0, 0, 0, 0
+};
+
+const int16_t oscFlashSqrMip[8192] = {
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+  0, 29296, 32767, 32353, 32490, 32428, 32461, 32441, 32454, 32445, 32451, 32447, 32450, 32448, 32450, 32448,
+  32449, 32448, 32449, 32448, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32448, 32449, 32448,
+  32449, 32448, 32450, 32448, 32450, 32447, 32451, 32445, 32454, 32441, 32461, 32428, 32490, 32353, 32767, 29296,
+  0, -29296, -32767, -32353, -32490, -32428, -32461, -32441, -32454, -32445, -32451, -32447, -32450, -32448, -32450, -32448,
+  -32449, -32448, -32449, -32448, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32448, -32449, -32448,
+  -32449, -32448, -32450, -32448, -32450, -32447, -32451, -32445, -32454, -32441, -32461, -32428, -32490, -32353, -32767, -29296,
+  0, 29296, 32767, 32353, 32490, 32428, 32461, 32441, 32454, 32445, 32451, 32447, 32450, 32448, 32450, 32448,
+  32449, 32448, 32449, 32448, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32448, 32449, 32448,
+  32449, 32448, 32450, 32448, 32450, 32447, 32451, 32445, 32454, 32441, 32461, 32428, 32490, 32353, 32767, 29296,
+  0, -29296, -32767, -32353, -32490, -32428, -32461, -32441, -32454, -32445, -32451, -32447, -32450, -32448, -32450, -32448,
+  -32449, -32448, -32449, -32448, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32448, -32449, -32448,
+  -32449, -32448, -32450, -32448, -32450, -32447, -32451, -32445, -32454, -32441, -32461, -32428, -32490, -32353, -32767, -29296,
+  0, 29296, 32767, 32353, 32490, 32428, 32461, 32441, 32454, 32445, 32451, 32447, 32450, 32448, 32450, 32448,
+  32449, 32448, 32449, 32448, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32448, 32449, 32448,
+  32449, 32448, 32450, 32448, 32450, 32447, 32451, 32445, 32454, 32441, 32461, 32428, 32490, 32353, 32767, 29296,
+  0, -29296, -32767, -32353, -32490, -32428, -32461, -32441, -32454, -32445, -32451, -32447, -32450, -32448, -32450, -32448,
+  -32449, -32448, -32449, -32448, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32448, -32449, -32448,
+  -32449, -32448, -32450, -32448, -32450, -32447, -32451, -32445, -32454, -32441, -32461, -32428, -32490, -32353, -32767, -29296,
+  0, 29296, 32767, 32353, 32490, 32428, 32461, 32441, 32454, 32445, 32451, 32447, 32450, 32448, 32450, 32448,
+  32449, 32448, 32449, 32448, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32448, 32449, 32448,
+  32449, 32448, 32450, 32448, 32450, 32447, 32451, 32445, 32454, 32441, 32461, 32428, 32490, 32353, 32767, 29296,
+  0, -29296, -32767, -32353, -32490, -32428, -32461, -32441, -32454, -32445, -32451, -32447, -32450, -32448, -32450, -32448,
+  -32449, -32448, -32449, -32448, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32448, -32449, -32448,
+  -32449, -32448, -32450, -32448, -32450, -32447, -32451, -32445, -32454, -32441, -32461, -32428, -32490, -32353, -32767, -29296,
+  0, 29296, 32766, 32353, 32490, 32428, 32461, 32441, 32454, 32445, 32451, 32447, 32450, 32448, 32450, 32448,
+  32449, 32448, 32449, 32448, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449,
+  32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32449, 32448, 32449, 32448,
+  32449, 32448, 32450, 32448, 32450, 32447, 32451, 32445, 32454, 32441, 32461, 32428, 32490, 32353, 32766, 29296,
+  0, -29296, -32766, -32353, -32490, -32428, -32461, -32441, -32454, -32445, -32451, -32447, -32450, -32448, -32450, -32448,
+  -32449, -32448, -32449, -32448, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449,
+  -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32449, -32448, -32449, -32448,
+  -32449, -32448, -32450, -32448, -32450, -32447, -32451, -32445, -32454, -32441, -32461, -32428, -32490, -32353, -32766, -29296,
+  0, 29295, 32767, 32353, 32490, 32428, 32461, 32441, 32454, 32445, 32452, 32447, 32451, 32447, 32450, 32448,
+  32450, 32448, 32450, 32447, 32451, 32447, 32452, 32445, 32454, 32441, 32461, 32428, 32490, 32353, 32767, 29295,
+  0, -29295, -32767, -32353, -32490, -32428, -32461, -32441, -32454, -32445, -32452, -32447, -32451, -32447, -32450, -32448,
+  -32450, -32448, -32450, -32447, -32451, -32447, -32452, -32445, -32454, -32441, -32461, -32428, -32490, -32353, -32767, -29295,
+  0, 29295, 32767, 32352, 32490, 32426, 32463, 32437, 32458, 32437, 32463, 32426, 32490, 32352, 32767, 29295,
+  0, -29295, -32767, -32352, -32490, -32426, -32463, -32437, -32458, -32437, -32463, -32426, -32490, -32352, -32767, -29295,
+  0, 29284, 32767, 32326, 32519, 32326, 32767, 29284, 0, -29284, -32767, -32326, -32519, -32326, -32767, -29284,
+  0, 28962, 32767, 28962, 0, -28962, -32767, -28962, 0, 32767, 0, -32767, 0, 0, 0, 0
+};
+
+const int16_t oscFlashTriMip[8192] = {
+  32767, 32735, 32703, 32671, 32639, 32607, 32575, 32543, 32511, 32479, 32447, 32415, 32383, 32351, 32319, 32287,
+  32255, 32223, 32191, 32159, 32127, 32095, 32063, 32031, 31999, 31967, 31935, 31903, 31871, 31839, 31807, 31775,
+  31743, 31711, 31679, 31647, 31615, 31583, 31551, 31519, 31487, 31455, 31423, 31391, 31359, 31327, 31295, 31263,
+  31231, 31199, 31167, 31135, 31103, 31071, 31039, 31007, 30975, 30943, 30911, 30879, 30847, 30815, 30783, 30751,
+  30719, 30687, 30655, 30623, 30591, 30559, 30527, 30495, 30463, 30431, 30399, 30367, 30335, 30303, 30271, 30239,
+  30207, 30175, 30143, 30111, 30079, 30047, 30015, 29983, 29951, 29919, 29887, 29855, 29823, 29791, 29759, 29727,
+  29695, 29663, 29631, 29599, 29567, 29535, 29503, 29471, 29439, 29407, 29375, 29343, 29311, 29279, 29247, 29215,
+  29183, 29151, 29119, 29087, 29055, 29023, 28991, 28959, 28927, 28895, 28863, 28831, 28799, 28767, 28735, 28703,
+  28671, 28639, 28607, 28575, 28543, 28511, 28479, 28447, 28415, 28383, 28351, 28319, 28287, 28255, 28223, 28191,
+  28159, 28127, 28095, 28063, 28031, 27999, 27967, 27935, 27903, 27871, 27839, 27807, 27775, 27743, 27711, 27679,
+  27647, 27615, 27583, 27551, 27519, 27487, 27455, 27423, 27391, 27359, 27327, 27295, 27263, 27231, 27199, 27167,
+  27135, 27103, 27071, 27039, 27007, 26975, 26943, 26911, 26879, 26847, 26815, 26783, 26751, 26719, 26687, 26655,
+  26623, 26591, 26559, 26527, 26495, 26463, 26431, 26399, 26367, 26335, 26303, 26271, 26239, 26207, 26175, 26143,
+  26111, 26079, 26047, 26015, 25983, 25951, 25919, 25887, 25855, 25823, 25791, 25759, 25727, 25695, 25663, 25631,
+  25599, 25567, 25535, 25503, 25471, 25439, 25407, 25375, 25343, 25311, 25279, 25247, 25215, 25183, 25151, 25119,
+  25087, 25055, 25023, 24991, 24959, 24927, 24895, 24863, 24831, 24799, 24767, 24735, 24703, 24671, 24639, 24607,
+  24575, 24543, 24511, 24479, 24447, 24415, 24383, 24351, 24319, 24287, 24255, 24223, 24191, 24159, 24127, 24095,
+  24063, 24031, 23999, 23967, 23935, 23903, 23871, 23839, 23807, 23775, 23743, 23711, 23679, 23647, 23615, 23583,
+  23551, 23519, 23487, 23455, 23423, 23391, 23359, 23327, 23295, 23263, 23231, 23199, 23167, 23135, 23103, 23071,
+  23039, 23007, 22975, 22943, 22911, 22879, 22847, 22815, 22783, 22751, 22719, 22687, 22655, 22623, 22591, 22559,
+  22527, 22495, 22463, 22431, 22399, 22367, 22335, 22303, 22271, 22239, 22207, 22175, 22143, 22111, 22079, 22047,
+  22015, 21983, 21951, 21919, 21887, 21855, 21823, 21791, 21759, 21727, 21695, 21663, 21631, 21599, 21567, 21535,
+  21503, 21471, 21439, 21407, 21375, 21343, 21311, 21279, 21247, 21215, 21183, 21151, 21119, 21087, 21055, 21023,
+  20991, 20959, 20927, 20895, 20863, 20831, 20799, 20767, 20735, 20703, 20671, 20639, 20607, 20575, 20543, 20511,
+  20479, 20447, 20415, 20383, 20351, 20319, 20287, 20255, 20223, 20191, 20159, 20127, 20095, 20063, 20031, 19999,
+  19967, 19935, 19903, 19871, 19839, 19807, 19775, 19743, 19711, 19679, 19647, 19615, 19583, 19551, 19519, 19487,
+  19455, 19423, 19391, 19359, 19327, 19295, 19263, 19231, 19199, 19167, 19135, 19103, 19071, 19039, 19007, 18975,
+  18943, 18911, 18879, 18847, 18815, 18783, 18751, 18719, 18687, 18655, 18623, 18591, 18559, 18527, 18495, 18463,
+  18431, 18399, 18367, 18335, 18303, 18271, 18239, 18207, 18175, 18143, 18111, 18079, 18047, 18015, 17983, 17951,
+  17919, 17887, 17855, 17823, 17791, 17759, 17727, 17695, 17663, 17631, 17599, 17567, 17535, 17503, 17471, 17439,
+  17407, 17375, 17343, 17311, 17279, 17247, 17215, 17183, 17151, 17119, 17087, 17055, 17023, 16991, 16959, 16927,
+  16895, 16863, 16831, 16799, 16767, 16735, 16703, 16671, 16639, 16607, 16575, 16543, 16511, 16479, 16447, 16415,
+  16383, 16351, 16319, 16287, 16255, 16223, 16191, 16159, 16127, 16095, 16063, 16031, 15999, 15967, 15935, 15903,
+  15871, 15839, 15807, 15775, 15743, 15711, 15679, 15647, 15615, 15583, 15551, 15519, 15487, 15455, 15423, 15391,
+  15359, 15327, 15295, 15263, 15231, 15199, 15167, 15135, 15103, 15071, 15039, 15007, 14975, 14943, 14911, 14879,
+  14847, 14815, 14783, 14751, 14719, 14687, 14655, 14623, 14591, 14559, 14527, 14495, 14463, 14431, 14399, 14367,
+  14335, 14303, 14271, 14239, 14207, 14175, 14143, 14111, 14079, 14047, 14015, 13983, 13951, 13919, 13887, 13855,
+  13823, 13791, 13759, 13727, 13695, 13663, 13631, 13599, 13567, 13535, 13503, 13471, 13439, 13407, 13375, 13343,
+  13311, 13279, 13247, 13215, 13183, 13151, 13119, 13087, 13055, 13023, 12991, 12959, 12927, 12895, 12863, 12831,
+  12799, 12767, 12735, 12703, 12671, 12639, 12607, 12575, 12543, 12511, 12479, 12447, 12415, 12383, 12351, 12319,
+  12287, 12255, 12223, 12191, 12159, 12127, 12095, 12063, 12031, 11999, 11967, 11935, 11903, 11871, 11839, 11807,
+  11775, 11743, 11711, 11679, 11647, 11615, 11583, 11551, 11519, 11487, 11455, 11423, 11391, 11359, 11327, 11295,
+  11263, 11231, 11199, 11167, 11135, 11103, 11071, 11039, 11007, 10975, 10943, 10911, 10879, 10847, 10815, 10783,
+  10751, 10719, 10687, 10655, 10623, 10591, 10559, 10527, 10495, 10463, 10431, 10399, 10367, 10335, 10303, 10271,
+  10239, 10207, 10175, 10143, 10111, 10079, 10047, 10015, 9983, 9951, 9919, 9887, 9855, 9823, 9791, 9759,
+  9727, 9695, 9663, 9631, 9599, 9567, 9535, 9503, 9471, 9439, 9407, 9375, 9343, 9311, 9279, 9247,
+  9215, 9183, 9151, 9119, 9087, 9055, 9023, 8991, 8959, 8927, 8895, 8863, 8831, 8799, 8767, 8735,
+  8703, 8671, 8639, 8607, 8575, 8543, 8511, 8479, 8447, 8415, 8383, 8351, 8319, 8287, 8255, 8223,
+  8191, 8159, 8127, 8095, 8063, 8031, 7999, 7967, 7935, 7903, 7871, 7839, 7807, 7775, 7743, 7711,
+  7679, 7647, 7615, 7583, 7551, 7519, 7487, 7455, 7423, 7391, 7359, 7327, 7295, 7263, 7231, 7199,
+  7167, 7135, 7103, 7071, 7039, 7007, 6975, 6943, 6911, 6879, 6847, 6815, 6783, 6751, 6719, 6687,
+  6655, 6623, 6591, 6559, 6527, 6495, 6463, 6431, 6399, 6367, 6335, 6303, 6271, 6239, 6207, 6175,
+  6143, 6111, 6079, 6047, 6015, 5983, 5951, 5919, 5887, 5855, 5823, 5791, 5759, 5727, 5695, 5663,
+  5631, 5599, 5567, 5535, 5503, 5471, 5439, 5407, 5375, 5343, 5311, 5279, 5247, 5215, 5183, 5151,
+  5119, 5087, 5055, 5023, 4991, 4959, 4927, 4895, 4863, 4831, 4799, 4767, 4735, 4703, 4671, 4639,
+  4607, 4575, 4543, 4511, 4479, 4447, 4415, 4383, 4351, 4319, 4287, 4255, 4223, 4191, 4159, 4127,
+  4095, 4063, 4031, 3999, 3967, 3935, 3903, 3871, 3839, 3807, 3775, 3743, 3711, 3679, 3647, 3615,
+  3583, 3551, 3519, 3487, 3455, 3423, 3391, 3359, 3327, 3295, 3263, 3231, 3199, 3167, 3135, 3103,
+  3071, 3039, 3007, 2975, 2943, 2911, 2879, 2847, 2815, 2783, 2751, 2719, 2687, 2655, 2623, 2591,
+  2559, 2527, 2495, 2463, 2431, 2399, 2367, 2335, 2303, 2271, 2239, 2207, 2175, 2143, 2111, 2079,
+  2047, 2015, 1983, 1951, 1919, 1887, 1855, 1823, 1791, 1759, 1727, 1695, 1663, 1631, 1599, 1567,
+  1535, 1503, 1471, 1439, 1407, 1375, 1343, 1311, 1279, 1247, 1215, 1183, 1151, 1119, 1087, 1055,
+  1023, 991, 959, 927, 895, 863, 831, 799, 767, 735, 703, 671, 639, 607, 575, 543,
+  511, 479, 447, 415, 383, 351, 319, 287, 255, 223, 191, 159, 127, 95, 63, 32,
+  0, -32, -64, -95, -127, -159, -191, -223, -255, -287, -319, -351, -383, -415, -447, -479,
+  -511, -543, -575, -607, -639, -671, -703, -735, -767, -799, -831, -863, -895, -927, -959, -991,
+  -1023, -1055, -1087, -1119, -1151, -1183, -1215, -1247, -1279, -1311, -1343, -1375, -1407, -1439, -1471, -1503,
+  -1535, -1567, -1599, -1631, -1663, -1695, -1727, -1759, -1791, -1823, -1855, -1887, -1919, -1951, -1983, -2015,
+  -2047, -2079, -2111, -2143, -2175, -2207, -2239, -2271, -2303, -2335, -2367, -2399, -2431, -2463, -2495, -2527,
+  -2559, -2591, -2623, -2655, -2687, -2719, -2751, -2783, -2815, -2847, -2879, -2911, -2943, -2975, -3007, -3039,
+  -3071, -3103, -3135, -3167, -3199, -3231, -3263, -3295, -3327, -3359, -3391, -3423, -3455, -3487, -3519, -3551,
+  -3583, -3615, -3647, -3679, -3711, -3743, -3775, -3807, -3839, -3871, -3903, -3935, -3967, -3999, -4031, -4063,
+  -4095, -4127, -4159, -4191, -4223, -4255, -4287, -4319, -4351, -4383, -4415, -4447, -4479, -4511, -4543, -4575,
+  -4607, -4639, -4671, -4703, -4735, -4767, -4799, -4831, -4863, -4895, -4927, -4959, -4991, -5023, -5055, -5087,
+  -5119, -5151, -5183, -5215, -5247, -5279, -5311, -5343, -5375, -5407, -5439, -5471, -5503, -5535, -5567, -5599,
+  -5631, -5663, -5695, -5727, -5759, -5791, -5823, -5855, -5887, -5919, -5951, -5983, -6015, -6047, -6079, -6111,
+  -6143, -6175, -6207, -6239, -6271, -6303, -6335, -6367, -6399, -6431, -6463, -6495, -6527, -6559, -6591, -6623,
+  -6655, -6687, -6719, -6751, -6783, -6815, -6847, -6879, -6911, -6943, -6975, -7007, -7039, -7071, -7103, -7135,
+  -7167, -7199, -7231, -7263, -7295, -7327, -7359, -7391, -7423, -7455, -7487, -7519, -7551, -7583, -7615, -7647,
+  -7679, -7711, -7743, -7775, -7807, -7839, -7871, -7903, -7935, -7967, -7999, -8031, -8063, -8095, -8127, -8159,
+  -8191, -8223, -8255, -8287, -8319, -8351, -8383, -8415, -8447, -8479, -8511, -8543, -8575, -8607, -8639, -8671,
+  -8703, -8735, -8767, -8799, -8831, -8863, -8895, -8927, -8959, -8991, -9023, -9055, -9087, -9119, -9151, -9183,
+  -9215, -9247, -9279, -9311, -9343, -9375, -9407, -9439, -9471, -9503, -9535, -9567, -9599, -9631, -9663, -9695,
+  -9727, -9759, -9791, -9823, -9855, -9887, -9919, -9951, -9983, -10015, -10047, -10079, -10111, -10143, -10175, -10207,
+  -10239, -10271, -10303, -10335, -10367, -10399, -10431, -10463, -10495, -10527, -10559, -10591, -10623, -10655, -10687, -10719,
+  -10751, -10783, -10815, -10847, -10879, -10911, -10943, -10975, -11007, -11039, -11071, -11103, -11135, -11167, -11199, -11231,
+  -11263, -11295, -11327, -11359, -11391, -11423, -11455, -11487, -11519, -11551, -11583, -11615, -11647, -11679, -11711, -11743,
+  -11775, -11807, -11839, -11871, -11903, -11935, -11967, -11999, -12031, -12063, -12095, -12127, -12159, -12191, -12223, -12255,
+  -12287, -12319, -12351, -12383, -12415, -12447, -12479, -12511, -12543, -12575, -12607, -12639, -12671, -12703, -12735, -12767,
+  -12799, -12831, -12863, -12895, -12927, -12959, -12991, -13023, -13055, -13087, -13119, -13151, -13183, -13215, -13247, -13279,
+  -13311, -13343, -13375, -13407, -13439, -13471, -13503, -13535, -13567, -13599, -13631, -13663, -13695, -13727, -13759, -13791,
+  -13823, -13855, -13887, -13919, -13951, -13983, -14015, -14047, -14079, -14111, -14143, -14175, -14207, -14239, -14271, -14303,
+  -14335, -14367, -14399, -14431, -14463, -14495, -14527, -14559, -14591, -14623, -14655, -14687, -14719, -14751, -14783, -14815,
+  -14847, -14879, -14911, -14943, -14975, -15007, -15039, -15071, -15103, -15135, -15167, -15199, -15231, -15263, -15295, -15327,
+  -15359, -15391, -15423, -15455, -15487, -15519, -15551, -15583, -15615, -15647, -15679, -15711, -15743, -15775, -15807, -15839,
+  -15871, -15903, -15935, -15967, -15999, -16031, -16063, -16095, -16127, -16159, -16191, -16223, -16255, -16287, -16319, -16351,
+  -16383, -16415, -16447, -16479, -16511, -16543, -16575, -16607, -16639, -16671, -16703, -16735, -16767, -16799, -16831, -16863,
+  -16895, -16927, -16959, -16991, -17023, -17055, -17087, -17119, -17151, -17183, -17215, -17247, -17279, -17311, -17343, -17375,
+  -17407, -17439, -17471, -17503, -17535, -17567, -17599, -17631, -17663, -17695, -17727, -17759, -17791, -17823, -17855, -17887,
+  -17919, -17951, -17983, -18015, -18047, -18079, -18111, -18143, -18175, -18207, -18239, -18271, -18303, -18335, -18367, -18399,
+  -18431, -18463, -18495, -18527, -18559, -18591, -18623, -18655, -18687, -18719, -18751, -18783, -18815, -18847, -18879, -18911,
+  -18943, -18975, -19007, -19039, -19071, -19103, -19135, -19167, -19199, -19231, -19263, -19295, -19327, -19359, -19391, -19423,
+  -19455, -19487, -19519, -19551, -19583, -19615, -19647, -19679, -19711, -19743, -19775, -19807, -19839, -19871, -19903, -19935,
+  -19967, -19999, -20031, -20063, -20095, -20127, -20159, -20191, -20223, -20255, -20287, -20319, -20351, -20383, -20415, -20447,
+  -20479, -20511, -20543, -20575, -20607, -20639, -20671, -20703, -20735, -20767, -20799, -20831, -20863, -20895, -20927, -20959,
+  -20991, -21023, -21055, -21087, -21119, -21151, -21183, -21215, -21247, -21279, -21311, -21343, -21375, -21407, -21439, -21471,
+  -21503, -21535, -21567, -21599, -21631, -21663, -21695, -21727, -21759, -21791, -21823, -21855, -21887, -21919, -21951, -21983,
+  -22015, -22047, -22079, -22111, -22143, -22175, -22207, -22239, -22271, -22303, -22335, -22367, -22399, -22431, -22463, -22495,
+  -22527, -22559, -22591, -22623, -22655, -22687, -22719, -22751, -22783, -22815, -22847, -22879, -22911, -22943, -22975, -23007,
+  -23039, -23071, -23103, -23135, -23167, -23199, -23231, -23263, -23295, -23327, -23359, -23391, -23423, -23455, -23487, -23519,
+  -23551, -23583, -23615, -23647, -23679, -23711, -23743, -23775, -23807, -23839, -23871, -23903, -23935, -23967, -23999, -24031,
+  -24063, -24095, -24127, -24159, -24191, -24223, -24255, -24287, -24319, -24351, -24383, -24415, -24447, -24479, -24511, -24543,
+  -24575, -24607, -24639, -24671, -24703, -24735, -24767, -24799, -24831, -24863, -24895, -24927, -24959, -24991, -25023, -25055,
+  -25087, -25119, -25151, -25183, -25215, -25247, -25279, -25311, -25343, -25375, -25407, -25439, -25471, -25503, -25535, -25567,
+  -25599, -25631, -25663, -25695, -25727, -25759, -25791, -25823, -25855, -25887, -25919, -25951, -25983, -26015, -26047, -26079,
+  -26111, -26143, -26175, -26207, -26239, -26271, -26303, -26335, -26367, -26399, -26431, -26463, -26495, -26527, -26559, -26591,
+  -26623, -26655, -26687, -26719, -26751, -26783, -26815, -26847, -26879, -26911, -26943, -26975, -27007, -27039, -27071, -27103,
+  -27135, -27167, -27199, -27231, -27263, -27295, -27327, -27359, -27391, -27423, -27455, -27487, -27519, -27551, -27583, -27615,
+  -27647, -27679, -27711, -27743, -27775, -27807, -27839, -27871, -27903, -27935, -27967, -27999, -28031, -28063, -28095, -28127,
+  -28159, -28191, -28223, -28255, -28287, -28319, -28351, -28383, -28415, -28447, -28479, -28511, -28543, -28575, -28607, -28639,
+  -28671, -28703, -28735, -28767, -28799, -28831, -28863, -28895, -28927, -28959, -28991, -29023, -29055, -29087, -29119, -29151,
+  -29183, -29215, -29247, -29279, -29311, -29343, -29375, -29407, -29439, -29471, -29503, -29535, -29567, -29599, -29631, -29663,
+  -29695, -29727, -29759, -29791, -29823, -29855, -29887, -29919, -29951, -29983, -30015, -30047, -30079, -30111, -30143, -30175,
+  -30207, -30239, -30271, -30303, -30335, -30367, -30399, -30431, -30463, -30495, -30527, -30559, -30591, -30623, -30655, -30687,
+  -30719, -30751, -30783, -30815, -30847, -30879, -30911, -30943, -30975, -31007, -31039, -31071, -31103, -31135, -31167, -31199,
+  -31231, -31263, -31295, -31327, -31359, -31391, -31423, -31455, -31487, -31519, -31551, -31583, -31615, -31647, -31679, -31711,
+  -31743, -31775, -31807, -31839, -31871, -31903, -31935, -31967, -31999, -32031, -32063, -32095, -32127, -32159, -32191, -32223,
+  -32255, -32287, -32319, -32351, -32383, -32415, -32447, -32479, -32511, -32543, -32575, -32607, -32639, -32671, -32703, -32735,
+  -32767, -32735, -32703, -32671, -32639, -32607, -32575, -32543, -32511, -32479, -32447, -32415, -32383, -32351, -32319, -32287,
+  -32255, -32223, -32191, -32159, -32127, -32095, -32063, -32031, -31999, -31967, -31935, -31903, -31871, -31839, -31807, -31775,
+  -31743, -31711, -31679, -31647, -31615, -31583, -31551, -31519, -31487, -31455, -31423, -31391, -31359, -31327, -31295, -31263,
+  -31231, -31199, -31167, -31135, -31103, -31071, -31039, -31007, -30975, -30943, -30911, -30879, -30847, -30815, -30783, -30751,
+  -30719, -30687, -30655, -30623, -30591, -30559, -30527, -30495, -30463, -30431, -30399, -30367, -30335, -30303, -30271, -30239,
+  -30207, -30175, -30143, -30111, -30079, -30047, -30015, -29983, -29951, -29919, -29887, -29855, -29823, -29791, -29759, -29727,
+  -29695, -29663, -29631, -29599, -29567, -29535, -29503, -29471, -29439, -29407, -29375, -29343, -29311, -29279, -29247, -29215,
+  -29183, -29151, -29119, -29087, -29055, -29023, -28991, -28959, -28927, -28895, -28863, -28831, -28799, -28767, -28735, -28703,
+  -28671, -28639, -28607, -28575, -28543, -28511, -28479, -28447, -28415, -28383, -28351, -28319, -28287, -28255, -28223, -28191,
+  -28159, -28127, -28095, -28063, -28031, -27999, -27967, -27935, -27903, -27871, -27839, -27807, -27775, -27743, -27711, -27679,
+  -27647, -27615, -27583, -27551, -27519, -27487, -27455, -27423, -27391, -27359, -27327, -27295, -27263, -27231, -27199, -27167,
+  -27135, -27103, -27071, -27039, -27007, -26975, -26943, -26911, -26879, -26847, -26815, -26783, -26751, -26719, -26687, -26655,
+  -26623, -26591, -26559, -26527, -26495, -26463, -26431, -26399, -26367, -26335, -26303, -26271, -26239, -26207, -26175, -26143,
+  -26111, -26079, -26047, -26015, -25983, -25951, -25919, -25887, -25855, -25823, -25791, -25759, -25727, -25695, -25663, -25631,
+  -25599, -25567, -25535, -25503, -25471, -25439, -25407, -25375, -25343, -25311, -25279, -25247, -25215, -25183, -25151, -25119,
+  -25087, -25055, -25023, -24991, -24959, -24927, -24895, -24863, -24831, -24799, -24767, -24735, -24703, -24671, -24639, -24607,
+  -24575, -24543, -24511, -24479, -24447, -24415, -24383, -24351, -24319, -24287, -24255, -24223, -24191, -24159, -24127, -24095,
+  -24063, -24031, -23999, -23967, -23935, -23903, -23871, -23839, -23807, -23775, -23743, -23711, -23679, -23647, -23615, -23583,
+  -23551, -23519, -23487, -23455, -23423, -23391, -23359, -23327, -23295, -23263, -23231, -23199, -23167, -23135, -23103, -23071,
+  -23039, -23007, -22975, -22943, -22911, -22879, -22847, -22815, -22783, -22751, -22719, -22687, -22655, -22623, -22591, -22559,
+  -22527, -22495, -22463, -22431, -22399, -22367, -22335, -22303, -22271, -22239, -22207, -22175, -22143, -22111, -22079, -22047,
+  -22015, -21983, -21951, -21919, -21887, -21855, -21823, -21791, -21759, -21727, -21695, -21663, -21631, -21599, -21567, -21535,
+  -21503, -21471, -21439, -21407, -21375, -21343, -21311, -21279, -21247, -21215, -21183, -21151, -21119, -21087, -21055, -21023,
+  -20991, -20959, -20927, -20895, -20863, -20831, -20799, -20767, -20735, -20703, -20671, -20639, -20607, -20575, -20543, -20511,
+  -20479, -20447, -20415, -20383, -20351, -20319, -20287, -20255, -20223, -20191, -20159, -20127, -20095, -20063, -20031, -19999,
+  -19967, -19935, -19903, -19871, -19839, -19807, -19775, -19743, -19711, -19679, -19647, -19615, -19583, -19551, -19519, -19487,
+  -19455, -19423, -19391, -19359, -19327, -19295, -19263, -19231, -19199, -19167, -19135, -19103, -19071, -19039, -19007, -18975,
+  -18943, -18911, -18879, -18847, -18815, -18783, -18751, -18719, -18687, -18655, -18623, -18591, -18559, -18527, -18495, -18463,
+  -18431, -18399, -18367, -18335, -18303, -18271, -18239, -18207, -18175, -18143, -18111, -18079, -18047, -18015, -17983, -17951,
+  -17919, -17887, -17855, -17823, -17791, -17759, -17727, -17695, -17663, -17631, -17599, -17567, -17535, -17503, -17471, -17439,
+  -17407, -17375, -17343, -17311, -17279, -17247, -17215, -17183, -17151, -17119, -17087, -17055, -17023, -16991, -16959, -16927,
+  -16895, -16863, -16831, -16799, -16767, -16735, -16703, -16671, -16639, -16607, -16575, -16543, -16511, -16479, -16447, -16415,
+  -16383, -16351, -16319, -16287, -16255, -16223, -16191, -16159, -16127, -16095, -16063, -16031, -15999, -15967, -15935, -15903,
+  -15871, -15839, -15807, -15775, -15743, -15711, -15679, -15647, -15615, -15583, -15551, -15519, -15487, -15455, -15423, -15391,
+  -15359, -15327, -15295, -15263, -15231, -15199, -15167, -15135, -15103, -15071, -15039, -15007, -14975, -14943, -14911, -14879,
+  -14847, -14815, -14783, -14751, -14719, -14687, -14655, -14623, -14591, -14559, -14527, -14495, -14463, -14431, -14399, -14367,
+  -14335, -14303, -14271, -14239, -14207, -14175, -14143, -14111, -14079, -14047, -14015, -13983, -13951, -13919, -13887, -13855,
+  -13823, -13791, -13759, -13727, -13695, -13663, -13631, -13599, -13567, -13535, -13503, -13471, -13439, -13407, -13375, -13343,
+  -13311, -13279, -13247, -13215, -13183, -13151, -13119, -13087, -13055, -13023, -12991, -12959, -12927, -12895, -12863, -12831,
+  -12799, -12767, -12735, -12703, -12671, -12639, -12607, -12575, -12543, -12511, -12479, -12447, -12415, -12383, -12351, -12319,
+  -12287, -12255, -12223, -12191, -12159, -12127, -12095, -12063, -12031, -11999, -11967, -11935, -11903, -11871, -11839, -11807,
+  -11775, -11743, -11711, -11679, -11647, -11615, -11583, -11551, -11519, -11487, -11455, -11423, -11391, -11359, -11327, -11295,
+  -11263, -11231, -11199, -11167, -11135, -11103, -11071, -11039, -11007, -10975, -10943, -10911, -10879, -10847, -10815, -10783,
+  -10751, -10719, -10687, -10655, -10623, -10591, -10559, -10527, -10495, -10463, -10431, -10399, -10367, -10335, -10303, -10271,
+  -10239, -10207, -10175, -10143, -10111, -10079, -10047, -10015, -9983, -9951, -9919, -9887, -9855, -9823, -9791, -9759,
+  -9727, -9695, -9663, -9631, -9599, -9567, -9535, -9503, -9471, -9439, -9407, -9375, -9343, -9311, -9279, -9247,
+  -9215, -9183, -9151, -9119, -9087, -9055, -9023, -8991, -8959, -8927, -8895, -8863, -8831, -8799, -8767, -8735,
+  -8703, -8671, -8639, -8607, -8575, -8543, -8511, -8479, -8447, -8415, -8383, -8351, -8319, -8287, -8255, -8223,
+  -8191, -8159, -8127, -8095, -8063, -8031, -7999, -7967, -7935, -7903, -7871, -7839, -7807, -7775, -7743, -7711,
+  -7679, -7647, -7615, -7583, -7551, -7519, -7487, -7455, -7423, -7391, -7359, -7327, -7295, -7263, -7231, -7199,
+  -7167, -7135, -7103, -7071, -7039, -7007, -6975, -6943, -6911, -6879, -6847, -6815, -6783, -6751, -6719, -6687,
+  -6655, -6623, -6591, -6559, -6527, -6495, -6463, -6431, -6399, -6367, -6335, -6303, -6271, -6239, -6207, -6175,
+  -6143, -6111, -6079, -6047, -6015, -5983, -5951, -5919, -5887, -5855, -5823, -5791, -5759, -5727, -5695, -5663,
+  -5631, -5599, -5567, -5535, -5503, -5471, -5439, -5407, -5375, -5343, -5311, -5279, -5247, -5215, -5183, -5151,
+  -5119, -5087, -5055, -5023, -4991, -4959, -4927, -4895, -4863, -4831, -4799, -4767, -4735, -4703, -4671, -4639,
+  -4607, -4575, -4543, -4511, -4479, -4447, -4415, -4383, -4351, -4319, -4287, -4255, -4223, -4191, -4159, -4127,
+  -4095, -4063, -4031, -3999, -3967, -3935, -3903, -3871, -3839, -3807, -3775, -3743, -3711, -3679, -3647, -3615,
+  -3583, -3551, -3519, -3487, -3455, -3423, -3391, -3359, -3327, -3295, -3263, -3231, -3199, -3167, -3135, -3103,
+  -3071, -3039, -3007, -2975, -2943, -2911, -2879, -2847, -2815, -2783, -2751, -2719, -2687, -2655, -2623, -2591,
+  -2559, -2527, -2495, -2463, -2431, -2399, -2367, -2335, -2303, -2271, -2239, -2207, -2175, -2143, -2111, -2079,
+  -2047, -2015, -1983, -1951, -1919, -1887, -1855, -1823, -1791, -1759, -1727, -1695, -1663, -1631, -1599, -1567,
+  -1535, -1503, -1471, -1439, -1407, -1375, -1343, -1311, -1279, -1247, -1215, -1183, -1151, -1119, -1087, -1055,
+  -1023, -991, -959, -927, -895, -863, -831, -799, -767, -735, -703, -671, -639, -607, -575, -543,
+  -511, -479, -447, -415, -383, -351, -319, -287, -255, -223, -191, -159, -127, -95, -63, -32,
+  0, 32, 64, 95, 127, 159, 191, 223, 255, 287, 319, 351, 383, 415, 447, 479,
+  511, 543, 575, 607, 639, 671, 703, 735, 767, 799, 831, 863, 895, 927, 959, 991,
+  1023, 1055, 1087, 1119, 1151, 1183, 1215, 1247, 1279, 1311, 1343, 1375, 1407, 1439, 1471, 1503,
+  1535, 1567, 1599, 1631, 1663, 1695, 1727, 1759, 1791, 1823, 1855, 1887, 1919, 1951, 1983, 2015,
+  2047, 2079, 2111, 2143, 2175, 2207, 2239, 2271, 2303, 2335, 2367, 2399, 2431, 2463, 2495, 2527,
+  2559, 2591, 2623, 2655, 2687, 2719, 2751, 2783, 2815, 2847, 2879, 2911, 2943, 2975, 3007, 3039,
+  3071, 3103, 3135, 3167, 3199, 3231, 3263, 3295, 3327, 3359, 3391, 3423, 3455, 3487, 3519, 3551,
+  3583, 3615, 3647, 3679, 3711, 3743, 3775, 3807, 3839, 3871, 3903, 3935, 3967, 3999, 4031, 4063,
+  4095, 4127, 4159, 4191, 4223, 4255, 4287, 4319, 4351, 4383, 4415, 4447, 4479, 4511, 4543, 4575,
+  4607, 4639, 4671, 4703, 4735, 4767, 4799, 4831, 4863, 4895, 4927, 4959, 4991, 5023, 5055, 5087,
+  5119, 5151, 5183, 5215, 5247, 5279, 5311, 5343, 5375, 5407, 5439, 5471, 5503, 5535, 5567, 5599,
+  5631, 5663, 5695, 5727, 5759, 5791, 5823, 5855, 5887, 5919, 5951, 5983, 6015, 6047, 6079, 6111,
+  6143, 6175, 6207, 6239, 6271, 6303, 6335, 6367, 6399, 6431, 6463, 6495, 6527, 6559, 6591, 6623,
+  6655, 6687, 6719, 6751, 6783, 6815, 6847, 6879, 6911, 6943, 6975, 7007, 7039, 7071, 7103, 7135,
+  7167, 7199, 7231, 7263, 7295, 7327, 7359, 7391, 7423, 7455, 7487, 7519, 7551, 7583, 7615, 7647,
+  7679, 7711, 7743, 7775, 7807, 7839, 7871, 7903, 7935, 7967, 7999, 8031, 8063, 8095, 8127, 8159,
+  8191, 8223, 8255, 8287, 8319, 8351, 8383, 8415, 8447, 8479, 8511, 8543, 8575, 8607, 8639, 8671,
+  8703, 8735, 8767, 8799, 8831, 8863, 8895, 8927, 8959, 8991, 9023, 9055, 9087, 9119, 9151, 9183,
+  9215, 9247, 9279, 9311, 9343, 9375, 9407, 9439, 9471, 9503, 9535, 9567, 9599, 9631, 9663, 9695,
+  9727, 9759, 9791, 9823, 9855, 9887, 9919, 9951, 9983, 10015, 10047, 10079, 10111, 10143, 10175, 10207,
+  10239, 10271, 10303, 10335, 10367, 10399, 10431, 10463, 10495, 10527, 10559, 10591, 10623, 10655, 10687, 10719,
+  10751, 10783, 10815, 10847, 10879, 10911, 10943, 10975, 11007, 11039, 11071, 11103, 11135, 11167, 11199, 11231,
+  11263, 11295, 11327, 11359, 11391, 11423, 11455, 11487, 11519, 11551, 11583, 11615, 11647, 11679, 11711, 11743,
+  11775, 11807, 11839, 11871, 11903, 11935, 11967, 11999, 12031, 12063, 12095, 12127, 12159, 12191, 12223, 12255,
+  12287, 12319, 12351, 12383, 12415, 12447, 12479, 12511, 12543, 12575, 12607, 12639, 12671, 12703, 12735, 12767,
+  12799, 12831, 12863, 12895, 12927, 12959, 12991, 13023, 13055, 13087, 13119, 13151, 13183, 13215, 13247, 13279,
+  13311, 13343, 13375, 13407, 13439, 13471, 13503, 13535, 13567, 13599, 13631, 13663, 13695, 13727, 13759, 13791,
+  13823, 13855, 13887, 13919, 13951, 13983, 14015, 14047, 14079, 14111, 14143, 14175, 14207, 14239, 14271, 14303,
+  14335, 14367, 14399, 14431, 14463, 14495, 14527, 14559, 14591, 14623, 14655, 14687, 14719, 14751, 14783, 14815,
+  14847, 14879, 14911, 14943, 14975, 15007, 15039, 15071, 15103, 15135, 15167, 15199, 15231, 15263, 15295, 15327,
+  15359, 15391, 15423, 15455, 15487, 15519, 15551, 15583, 15615, 15647, 15679, 15711, 15743, 15775, 15807, 15839,
+  15871, 15903, 15935, 15967, 15999, 16031, 16063, 16095, 16127, 16159, 16191, 16223, 16255, 16287, 16319, 16351,
+  16383, 16415, 16447, 16479, 16511, 16543, 16575, 16607, 16639, 16671, 16703, 16735, 16767, 16799, 16831, 16863,
+  16895, 16927, 16959, 16991, 17023, 17055, 17087, 17119, 17151, 17183, 17215, 17247, 17279, 17311, 17343, 17375,
+  17407, 17439, 17471, 17503, 17535, 17567, 17599, 17631, 17663, 17695, 17727, 17759, 17791, 17823, 17855, 17887,
+  17919, 17951, 17983, 18015, 18047, 18079, 18111, 18143, 18175, 18207, 18239, 18271, 18303, 18335, 18367, 18399,
+  18431, 18463, 18495, 18527, 18559, 18591, 18623, 18655, 18687, 18719, 18751, 18783, 18815, 18847, 18879, 18911,
+  18943, 18975, 19007, 19039, 19071, 19103, 19135, 19167, 19199, 19231, 19263, 19295, 19327, 19359, 19391, 19423,
+  19455, 19487, 19519, 19551, 19583, 19615, 19647, 19679, 19711, 19743, 19775, 19807, 19839, 19871, 19903, 19935,
+  19967, 19999, 20031, 20063, 20095, 20127, 20159, 20191, 20223, 20255, 20287, 20319, 20351, 20383, 20415, 20447,
+  20479, 20511, 20543, 20575, 20607, 20639, 20671, 20703, 20735, 20767, 20799, 20831, 20863, 20895, 20927, 20959,
+  20991, 21023, 21055, 21087, 21119, 21151, 21183, 21215, 21247, 21279, 21311, 21343, 21375, 21407, 21439, 21471,
+  21503, 21535, 21567, 21599, 21631, 21663, 21695, 21727, 21759, 21791, 21823, 21855, 21887, 21919, 21951, 21983,
+  22015, 22047, 22079, 22111, 22143, 22175, 22207, 22239, 22271, 22303, 22335, 22367, 22399, 22431, 22463, 22495,
+  22527, 22559, 22591, 22623, 22655, 22687, 22719, 22751, 22783, 22815, 22847, 22879, 22911, 22943, 22975, 23007,
+  23039, 23071, 23103, 23135, 23167, 23199, 23231, 23263, 23295, 23327, 23359, 23391, 23423, 23455, 23487, 23519,
+  23551, 23583, 23615, 23647, 23679, 23711, 23743, 23775, 23807, 23839, 23871, 23903, 23935, 23967, 23999, 24031,
+  24063, 24095, 24127, 24159, 24191, 24223, 24255, 24287, 24319, 24351, 24383, 24415, 24447, 24479, 24511, 24543,
+  24575, 24607, 24639, 24671, 24703, 24735, 24767, 24799, 24831, 24863, 24895, 24927, 24959, 24991, 25023, 25055,
+  25087, 25119, 25151, 25183, 25215, 25247, 25279, 25311, 25343, 25375, 25407, 25439, 25471, 25503, 25535, 25567,
+  25599, 25631, 25663, 25695, 25727, 25759, 25791, 25823, 25855, 25887, 25919, 25951, 25983, 26015, 26047, 26079,
+  26111, 26143, 26175, 26207, 26239, 26271, 26303, 26335, 26367, 26399, 26431, 26463, 26495, 26527, 26559, 26591,
+  26623, 26655, 26687, 26719, 26751, 26783, 26815, 26847, 26879, 26911, 26943, 26975, 27007, 27039, 27071, 27103,
+  27135, 27167, 27199, 27231, 27263, 27295, 27327, 27359, 27391, 27423, 27455, 27487, 27519, 27551, 27583, 27615,
+  27647, 27679, 27711, 27743, 27775, 27807, 27839, 27871, 27903, 27935, 27967, 27999, 28031, 28063, 28095, 28127,
+  28159, 28191, 28223, 28255, 28287, 28319, 28351, 28383, 28415, 28447, 28479, 28511, 28543, 28575, 28607, 28639,
+  28671, 28703, 28735, 28767, 28799, 28831, 28863, 28895, 28927, 28959, 28991, 29023, 29055, 29087, 29119, 29151,
+  29183, 29215, 29247, 29279, 29311, 29343, 29375, 29407, 29439, 29471, 29503, 29535, 29567, 29599, 29631, 29663,
+  29695, 29727, 29759, 29791, 29823, 29855, 29887, 29919, 29951, 29983, 30015, 30047, 30079, 30111, 30143, 30175,
+  30207, 30239, 30271, 30303, 30335, 30367, 30399, 30431, 30463, 30495, 30527, 30559, 30591, 30623, 30655, 30687,
+  30719, 30751, 30783, 30815, 30847, 30879, 30911, 30943, 30975, 31007, 31039, 31071, 31103, 31135, 31167, 31199,
+  31231, 31263, 31295, 31327, 31359, 31391, 31423, 31455, 31487, 31519, 31551, 31583, 31615, 31647, 31679, 31711,
+  31743, 31775, 31807, 31839, 31871, 31903, 31935, 31967, 31999, 32031, 32063, 32095, 32127, 32159, 32191, 32223,
+  32255, 32287, 32319, 32351, 32383, 32415, 32447, 32479, 32511, 32543, 32575, 32607, 32639, 32671, 32703, 32735,
+  32767, 32733, 32669, 32606, 32541, 32478, 32413, 32349, 32285, 32221, 32157, 32093, 32029, 31965, 31901, 31837,
+  31773, 31709, 31645, 31581, 31517, 31452, 31388, 31324, 31260, 31196, 31132, 31068, 31004, 30940, 30876, 30812,
+  30748, 30684, 30620, 30556, 30492, 30428, 30364, 30299, 30235, 30171, 30107, 30043, 29979, 29915, 29851, 29787,
+  29723, 29659, 29595, 29531, 29467, 29403, 29339, 29274, 29210, 29146, 29082, 29018, 28954, 28890, 28826, 28762,
+  28698, 28634, 28570, 28506, 28442, 28378, 28314, 28250, 28186, 28121, 28057, 27993, 27929, 27865, 27801, 27737,
+  27673, 27609, 27545, 27481, 27417, 27353, 27289, 27225, 27161, 27097, 27032, 26968, 26904, 26840, 26776, 26712,
+  26648, 26584, 26520, 26456, 26392, 26328, 26264, 26200, 26136, 26072, 26008, 25943, 25879, 25815, 25751, 25687,
+  25623, 25559, 25495, 25431, 25367, 25303, 25239, 25175, 25111, 25047, 24983, 24918, 24854, 24790, 24726, 24662,
+  24598, 24534, 24470, 24406, 24342, 24278, 24214, 24150, 24086, 24022, 23958, 23894, 23829, 23765, 23701, 23637,
+  23573, 23509, 23445, 23381, 23317, 23253, 23189, 23125, 23061, 22997, 22933, 22869, 22805, 22741, 22676, 22612,
+  22548, 22484, 22420, 22356, 22292, 22228, 22164, 22100, 22036, 21972, 21908, 21844, 21780, 21716, 21651, 21587,
+  21523, 21459, 21395, 21331, 21267, 21203, 21139, 21075, 21011, 20947, 20883, 20819, 20755, 20691, 20627, 20562,
+  20498, 20434, 20370, 20306, 20242, 20178, 20114, 20050, 19986, 19922, 19858, 19794, 19730, 19666, 19602, 19538,
+  19473, 19409, 19345, 19281, 19217, 19153, 19089, 19025, 18961, 18897, 18833, 18769, 18705, 18641, 18577, 18513,
+  18449, 18384, 18320, 18256, 18192, 18128, 18064, 18000, 17936, 17872, 17808, 17744, 17680, 17616, 17552, 17488,
+  17424, 17360, 17295, 17231, 17167, 17103, 17039, 16975, 16911, 16847, 16783, 16719, 16655, 16591, 16527, 16463,
+  16399, 16335, 16271, 16206, 16142, 16078, 16014, 15950, 15886, 15822, 15758, 15694, 15630, 15566, 15502, 15438,
+  15374, 15310, 15246, 15182, 15117, 15053, 14989, 14925, 14861, 14797, 14733, 14669, 14605, 14541, 14477, 14413,
+  14349, 14285, 14221, 14157, 14093, 14028, 13964, 13900, 13836, 13772, 13708, 13644, 13580, 13516, 13452, 13388,
+  13324, 13260, 13196, 13132, 13068, 13004, 12939, 12875, 12811, 12747, 12683, 12619, 12555, 12491, 12427, 12363,
+  12299, 12235, 12171, 12107, 12043, 11979, 11914, 11850, 11786, 11722, 11658, 11594, 11530, 11466, 11402, 11338,
+  11274, 11210, 11146, 11082, 11018, 10954, 10890, 10825, 10761, 10697, 10633, 10569, 10505, 10441, 10377, 10313,
+  10249, 10185, 10121, 10057, 9993, 9929, 9865, 9801, 9736, 9672, 9608, 9544, 9480, 9416, 9352, 9288,
+  9224, 9160, 9096, 9032, 8968, 8904, 8840, 8776, 8712, 8647, 8583, 8519, 8455, 8391, 8327, 8263,
+  8199, 8135, 8071, 8007, 7943, 7879, 7815, 7751, 7687, 7623, 7558, 7494, 7430, 7366, 7302, 7238,
+  7174, 7110, 7046, 6982, 6918, 6854, 6790, 6726, 6662, 6598, 6534, 6469, 6405, 6341, 6277, 6213,
+  6149, 6085, 6021, 5957, 5893, 5829, 5765, 5701, 5637, 5573, 5509, 5445, 5380, 5316, 5252, 5188,
+  5124, 5060, 4996, 4932, 4868, 4804, 4740, 4676, 4612, 4548, 4484, 4420, 4356, 4291, 4227, 4163,
+  4099, 4035, 3971, 3907, 3843, 3779, 3715, 3651, 3587, 3523, 3459, 3395, 3331, 3267, 3202, 3138,
+  3074, 3010, 2946, 2882, 2818, 2754, 2690, 2626, 2562, 2498, 2434, 2370, 2306, 2242, 2178, 2113,
+  2049, 1985, 1921, 1857, 1793, 1729, 1665, 1601, 1537, 1473, 1409, 1345, 1281, 1217, 1153, 1089,
+  1024, 960, 896, 832, 768, 704, 640, 576, 512, 448, 384, 320, 256, 192, 128, 64,
+  0, -64, -128, -192, -256, -320, -384, -448, -512, -576, -640, -704, -768, -832, -896, -960,
+  -1024, -1089, -1153, -1217, -1281, -1345, -1409, -1473, -1537, -1601, -1665, -1729, -1793, -1857, -1921, -1985,
+  -2049, -2113, -2178, -2242, -2306, -2370, -2434, -2498, -2562, -2626, -2690, -2754, -2818, -2882, -2946, -3010,
+  -3074, -3138, -3202, -3267, -3331, -3395, -3459, -3523, -3587, -3651, -3715, -3779, -3843, -3907, -3971, -4035,
+  -4099, -4163, -4227, -4291, -4356, -4420, -4484, -4548, -4612, -4676, -4740, -4804, -4868, -4932, -4996, -5060,
+  -5124, -5188, -5252, -5316, -5380, -5445, -5509, -5573, -5637, -5701, -5765, -5829, -5893, -5957, -6021, -6085,
+  -6149, -6213, -6277, -6341, -6405, -6469, -6534, -6598, -6662, -6726, -6790, -6854, -6918, -6982, -7046, -7110,
+  -7174, -7238, -7302, -7366, -7430, -7494, -7558, -7623, -7687, -7751, -7815, -7879, -7943, -8007, -8071, -8135,
+  -8199, -8263, -8327, -8391, -8455, -8519, -8583, -8647, -8712, -8776, -8840, -8904, -8968, -9032, -9096, -9160,
+  -9224, -9288, -9352, -9416, -9480, -9544, -9608, -9672, -9736, -9801, -9865, -9929, -9993, -10057, -10121, -10185,
+  -10249, -10313, -10377, -10441, -10505, -10569, -10633, -10697, -10761, -10825, -10890, -10954, -11018, -11082, -11146, -11210,
+  -11274, -11338, -11402, -11466, -11530, -11594, -11658, -11722, -11786, -11850, -11914, -11979, -12043, -12107, -12171, -12235,
+  -12299, -12363, -12427, -12491, -12555, -12619, -12683, -12747, -12811, -12875, -12939, -13004, -13068, -13132, -13196, -13260,
+  -13324, -13388, -13452, -13516, -13580, -13644, -13708, -13772, -13836, -13900, -13964, -14028, -14093, -14157, -14221, -14285,
+  -14349, -14413, -14477, -14541, -14605, -14669, -14733, -14797, -14861, -14925, -14989, -15053, -15117, -15182, -15246, -15310,
+  -15374, -15438, -15502, -15566, -15630, -15694, -15758, -15822, -15886, -15950, -16014, -16078, -16142, -16206, -16271, -16335,
+  -16399, -16463, -16527, -16591, -16655, -16719, -16783, -16847, -16911, -16975, -17039, -17103, -17167, -17231, -17295, -17360,
+  -17424, -17488, -17552, -17616, -17680, -17744, -17808, -17872, -17936, -18000, -18064, -18128, -18192, -18256, -18320, -18384,
+  -18449, -18513, -18577, -18641, -18705, -18769, -18833, -18897, -18961, -19025, -19089, -19153, -19217, -19281, -19345, -19409,
+  -19473, -19538, -19602, -19666, -19730, -19794, -19858, -19922, -19986, -20050, -20114, -20178, -20242, -20306, -20370, -20434,
+  -20498, -20562, -20627, -20691, -20755, -20819, -20883, -20947, -21011, -21075, -21139, -21203, -21267, -21331, -21395, -21459,
+  -21523, -21587, -21651, -21716, -21780, -21844, -21908, -21972, -22036, -22100, -22164, -22228, -22292, -22356, -22420, -22484,
+  -22548, -22612, -22676, -22741, -22805, -22869, -22933, -22997, -23061, -23125, -23189, -23253, -23317, -23381, -23445, -23509,
+  -23573, -23637, -23701, -23765, -23829, -23894, -23958, -24022, -24086, -24150, -24214, -24278, -24342, -24406, -24470, -24534,
+  -24598, -24662, -24726, -24790, -24854, -24918, -24983, -25047, -25111, -25175, -25239, -25303, -25367, -25431, -25495, -25559,
+  -25623, -25687, -25751, -25815, -25879, -25943, -26008, -26072, -26136, -26200, -26264, -26328, -26392, -26456, -26520, -26584,
+  -26648, -26712, -26776, -26840, -26904, -26968, -27032, -27097, -27161, -27225, -27289, -27353, -27417, -27481, -27545, -27609,
+  -27673, -27737, -27801, -27865, -27929, -27993, -28057, -28121, -28186, -28250, -28314, -28378, -28442, -28506, -28570, -28634,
+  -28698, -28762, -28826, -28890, -28954, -29018, -29082, -29146, -29210, -29274, -29339, -29403, -29467, -29531, -29595, -29659,
+  -29723, -29787, -29851, -29915, -29979, -30043, -30107, -30171, -30235, -30299, -30364, -30428, -30492, -30556, -30620, -30684,
+  -30748, -30812, -30876, -30940, -31004, -31068, -31132, -31196, -31260, -31324, -31388, -31452, -31517, -31581, -31645, -31709,
+  -31773, -31837, -31901, -31965, -32029, -32093, -32157, -32221, -32285, -32349, -32413, -32478, -32541, -32606, -32669, -32733,
+  -32767, -32733, -32669, -32606, -32541, -32478, -32413, -32349, -32285, -32221, -32157, -32093, -32029, -31965, -31901, -31837,
+  -31773, -31709, -31645, -31581, -31517, -31452, -31388, -31324, -31260, -31196, -31132, -31068, -31004, -30940, -30876, -30812,
+  -30748, -30684, -30620, -30556, -30492, -30428, -30364, -30299, -30235, -30171, -30107, -30043, -29979, -29915, -29851, -29787,
+  -29723, -29659, -29595, -29531, -29467, -29403, -29339, -29274, -29210, -29146, -29082, -29018, -28954, -28890, -28826, -28762,
+  -28698, -28634, -28570, -28506, -28442, -28378, -28314, -28250, -28186, -28121, -28057, -27993, -27929, -27865, -27801, -27737,
+  -27673, -27609, -27545, -27481, -27417, -27353, -27289, -27225, -27161, -27097, -27032, -26968, -26904, -26840, -26776, -26712,
+  -26648, -26584, -26520, -26456, -26392, -26328, -26264, -26200, -26136, -26072, -26008, -25943, -25879, -25815, -25751, -25687,
+  -25623, -25559, -25495, -25431, -25367, -25303, -25239, -25175, -25111, -25047, -24983, -24918, -24854, -24790, -24726, -24662,
+  -24598, -24534, -24470, -24406, -24342, -24278, -24214, -24150, -24086, -24022, -23958, -23894, -23829, -23765, -23701, -23637,
+  -23573, -23509, -23445, -23381, -23317, -23253, -23189, -23125, -23061, -22997, -22933, -22869, -22805, -22741, -22676, -22612,
+  -22548, -22484, -22420, -22356, -22292, -22228, -22164, -22100, -22036, -21972, -21908, -21844, -21780, -21716, -21651, -21587,
+  -21523, -21459, -21395, -21331, -21267, -21203, -21139, -21075, -21011, -20947, -20883, -20819, -20755, -20691, -20627, -20562,
+  -20498, -20434, -20370, -20306, -20242, -20178, -20114, -20050, -19986, -19922, -19858, -19794, -19730, -19666, -19602, -19538,
+  -19473, -19409, -19345, -19281, -19217, -19153, -19089, -19025, -18961, -18897, -18833, -18769, -18705, -18641, -18577, -18513,
+  -18449, -18384, -18320, -18256, -18192, -18128, -18064, -18000, -17936, -17872, -17808, -17744, -17680, -17616, -17552, -17488,
+  -17424, -17360, -17295, -17231, -17167, -17103, -17039, -16975, -16911, -16847, -16783, -16719, -16655, -16591, -16527, -16463,
+  -16399, -16335, -16271, -16206, -16142, -16078, -16014, -15950, -15886, -15822, -15758, -15694, -15630, -15566, -15502, -15438,
+  -15374, -15310, -15246, -15182, -15117, -15053, -14989, -14925, -14861, -14797, -14733, -14669, -14605, -14541, -14477, -14413,
+  -14349, -14285, -14221, -14157, -14093, -14028, -13964, -13900, -13836, -13772, -13708, -13644, -13580, -13516, -13452, -13388,
+  -13324, -13260, -13196, -13132, -13068, -13004, -12939, -12875, -12811, -12747, -12683, -12619, -12555, -12491, -12427, -12363,
+  -12299, -12235, -12171, -12107, -12043, -11979, -11914, -11850, -11786, -11722, -11658, -11594, -11530, -11466, -11402, -11338,
+  -11274, -11210, -11146, -11082, -11018, -10954, -10890, -10825, -10761, -10697, -10633, -10569, -10505, -10441, -10377, -10313,
+  -10249, -10185, -10121, -10057, -9993, -9929, -9865, -9801, -9736, -9672, -9608, -9544, -9480, -9416, -9352, -9288,
+  -9224, -9160, -9096, -9032, -8968, -8904, -8840, -8776, -8712, -8647, -8583, -8519, -8455, -8391, -8327, -8263,
+  -8199, -8135, -8071, -8007, -7943, -7879, -7815, -7751, -7687, -7623, -7558, -7494, -7430, -7366, -7302, -7238,
+  -7174, -7110, -7046, -6982, -6918, -6854, -6790, -6726, -6662, -6598, -6534, -6469, -6405, -6341, -6277, -6213,
+  -6149, -6085, -6021, -5957, -5893, -5829, -5765, -5701, -5637, -5573, -5509, -5445, -5380, -5316, -5252, -5188,
+  -5124, -5060, -4996, -4932, -4868, -4804, -4740, -4676, -4612, -4548, -4484, -4420, -4356, -4291, -4227, -4163,
+  -4099, -4035, -3971, -3907, -3843, -3779, -3715, -3651, -3587, -3523, -3459, -3395, -3331, -3267, -3202, -3138,
+  -3074, -3010, -2946, -2882, -2818, -2754, -2690, -2626, -2562, -2498, -2434, -2370, -2306, -2242, -2178, -2113,
+  -2049, -1985, -1921, -1857, -1793, -1729, -1665, -1601, -1537, -1473, -1409, -1345, -1281, -1217, -1153, -1089,
+  -1024, -960, -896, -832, -768, -704, -640, -576, -512, -448, -384, -320, -256, -192, -128, -64,
+  0, 64, 128, 192, 256, 320, 384, 448, 512, 576, 640, 704, 768, 832, 896, 960,
+  1024, 1089, 1153, 1217, 1281, 1345, 1409, 1473, 1537, 1601, 1665, 1729, 1793, 1857, 1921, 1985,
+  2049, 2113, 2178, 2242, 2306, 2370, 2434, 2498, 2562, 2626, 2690, 2754, 2818, 2882, 2946, 3010,
+  3074, 3138, 3202, 3267, 3331, 3395, 3459, 3523, 3587, 3651, 3715, 3779, 3843, 3907, 3971, 4035,
+  4099, 4163, 4227, 4291, 4356, 4420, 4484, 4548, 4612, 4676, 4740, 4804, 4868, 4932, 4996, 5060,
+  5124, 5188, 5252, 5316, 5380, 5445, 5509, 5573, 5637, 5701, 5765, 5829, 5893, 5957, 6021, 6085,
+  6149, 6213, 6277, 6341, 6405, 6469, 6534, 6598, 6662, 6726, 6790, 6854, 6918, 6982, 7046, 7110,
+  7174, 7238, 7302, 7366, 7430, 7494, 7558, 7623, 7687, 7751, 7815, 7879, 7943, 8007, 8071, 8135,
+  8199, 8263, 8327, 8391, 8455, 8519, 8583, 8647, 8712, 8776, 8840, 8904, 8968, 9032, 9096, 9160,
+  9224, 9288, 9352, 9416, 9480, 9544, 9608, 9672, 9736, 9801, 9865, 9929, 9993, 10057, 10121, 10185,
+  10249, 10313, 10377, 10441, 10505, 10569, 10633, 10697, 10761, 10825, 10890, 10954, 11018, 11082, 11146, 11210,
+  11274, 11338, 11402, 11466, 11530, 11594, 11658, 11722, 11786, 11850, 11914, 11979, 12043, 12107, 12171, 12235,
+  12299, 12363, 12427, 12491, 12555, 12619, 12683, 12747, 12811, 12875, 12939, 13004, 13068, 13132, 13196, 13260,
+  13324, 13388, 13452, 13516, 13580, 13644, 13708, 13772, 13836, 13900, 13964, 14028, 14093, 14157, 14221, 14285,
+  14349, 14413, 14477, 14541, 14605, 14669, 14733, 14797, 14861, 14925, 14989, 15053, 15117, 15182, 15246, 15310,
+  15374, 15438, 15502, 15566, 15630, 15694, 15758, 15822, 15886, 15950, 16014, 16078, 16142, 16206, 16271, 16335,
+  16399, 16463, 16527, 16591, 16655, 16719, 16783, 16847, 16911, 16975, 17039, 17103, 17167, 17231, 17295, 17360,
+  17424, 17488, 17552, 17616, 17680, 17744, 17808, 17872, 17936, 18000, 18064, 18128, 18192, 18256, 18320, 18384,
+  18449, 18513, 18577, 18641, 18705, 18769, 18833, 18897, 18961, 19025, 19089, 19153, 19217, 19281, 19345, 19409,
+  19473, 19538, 19602, 19666, 19730, 19794, 19858, 19922, 19986, 20050, 20114, 20178, 20242, 20306, 20370, 20434,
+  20498, 20562, 20627, 20691, 20755, 20819, 20883, 20947, 21011, 21075, 21139, 21203, 21267, 21331, 21395, 21459,
+  21523, 21587, 21651, 21716, 21780, 21844, 21908, 21972, 22036, 22100, 22164, 22228, 22292, 22356, 22420, 22484,
+  22548, 22612, 22676, 22741, 22805, 22869, 22933, 22997, 23061, 23125, 23189, 23253, 23317, 23381, 23445, 23509,
+  23573, 23637, 23701, 23765, 23829, 23894, 23958, 24022, 24086, 24150, 24214, 24278, 24342, 24406, 24470, 24534,
+  24598, 24662, 24726, 24790, 24854, 24918, 24983, 25047, 25111, 25175, 25239, 25303, 25367, 25431, 25495, 25559,
+  25623, 25687, 25751, 25815, 25879, 25943, 26008, 26072, 26136, 26200, 26264, 26328, 26392, 26456, 26520, 26584,
+  26648, 26712, 26776, 26840, 26904, 26968, 27032, 27097, 27161, 27225, 27289, 27353, 27417, 27481, 27545, 27609,
+  27673, 27737, 27801, 27865, 27929, 27993, 28057, 28121, 28186, 28250, 28314, 28378, 28442, 28506, 28570, 28634,
+  28698, 28762, 28826, 28890, 28954, 29018, 29082, 29146, 29210, 29274, 29339, 29403, 29467, 29531, 29595, 29659,
+  29723, 29787, 29851, 29915, 29979, 30043, 30107, 30171, 30235, 30299, 30364, 30428, 30492, 30556, 30620, 30684,
+  30748, 30812, 30876, 30940, 31004, 31068, 31132, 31196, 31260, 31324, 31388, 31452, 31517, 31581, 31645, 31709,
+  31773, 31837, 31901, 31965, 32029, 32093, 32157, 32221, 32285, 32349, 32413, 32478, 32541, 32606, 32669, 32733,
+  32767, 32700, 32572, 32445, 32316, 32188, 32060, 31931, 31803, 31675, 31547, 31418, 31290, 31162, 31034, 30906,
+  30777, 30649, 30521, 30393, 30264, 30136, 30008, 29880, 29751, 29623, 29495, 29367, 29238, 29110, 28982, 28854,
+  28725, 28597, 28469, 28341, 28212, 28084, 27956, 27828, 27699, 27571, 27443, 27315, 27187, 27058, 26930, 26802,
+  26674, 26545, 26417, 26289, 26161, 26032, 25904, 25776, 25648, 25519, 25391, 25263, 25135, 25006, 24878, 24750,
+  24622, 24493, 24365, 24237, 24109, 23981, 23852, 23724, 23596, 23468, 23339, 23211, 23083, 22955, 22826, 22698,
+  22570, 22442, 22313, 22185, 22057, 21929, 21800, 21672, 21544, 21416, 21287, 21159, 21031, 20903, 20775, 20646,
+  20518, 20390, 20262, 20133, 20005, 19877, 19749, 19620, 19492, 19364, 19236, 19107, 18979, 18851, 18723, 18594,
+  18466, 18338, 18210, 18081, 17953, 17825, 17697, 17568, 17440, 17312, 17184, 17055, 16927, 16799, 16671, 16543,
+  16414, 16286, 16158, 16030, 15901, 15773, 15645, 15517, 15388, 15260, 15132, 15004, 14875, 14747, 14619, 14491,
+  14362, 14234, 14106, 13978, 13849, 13721, 13593, 13465, 13337, 13208, 13080, 12952, 12824, 12695, 12567, 12439,
+  12311, 12182, 12054, 11926, 11798, 11669, 11541, 11413, 11285, 11156, 11028, 10900, 10772, 10643, 10515, 10387,
+  10259, 10131, 10002, 9874, 9746, 9618, 9489, 9361, 9233, 9105, 8976, 8848, 8720, 8592, 8463, 8335,
+  8207, 8079, 7950, 7822, 7694, 7566, 7437, 7309, 7181, 7053, 6924, 6796, 6668, 6540, 6412, 6283,
+  6155, 6027, 5899, 5770, 5642, 5514, 5386, 5257, 5129, 5001, 4873, 4744, 4616, 4488, 4360, 4231,
+  4103, 3975, 3847, 3718, 3590, 3462, 3334, 3206, 3077, 2949, 2821, 2693, 2564, 2436, 2308, 2180,
+  2051, 1923, 1795, 1667, 1538, 1410, 1282, 1154, 1025, 897, 769, 641, 512, 384, 256, 128,
+  0, -128, -256, -384, -512, -641, -769, -897, -1025, -1154, -1282, -1410, -1538, -1667, -1795, -1923,
+  -2051, -2180, -2308, -2436, -2564, -2693, -2821, -2949, -3077, -3206, -3334, -3462, -3590, -3718, -3847, -3975,
+  -4103, -4231, -4360, -4488, -4616, -4744, -4873, -5001, -5129, -5257, -5386, -5514, -5642, -5770, -5899, -6027,
+  -6155, -6283, -6412, -6540, -6668, -6796, -6924, -7053, -7181, -7309, -7437, -7566, -7694, -7822, -7950, -8079,
+  -8207, -8335, -8463, -8592, -8720, -8848, -8976, -9105, -9233, -9361, -9489, -9618, -9746, -9874, -10002, -10131,
+  -10259, -10387, -10515, -10643, -10772, -10900, -11028, -11156, -11285, -11413, -11541, -11669, -11798, -11926, -12054, -12182,
+  -12311, -12439, -12567, -12695, -12824, -12952, -13080, -13208, -13337, -13465, -13593, -13721, -13849, -13978, -14106, -14234,
+  -14362, -14491, -14619, -14747, -14875, -15004, -15132, -15260, -15388, -15517, -15645, -15773, -15901, -16030, -16158, -16286,
+  -16414, -16543, -16671, -16799, -16927, -17055, -17184, -17312, -17440, -17568, -17697, -17825, -17953, -18081, -18210, -18338,
+  -18466, -18594, -18723, -18851, -18979, -19107, -19236, -19364, -19492, -19620, -19749, -19877, -20005, -20133, -20262, -20390,
+  -20518, -20646, -20775, -20903, -21031, -21159, -21287, -21416, -21544, -21672, -21800, -21929, -22057, -22185, -22313, -22442,
+  -22570, -22698, -22826, -22955, -23083, -23211, -23339, -23468, -23596, -23724, -23852, -23981, -24109, -24237, -24365, -24493,
+  -24622, -24750, -24878, -25006, -25135, -25263, -25391, -25519, -25648, -25776, -25904, -26032, -26161, -26289, -26417, -26545,
+  -26674, -26802, -26930, -27058, -27187, -27315, -27443, -27571, -27699, -27828, -27956, -28084, -28212, -28341, -28469, -28597,
+  -28725, -28854, -28982, -29110, -29238, -29367, -29495, -29623, -29751, -29880, -30008, -30136, -30264, -30393, -30521, -30649,
+  -30777, -30906, -31034, -31162, -31290, -31418, -31547, -31675, -31803, -31931, -32060, -32188, -32316, -32445, -32572, -32700,
+  -32767, -32700, -32572, -32445, -32316, -32188, -32060, -31931, -31803, -31675, -31547, -31418, -31290, -31162, -31034, -30906,
+  -30777, -30649, -30521, -30393, -30264, -30136, -30008, -29880, -29751, -29623, -29495, -29367, -29238, -29110, -28982, -28854,
+  -28725, -28597, -28469, -28341, -28212, -28084, -27956, -27828, -27699, -27571, -27443, -27315, -27187, -27058, -26930, -26802,
+  -26674, -26545, -26417, -26289, -26161, -26032, -25904, -25776, -25648, -25519, -25391, -25263, -25135, -25006, -24878, -24750,
+  -24622, -24493, -24365, -24237, -24109, -23981, -23852, -23724, -23596, -23468, -23339, -23211, -23083, -22955, -22826, -22698,
+  -22570, -22442, -22313, -22185, -22057, -21929, -21800, -21672, -21544, -21416, -21287, -21159, -21031, -20903, -20775, -20646,
+  -20518, -20390, -20262, -20133, -20005, -19877, -19749, -19620, -19492, -19364, -19236, -19107, -18979, -18851, -18723, -18594,
+  -18466, -18338, -18210, -18081, -17953, -17825, -17697, -17568, -17440, -17312, -17184, -17055, -16927, -16799, -16671, -16543,
+  -16414, -16286, -16158, -16030, -15901, -15773, -15645, -15517, -15388, -15260, -15132, -15004, -14875, -14747, -14619, -14491,
+  -14362, -14234, -14106, -13978, -13849, -13721, -13593, -13465, -13337, -13208, -13080, -12952, -12824, -12695, -12567, -12439,
+  -12311, -12182, -12054, -11926, -11798, -11669, -11541, -11413, -11285, -11156, -11028, -10900, -10772, -10643, -10515, -10387,
+  -10259, -10131, -10002, -9874, -9746, -9618, -9489, -9361, -9233, -9105, -8976, -8848, -8720, -8592, -8463, -8335,
+  -8207, -8079, -7950, -7822, -7694, -7566, -7437, -7309, -7181, -7053, -6924, -6796, -6668, -6540, -6412, -6283,
+  -6155, -6027, -5899, -5770, -5642, -5514, -5386, -5257, -5129, -5001, -4873, -4744, -4616, -4488, -4360, -4231,
+  -4103, -3975, -3847, -3718, -3590, -3462, -3334, -3206, -3077, -2949, -2821, -2693, -2564, -2436, -2308, -2180,
+  -2051, -1923, -1795, -1667, -1538, -1410, -1282, -1154, -1025, -897, -769, -641, -512, -384, -256, -128,
+  0, 128, 256, 384, 512, 641, 769, 897, 1025, 1154, 1282, 1410, 1538, 1667, 1795, 1923,
+  2051, 2180, 2308, 2436, 2564, 2693, 2821, 2949, 3077, 3206, 3334, 3462, 3590, 3718, 3847, 3975,
+  4103, 4231, 4360, 4488, 4616, 4744, 4873, 5001, 5129, 5257, 5386, 5514, 5642, 5770, 5899, 6027,
+  6155, 6283, 6412, 6540, 6668, 6796, 6924, 7053, 7181, 7309, 7437, 7566, 7694, 7822, 7950, 8079,
+  8207, 8335, 8463, 8592, 8720, 8848, 8976, 9105, 9233, 9361, 9489, 9618, 9746, 9874, 10002, 10131,
+  10259, 10387, 10515, 10643, 10772, 10900, 11028, 11156, 11285, 11413, 11541, 11669, 11798, 11926, 12054, 12182,
+  12311, 12439, 12567, 12695, 12824, 12952, 13080, 13208, 13337, 13465, 13593, 13721, 13849, 13978, 14106, 14234,
+  14362, 14491, 14619, 14747, 14875, 15004, 15132, 15260, 15388, 15517, 15645, 15773, 15901, 16030, 16158, 16286,
+  16414, 16543, 16671, 16799, 16927, 17055, 17184, 17312, 17440, 17568, 17697, 17825, 17953, 18081, 18210, 18338,
+  18466, 18594, 18723, 18851, 18979, 19107, 19236, 19364, 19492, 19620, 19749, 19877, 20005, 20133, 20262, 20390,
+  20518, 20646, 20775, 20903, 21031, 21159, 21287, 21416, 21544, 21672, 21800, 21929, 22057, 22185, 22313, 22442,
+  22570, 22698, 22826, 22955, 23083, 23211, 23339, 23468, 23596, 23724, 23852, 23981, 24109, 24237, 24365, 24493,
+  24622, 24750, 24878, 25006, 25135, 25263, 25391, 25519, 25648, 25776, 25904, 26032, 26161, 26289, 26417, 26545,
+  26674, 26802, 26930, 27058, 27187, 27315, 27443, 27571, 27699, 27828, 27956, 28084, 28212, 28341, 28469, 28597,
+  28725, 28854, 28982, 29110, 29238, 29367, 29495, 29623, 29751, 29880, 30008, 30136, 30264, 30393, 30521, 30649,
+  30777, 30906, 31034, 31162, 31290, 31418, 31547, 31675, 31803, 31931, 32060, 32188, 32316, 32445, 32572, 32700,
+  32767, 32634, 32377, 32121, 31864, 31607, 31350, 31093, 30836, 30579, 30322, 30065, 29808, 29551, 29294, 29037,
+  28780, 28523, 28266, 28009, 27752, 27496, 27239, 26982, 26725, 26468, 26211, 25954, 25697, 25440, 25183, 24926,
+  24669, 24412, 24155, 23898, 23641, 23384, 23127, 22870, 22613, 22356, 22099, 21842, 21585, 21328, 21071, 20814,
+  20557, 20300, 20043, 19786, 19529, 19272, 19015, 18758, 18501, 18245, 17988, 17731, 17474, 17217, 16960, 16703,
+  16446, 16189, 15932, 15675, 15418, 15161, 14904, 14647, 14390, 14133, 13876, 13619, 13362, 13105, 12848, 12591,
+  12334, 12077, 11820, 11563, 11306, 11049, 10792, 10535, 10278, 10021, 9764, 9507, 9251, 8994, 8737, 8480,
+  8223, 7966, 7709, 7452, 7195, 6938, 6681, 6424, 6167, 5910, 5653, 5396, 5139, 4882, 4625, 4368,
+  4111, 3854, 3597, 3340, 3083, 2826, 2569, 2312, 2055, 1798, 1541, 1284, 1027, 770, 513, 256,
+  0, -256, -513, -770, -1027, -1284, -1541, -1798, -2055, -2312, -2569, -2826, -3083, -3340, -3597, -3854,
+  -4111, -4368, -4625, -4882, -5139, -5396, -5653, -5910, -6167, -6424, -6681, -6938, -7195, -7452, -7709, -7966,
+  -8223, -8480, -8737, -8994, -9251, -9507, -9764, -10021, -10278, -10535, -10792, -11049, -11306, -11563, -11820, -12077,
+  -12334, -12591, -12848, -13105, -13362, -13619, -13876, -14133, -14390, -14647, -14904, -15161, -15418, -15675, -15932, -16189,
+  -16446, -16703, -16960, -17217, -17474, -17731, -17988, -18245, -18501, -18758, -19015, -19272, -19529, -19786, -20043, -20300,
+  -20557, -20814, -21071, -21328, -21585, -21842, -22099, -22356, -22613, -22870, -23127, -23384, -23641, -23898, -24155, -24412,
+  -24669, -24926, -25183, -25440, -25697, -25954, -26211, -26468, -26725, -26982, -27239, -27496, -27752, -28009, -28266, -28523,
+  -28780, -29037, -29294, -29551, -29808, -30065, -30322, -30579, -30836, -31093, -31350, -31607, -31864, -32121, -32377, -32634,
+  -32767, -32634, -32377, -32121, -31864, -31607, -31350, -31093, -30836, -30579, -30322, -30065, -29808, -29551, -29294, -29037,
+  -28780, -28523, -28266, -28009, -27752, -27496, -27239, -26982, -26725, -26468, -26211, -25954, -25697, -25440, -25183, -24926,
+  -24669, -24412, -24155, -23898, -23641, -23384, -23127, -22870, -22613, -22356, -22099, -21842, -21585, -21328, -21071, -20814,
+  -20557, -20300, -20043, -19786, -19529, -19272, -19015, -18758, -18501, -18245, -17988, -17731, -17474, -17217, -16960, -16703,
+  -16446, -16189, -15932, -15675, -15418, -15161, -14904, -14647, -14390, -14133, -13876, -13619, -13362, -13105, -12848, -12591,
+  -12334, -12077, -11820, -11563, -11306, -11049, -10792, -10535, -10278, -10021, -9764, -9507, -9251, -8994, -8737, -8480,
+  -8223, -7966, -7709, -7452, -7195, -6938, -6681, -6424, -6167, -5910, -5653, -5396, -5139, -4882, -4625, -4368,
+  -4111, -3854, -3597, -3340, -3083, -2826, -2569, -2312, -2055, -1798, -1541, -1284, -1027, -770, -513, -256,
+  0, 256, 513, 770, 1027, 1284, 1541, 1798, 2055, 2312, 2569, 2826, 3083, 3340, 3597, 3854,
+  4111, 4368, 4625, 4882, 5139, 5396, 5653, 5910, 6167, 6424, 6681, 6938, 7195, 7452, 7709, 7966,
+  8223, 8480, 8737, 8994, 9251, 9507, 9764, 10021, 10278, 10535, 10792, 11049, 11306, 11563, 11820, 12077,
+  12334, 12591, 12848, 13105, 13362, 13619, 13876, 14133, 14390, 14647, 14904, 15161, 15418, 15675, 15932, 16189,
+  16446, 16703, 16960, 17217, 17474, 17731, 17988, 18245, 18501, 18758, 19015, 19272, 19529, 19786, 20043, 20300,
+  20557, 20814, 21071, 21328, 21585, 21842, 22099, 22356, 22613, 22870, 23127, 23384, 23641, 23898, 24155, 24412,
+  24669, 24926, 25183, 25440, 25697, 25954, 26211, 26468, 26725, 26982, 27239, 27496, 27752, 28009, 28266, 28523,
+  28780, 29037, 29294, 29551, 29808, 30065, 30322, 30579, 30836, 31093, 31350, 31607, 31864, 32121, 32377, 32634,
+  32767, 32500, 31985, 31471, 30954, 30439, 29923, 29407, 28891, 28375, 27859, 27343, 26827, 26311, 25795, 25280,
+  24764, 24248, 23732, 23216, 22700, 22184, 21668, 21152, 20636, 20120, 19604, 19089, 18573, 18057, 17541, 17025,
+  16509, 15993, 15477, 14961, 14445, 13929, 13413, 12897, 12382, 11866, 11350, 10834, 10318, 9802, 9286, 8770,
+  8254, 7738, 7222, 6706, 6191, 5675, 5159, 4643, 4127, 3611, 3095, 2579, 2063, 1547, 1031, 515,
+  0, -515, -1031, -1547, -2063, -2579, -3095, -3611, -4127, -4643, -5159, -5675, -6191, -6706, -7222, -7738,
+  -8254, -8770, -9286, -9802, -10318, -10834, -11350, -11866, -12382, -12897, -13413, -13929, -14445, -14961, -15477, -15993,
+  -16509, -17025, -17541, -18057, -18573, -19089, -19604, -20120, -20636, -21152, -21668, -22184, -22700, -23216, -23732, -24248,
+  -24764, -25280, -25795, -26311, -26827, -27343, -27859, -28375, -28891, -29407, -29923, -30439, -30954, -31471, -31985, -32500,
+  -32767, -32500, -31985, -31471, -30954, -30439, -29923, -29407, -28891, -28375, -27859, -27343, -26827, -26311, -25795, -25280,
+  -24764, -24248, -23732, -23216, -22700, -22184, -21668, -21152, -20636, -20120, -19604, -19089, -18573, -18057, -17541, -17025,
+  -16509, -15993, -15477, -14961, -14445, -13929, -13413, -12897, -12382, -11866, -11350, -10834, -10318, -9802, -9286, -8770,
+  -8254, -7738, -7222, -6706, -6191, -5675, -5159, -4643, -4127, -3611, -3095, -2579, -2063, -1547, -1031, -515,
+  0, 515, 1031, 1547, 2063, 2579, 3095, 3611, 4127, 4643, 5159, 5675, 6191, 6706, 7222, 7738,
+  8254, 8770, 9286, 9802, 10318, 10834, 11350, 11866, 12382, 12897, 13413, 13929, 14445, 14961, 15477, 15993,
+  16509, 17025, 17541, 18057, 18573, 19089, 19604, 20120, 20636, 21152, 21668, 22184, 22700, 23216, 23732, 24248,
+  24764, 25280, 25795, 26311, 26827, 27343, 27859, 28375, 28891, 29407, 29923, 30439, 30954, 31471, 31985, 32500,
+  32767, 32230, 31191, 30156, 29114, 28076, 27035, 25996, 24955, 23916, 22876, 21836, 20796, 19756, 18716, 17677,
+  16637, 15597, 14557, 13517, 12477, 11438, 10398, 9358, 8318, 7278, 6238, 5199, 4159, 3119, 2079, 1039,
+  0, -1039, -2079, -3119, -4159, -5199, -6238, -7278, -8318, -9358, -10398, -11438, -12477, -13517, -14557, -15597,
+  -16637, -17677, -18716, -19756, -20796, -21836, -22876, -23916, -24955, -25996, -27035, -28076, -29114, -30156, -31191, -32230,
+  -32767, -32230, -31191, -30156, -29114, -28076, -27035, -25996, -24955, -23916, -22876, -21836, -20796, -19756, -18716, -17677,
+  -16637, -15597, -14557, -13517, -12477, -11438, -10398, -9358, -8318, -7278, -6238, -5199, -4159, -3119, -2079, -1039,
+  0, 1039, 2079, 3119, 4159, 5199, 6238, 7278, 8318, 9358, 10398, 11438, 12477, 13517, 14557, 15597,
+  16637, 17677, 18716, 19756, 20796, 21836, 22876, 23916, 24955, 25996, 27035, 28076, 29114, 30156, 31191, 32230,
+  32767, 31676, 29567, 27464, 25346, 23237, 21122, 19012, 16898, 14787, 12673, 10562, 8449, 6337, 4224, 2112,
+  0, -2112, -4224, -6337, -8449, -10562, -12673, -14787, -16898, -19012, -21122, -23237, -25346, -27464, -29567, -31676,
+  -32767, -31676, -29567, -27464, -25346, -23237, -21122, -19012, -16898, -14787, -12673, -10562, -8449, -6337, -4224, -2112,
+  0, 2112, 4224, 6337, 8449, 10562, 12673, 14787, 16898, 19012, 21122, 23237, 25346, 27464, 29567, 31676,
+  32767, 30515, 26160, 21816, 17443, 13088, 8722, 4362, 0, -4362, -8722, -13088, -17443, -21816, -26160, -30515,
+  -32767, -30515, -26160, -21816, -17443, -13088, -8722, -4362, 0, 4362, 8722, 13088, 17443, 21816, 26160, 30515,
+  32767, 27943, 18637, 9338, 0, -9338, -18637, -27943, -32767, -27943, -18637, -9338, 0, 9338, 18637, 27943,
+  32767, 21514, 0, -21514, -32767, -21514, 0, 21514, 32767, 0, -32767, 0, 0, 0, 0, 0
+};
+
+const int16_t oscFlashSin256[256] = {
+  0, 805, 1610, 2413, 3216, 4016, 4814, 5609, 6401, 7188, 7972, 8751, 9524, 10292, 11053, 11808,
+  12555, 13295, 14027, 14751, 15465, 16170, 16866, 17551, 18226, 18890, 19542, 20182, 20811, 21426, 22029, 22618,
+  23194, 23756, 24303, 24836, 25354, 25856, 26343, 26814, 27269, 27707, 28128, 28533, 28920, 29290, 29642, 29976,
+  30292, 30590, 30870, 31130, 31372, 31595, 31799, 31984, 32149, 32295, 32421, 32528, 32615, 32683, 32730, 32758,
+  32766, 32755, 32723, 32672, 32601, 32511, 32400, 32271, 32121, 31953, 31765, 31557, 31331, 31086, 30822, 30539,
+  30238, 29919, 29582, 29227, 28854, 28463, 28056, 27631, 27190, 26733, 26259, 25769, 25264, 24744, 24209, 23659,
+  23094, 22516, 21924, 21319, 20701, 20071, 19428, 18774, 18108, 17432, 16745, 16048, 15341, 14624, 13899, 13166,
+  12425, 11676, 10920, 10157, 9389, 8614, 7835, 7051, 6262, 5470, 4674, 3876, 3075, 2273, 1469, 664,
+  -141, -946, -1750, -2554, -3356, -4156, -4954, -5748, -6539, -7326, -8109, -8886, -9659, -10425, -11186, -11939,
+  -12685, -13424, -14155, -14877, -15589, -16293, -16987, -17670, -18343, -19005, -19655, -20293, -20919, -21533, -22133, -22720,
+  -23294, -23853, -24398, -24928, -25443, -25943, -26427, -26895, -27347, -27782, -28201, -28602, -28986, -29353, -29702, -30033,
+  -30346, -30641, -30917, -31174, -31413, -31632, -31833, -32014, -32176, -32318, -32441, -32545, -32628, -32692, -32737, -32761,
+  -32766, -32751, -32716, -32661, -32587, -32493, -32379, -32246, -32093, -31921, -31730, -31519, -31290, -31041, -30774, -30488,
+  -30184, -29861, -29521, -29162, -28786, -28393, -27983, -27555, -27111, -26651, -26174, -25682, -25174, -24651, -24113, -23561,
+  -22994, -22413, -21819, -21212, -20592, -19959, -19314, -18658, -17991, -17312, -16623, -15924, -15216, -14498, -13772, -13037,
+  -12294, -11544, -10787, -10023, -9253, -8478, -7698, -6913, -6124, -5331, -4535, -3736, -2935, -2132, -1328, -523
+};
+
+const int16_t oscFlashTri256[256] = {
+  32767, 32255, 31743, 31231, 30719, 30207, 29695, 29183, 28671, 28159, 27647, 27135, 26623, 26111, 25599, 25087,
+  24575, 24063, 23551, 23039, 22527, 22015, 21503, 20991, 20479, 19967, 19455, 18943, 18431, 17919, 17407, 16895,
+  16383, 15871, 15359, 14847, 14335, 13823, 13311, 12799, 12287, 11775, 11263, 10751, 10239, 9727, 9215, 8703,
+  8191, 7679, 7167, 6655, 6143, 5631, 5119, 4607, 4095, 3583, 3071, 2559, 2047, 1535, 1023, 511,
+  0, -511, -1023, -1535, -2047, -2559, -3071, -3583, -4095, -4607, -5119, -5631, -6143, -6655, -7167, -7679,
+  -8191, -8703, -9215, -9727, -10239, -10751, -11263, -11775, -12287, -12799, -13311, -13823, -14335, -14847, -15359, -15871,
+  -16383, -16895, -17407, -17919, -18431, -18943, -19455, -19967, -20479, -20991, -21503, -22015, -22527, -23039, -23551, -24063,
+  -24575, -25087, -25599, -26111, -26623, -27135, -27647, -28159, -28671, -29183, -29695, -30207, -30719, -31231, -31743, -32255,
+  -32767, -32255, -31743, -31231, -30719, -30207, -29695, -29183, -28671, -28159, -27647, -27135, -26623, -26111, -25599, -25087,
+  -24575, -24063, -23551, -23039, -22527, -22015, -21503, -20991, -20479, -19967, -19455, -18943, -18431, -17919, -17407, -16895,
+  -16383, -15871, -15359, -14847, -14335, -13823, -13311, -12799, -12287, -11775, -11263, -10751, -10239, -9727, -9215, -8703,
+  -8191, -7679, -7167, -6655, -6143, -5631, -5119, -4607, -4095, -3583, -3071, -2559, -2047, -1535, -1023, -511,
+  0, 511, 1023, 1535, 2047, 2559, 3071, 3583, 4095, 4607, 5119, 5631, 6143, 6655, 7167, 7679,
+  8191, 8703, 9215, 9727, 10239, 10751, 11263, 11775, 12287, 12799, 13311, 13823, 14335, 14847, 15359, 15871,
+  16383, 16895, 17407, 17919, 18431, 18943, 19455, 19967, 20479, 20991, 21503, 22015, 22527, 23039, 23551, 24063,
+  24575, 25087, 25599, 26111, 26623, 27135, 27647, 28159, 28671, 29183, 29695, 30207, 30719, 31231, 31743, 32255
+};
+
+/** Return a standard table held in flash, or NULL if there is none of that shape and size */
+inline
+const int16_t * oscFlashTable(int shape, int size) {
+  if (shape == OSC_SIN && size == 4096) return oscFlashSin;
+  if (shape == OSC_COS && size == 4096) return oscFlashCos;
+  if (shape == OSC_TRI && size == 4096) return oscFlashTri;
+  if (shape == OSC_SAW && size == 4096) return oscFlashSaw;
+  if (shape == OSC_SQR && size == 4096) return oscFlashSqr;
+  if (shape == OSC_SAW_MIP) return oscFlashSawMip;
+  if (shape == OSC_SQR_MIP) return oscFlashSqrMip;
+  if (shape == OSC_TRI_MIP) return oscFlashTriMip;
+  if (shape == OSC_SIN && size == 256) return oscFlashSin256;
+  if (shape == OSC_TRI && size == 256) return oscFlashTri256;
+  return NULL;
+}
+
+#else // other table sizes are generated
+
+inline
+const int16_t * oscFlashTable(int, int) {
+  return NULL;
+}
+
+#endif
+
+#endif /* WAVETABLES_H_ */
@@ -0,0 +1,188 @@
+// M16 Benchmark example
+// Times the main DSP classes on the board and prints a checksum of each output,
+// so releases can be compared for speed and for bit exact (or changed) results.
+// Audio is not started, so nothing else competes for the CPU while timing.
+// For off-device timing and golden output checks, see extras/host.
+#include "M16.h"
+#include "Osc.h"
+#include "Env.h"
+#include "SVF.h"
+#include "SVF2.h"
+#include "SVFBank.h"
+#include "Bob.h"
+#include "Del.h"
+#include "FX.h"
+
+#if IS_ESP8266()
+const size_t benchSamples = dmaBufferLength * 16; // about 16 KB of buffers, to fit ESP8266 RAM
+const unsigned int benchDelayTime = 100; // ms
+#else
+const size_t benchSamples = dmaBufferLength * 64; // samples per test
+const unsigned int benchDelayTime = 500;
+#endif
+int16_t * waveTable; // a shared table from Osc::getTable()
+int32_t input[benchSamples]; // the same test signal for every filter and effect
+int32_t inputRight[benchSamples];
+int16_t output[benchSamples];
+int16_t outputRight[benchSamples];
+uint16_t envOutput[benchSamples];
+uint32_t startCycles;
+
+/** Fill the test signal, a saw with a little noise, the same on every board */
+void makeInput() {
+  uint32_t seed = 12345;
+  for (size_t i=0; i<benchSamples; i++) {
+    seed = seed * 1664525 + 1013904223;
+    int32_t saw = (int32_t)((i * 97) % 2048) * 16 - 16384;
+    input[i] = saw + ((int32_t)(seed >> 20) - 2048);
+    inputRight[i] = -input[i];
+  }
+}
+
+/** Return an FNV-1a hash of a block of samples */
+uint32_t checksum(const int16_t * buf, size_t n) {
+  uint32_t h = 2166136261;
+  for (size_t i=0; i<n; i++) {
+    h = (h ^ (uint16_t)buf[i]) * 16777619;
+  }
+  return h;
+}
+
+void startTimer() {
+  startCycles = audioCycles();
+}
+
+/** Print the time taken since startTimer() and a checksum of the output */
+void report(const char * name, const int16_t * buf, size_t n) {
+  uint32_t cycles = audioCycles() - startCycles;
+  float nsPerSample = cycles * 1000.0f / ESP.getCpuFreqMHz() / n;
+  float budget = (float)cycles / n * 100.0f / audioCyclesPerSample; // % of one core at SAMPLE_RATE
+  Serial.print(name);
+  Serial.print("\t");
+  Serial.print(nsPerSample, 1);
+  Serial.print(" ns/sample\t");
+  Serial.print((uint32_t)(1000000000.0f / nsPerSample));
+  Serial.print(" samples/s\t");
+  Serial.print(budget, 2);
+  Serial.print("% CPU\tchecksum ");
+  Serial.println(checksum(buf, n), HEX);
+}
+
+void benchOsc() {
+  Osc osc(waveTable);
+  osc.setPitch(60);
+  startTimer();
+  for (size_t i=0; i<benchSamples; i++) output[i] = osc.next();
+  report("Osc next()", output, benchSamples);
+  Osc oscBlock(waveTable);
+  oscBlock.setPitch(60);
+  startTimer();
+  for (size_t i=0; i<benchSamples; i+=dmaBufferLength) oscBlock.next(output + i, dmaBufferLength);
+  report("Osc next(block)", output, benchSamples);
+}
+
+void benchEnv() {
+  Env env;
+  env.setSampleMode(true);
+  env.setAttack(10);
+  env.setDecay(30);
+  env.start();
+  startTimer();
+  for (size_t i=0; i<benchSamples; i+=dmaBufferLength) env.next(envOutput + i, dmaBufferLength);
+  report("Env next(block)", (int16_t *)envOutput, benchSamples);
+}
+
+void benchSVF() {
+  SVF filter;
+  filter.setRes(0.5);
+  filter.setFreq(1200);
+  startTimer();
+  for (size_t i=0; i<benchSamples; i++) output[i] = filter.nextLPF(input[i]);
+  report("SVF nextLPF()", output, benchSamples);
+  SVF filterBlock;
+  filterBlock.setRes(0.5);
+  filterBlock.setFreq(1200);
+  startTimer();
+  for (size_t i=0; i<benchSamples; i+=dmaBufferLength) filterBlock.nextLPF(input + i, output + i, dmaBufferLength);
+  report("SVF nextLPF(block)", output, benchSamples);
+  SVF2 filter2;
+  filter2.setRes(0.5);
+  filter2.setFreq(1200);
+  startTimer();
+  for (size_t i=0; i<benchSamples; i+=dmaBufferLength) filter2.nextLPF(input + i, output + i, dmaBufferLength);
+  report("SVF2 nextLPF(block)", output, benchSamples);
+  // four filters of the same input, reported per filter sample
+  static SVFBank<4> bank;
+  static int32_t bankIn[4 * dmaBufferLength];
+  static int16_t bankOut[4 * dmaBufferLength];
+  bank.setRes(0.5);
+  for (int v=0; v<4; v++) bank.setFreq(v, 600 * (v + 1));
+  uint32_t benchCycles = 0;
+  for (size_t i=0; i<benchSamples; i+=dmaBufferLength) {
+    for (int v=0; v<4; v++) memcpy(bankIn + v * dmaBufferLength, input + i, dmaBufferLength * sizeof(int32_t));
+    startTimer();
+    bank.nextLPF(bankIn, bankOut, dmaBufferLength);
+    benchCycles += audioCycles() - startCycles;
+    memcpy(output + i, bankOut + 3 * dmaBufferLength, dmaBufferLength * sizeof(int16_t));
+  }
+  startCycles = audioCycles() - benchCycles / 4; // time per filter, checksum of the last filter
+  report("SVFBank<4> per filter", output, benchSamples);
+}
+
+void benchBob() {
+  int factors[] = {1, 2, 4};
+  const char * names[] = {"Bob next(block) x1", "Bob next(block) x2", "Bob next(block) x4"};
+  for (int f=0; f<3; f++) {
+    Bob filter;
+    filter.setRes(0.5);
+    filter.setFreq(1200);
+    filter.setOversample(factors[f]);
+    startTimer();
+    for (size_t i=0; i<benchSamples; i+=dmaBufferLength) filter.next(input + i, output + i, dmaBufferLength);
+    report(names[f], output, benchSamples);
+  }
+}
+
+void benchDel() {
+  Del delay(benchDelayTime, benchDelayTime / 2, 0.5, true);
+  startTimer();
+  for (size_t i=0; i<benchSamples; i++) output[i] = delay.next(input[i]);
+  report("Del next()", output, benchSamples);
+}
+
+void benchFX() {
+  FX effect;
+  effect.setReverbSize(8);
+  effect.setReverbLength(0.6);
+  startTimer();
+  for (size_t i=0; i<benchSamples; i+=dmaBufferLength) {
+    effect.reverbStereo(input + i, inputRight + i, output + i, outputRight + i, dmaBufferLength);
+  }
+  report("FX reverbStereo(block)", output, benchSamples);
+  FX chorusEffect;
+  startTimer();
+  for (size_t i=0; i<benchSamples; i++) output[i] = chorusEffect.chorus(input[i]);
+  report("FX chorus()", output, benchSamples);
+}
+
+void setup() {
+  Serial.begin(115200);
+  delay(1000);
+  waveTable = Osc::getTable(OSC_SAW);
+  makeInput();
+  audioProfileInit(); // cycle budgets, without starting audio
+  Serial.print("M16 benchmark, ");
+  Serial.print(ESP.getCpuFreqMHz());
+  Serial.print(" MHz, ");
+  Serial.print(SAMPLE_RATE);
+  Serial.println(" Hz");
+  benchOsc();
+  benchEnv();
+  benchSVF();
+  benchBob();
+  benchDel();
+  benchFX();
+  Serial.println("done");
+}
+
+void loop() {}
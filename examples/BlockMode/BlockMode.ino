@@ -0,0 +1,49 @@
+// M16 Block mode example
+// Render audio a block at a time with audioUpdateBlock()
+#include "M16.h" 
+#include "Osc.h"
+#include "SVF.h"
+
+Osc osc1;
+SVF filter;
+int16_t vol = 1000; // 0 - 1024, 10 bit
+int16_t oscBuf[dmaBufferLength];
+int32_t mixBuf[dmaBufferLength];
+unsigned long msNow = millis();
+unsigned long pitchTime = msNow;
+
+void setup() {
+  Serial.begin(115200);
+  delay(200);
+  osc1.setTable(Osc::getTable(OSC_SAW)); // a shared standard table, in flash on ESP32
+  osc1.setPitch(48);
+  filter.setRes(0.3);
+  filter.setFreq(1200);
+  audioStart();
+}
+
+void loop() {
+  msNow = millis();
+
+  if (msNow - pitchTime > 500 || msNow - pitchTime < 0) {
+    pitchTime = msNow;
+    int pitch = random(24) + 36;
+    osc1.setPitch(pitch);
+    filter.setFreq(mtof(pitch + 24));
+  }
+}
+
+/* Use audioUpdateBlock instead of audioUpdate
+* to fill n samples of the left and right channels at a time.
+* There is no need to call i2s_write_samples()
+*/
+void audioUpdateBlock(int16_t * left, int16_t * right, size_t n) {
+  osc1.next(oscBuf, n);
+  for (size_t i=0; i<n; i++) {
+    mixBuf[i] = (oscBuf[i] * vol)>>10;
+  }
+  filter.nextLPF(mixBuf, left, n);
+  for (size_t i=0; i<n; i++) {
+    right[i] = left[i];
+  }
+}
@@ -7,11 +7,9 @@
 // #include "SVF2.h" // for comparison
 // #include "SVF.h" // for comparison
 
-int16_t waveTable [TABLE_SIZE]; // empty wavetable
-int16_t sineTable [TABLE_SIZE]; // empty wavetable
-Osc osc1(waveTable);
-Osc lfo1(sineTable);
-Osc lfo2(sineTable);
+Osc osc1;
+Osc lfo1;
+Osc lfo2;
 Bob lpf;
 // SVF2 lpf; // for comparison
 // SVF lpf; // for comparison
@@ -23,8 +21,9 @@ int pitchDelta = 4000;
 
 void setup() {
   Serial.begin(115200);
-  Osc::sawGen(waveTable);
-  Osc::sinGen(sineTable);
+  osc1.setTable(Osc::getTable(OSC_SAW)); // a shared standard table, in flash on ESP32
+  lfo1.setTable(Osc::getTable(OSC_SIN));
+  lfo2.setTable(Osc::getTable(OSC_SIN));
   osc1.setPitch(55);
   // osc1.setSpread(0.0002, -0.0002);
   lfo1.setFreq(0.2);
@@ -3,14 +3,12 @@
 #include "Osc.h"
 #include "FX.h"
 
-int16_t sawTable[TABLE_SIZE]; 
-int16_t triTable[TABLE_SIZE];
-Osc osc(sawTable);
+Osc osc;
 int16_t vol = 1000; // 0 - 1024, 10 bit
 unsigned long msNow = millis();
 unsigned long pitchTime = msNow;
 unsigned long lfoTime = msNow;
-Osc lfo(triTable);
+Osc lfo;
 float lfoRate = 0.1; // hz
 float pitch = 60;
 FX effects;
@@ -18,10 +16,11 @@ FX effects;
 void setup() {
   Serial.begin(115200);
   delay(200);
-  Osc::sawGen(sawTable); // fill the sawTable
+  osc.setTable(Osc::getTable(OSC_SAW)); // shared standard tables, in flash on ESP32
   osc.setPitch(pitch);
-  Osc::triGen(triTable); // fill the sawTable
+  lfo.setTable(Osc::getTable(OSC_TRI, 256), 256); // an LFO needs only a small table
   lfo.setFreq(lfoRate);
+  effects.initChorus(); // allocate the chorus delays here, not on the audio task
   audioStart();
 }
 
@@ -0,0 +1,61 @@
+// M16 Clock sync example
+// Step a sequence in time with an external MIDI clock, at exact sample offsets
+#include "M16.h"
+#include "Osc.h"
+#include "Env.h"
+#include "Seq.h"
+#include "MIDI16.h"
+#include "Clock.h"
+
+Osc osc1;
+Env ampEnv;
+int pitches[] = {48, 55, 60, 63, 67, 60, 58, 55};
+Seq seq1(pitches, 8, 4);
+MIDI16 midi;
+Clock clock1;
+uint16_t envBuf[dmaBufferLength];
+int16_t oscBuf[dmaBufferLength];
+
+void step(uint32_t count) {
+  osc1.setPitch(seq1.next());
+  ampEnv.start();
+}
+
+void setup() {
+  #if IS_ESP32()
+    Serial.begin(115200); // on ESP8266 Serial is the MIDI port, already opened at 31250 by midi
+  #endif
+  delay(200);
+  osc1.setTable(Osc::getTable(OSC_SAW)); // a shared standard table, in flash on ESP32
+  ampEnv.setSampleMode(true); // timed in samples, so notes start exactly on the step
+  ampEnv.setAttack(2);
+  ampEnv.setDecay(120);
+  ampEnv.setSustain(0);
+  clock1.setStepDiv(seq1.getStepDiv());
+  clock1.setStepCallback(step);
+  clock1.setExternal(true); // set false and call start() to free run at setTempo()
+  audioStart();
+}
+
+void loop() {
+  #if IS_ESP8266()
+    midi.poll(); // ESP8266 has no serial receive event, so parse MIDI here
+  #endif
+  // on ESP32 MIDI is parsed as it arrives, and steps run in the audio task
+}
+
+void render(int16_t * left, int16_t * right, size_t n) {
+  osc1.next(oscBuf, n);
+  ampEnv.next(envBuf, n);
+  for (size_t i=0; i<n; i++) {
+    left[i] = right[i] = (oscBuf[i] * envBuf[i])>>16;
+  }
+}
+
+void audioUpdateBlock(int16_t * left, int16_t * right, size_t n) {
+  MIDI16::MidiEvent e;
+  while (midi.getEvent(e)) {
+    if (e.status >= MIDI16::clock) clock1.handle(e.status, e.time);
+  }
+  clock1.process(render, left, right, n);
+}
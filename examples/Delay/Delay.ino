@@ -5,8 +5,7 @@
 #include "Env.h"
 
 Del delay1(500); // max delay time in ms
-int16_t triTable [TABLE_SIZE]; // empty array
-Osc osc1(triTable);
+Osc osc1;
 Env ampEnv1;
 
 unsigned long msNow, noteTime, envTime, delTime;
@@ -20,7 +19,7 @@ void setup() {
   delay1.setLevel(0.8); // 0 - 1
   delay1.setFeedback(true); // bool
   delay1.setFeedbackLevel(0.6); // 0 - 1
-  Osc::triGen(triTable);
+  osc1.setTable(Osc::getTable(OSC_TRI)); // a shared standard table, in flash on ESP32
   osc1.setPitch(60);
   ampEnv1.setAttack(10);
   audioStart();
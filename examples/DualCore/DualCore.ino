@@ -0,0 +1,63 @@
+// M16 Dual core example
+// Split the voices of a patch across both ESP32 cores
+// Core 1 renders its voices ahead into a queue, core 0 mixes them in and writes to I2S
+#include "M16.h" 
+#include "Osc.h"
+#include "SVF.h"
+
+int16_t * waveTable; // a shared table from Osc::getTable()
+const int voicesPerCore = 2;
+Osc osc0[voicesPerCore]; // rendered on core 0
+Osc osc1[voicesPerCore]; // rendered on core 1
+SVF filter0, filter1;
+int16_t oscBuf0[dmaBufferLength], oscBuf1[dmaBufferLength];
+int32_t mixBuf0[dmaBufferLength], mixBuf1[dmaBufferLength];
+int scale [] = {0, 2, 4, 7, 9, 0, 0, 0, 0, 0, 0, 0};
+unsigned long msNow = millis();
+unsigned long pitchTime = msNow;
+
+void setup() {
+  Serial.begin(115200);
+  delay(200);
+  waveTable = Osc::getTable(OSC_SAW);
+  for (int i=0; i<voicesPerCore; i++) {
+    osc0[i].setTable(waveTable);
+    osc1[i].setTable(waveTable);
+  }
+  filter0.setFreq(2000);
+  filter1.setFreq(2000);
+  audioStart();
+}
+
+void loop() {
+  msNow = millis();
+
+  if (msNow - pitchTime > 1000 || msNow - pitchTime < 0) {
+    pitchTime = msNow;
+    for (int i=0; i<voicesPerCore; i++) {
+      osc0[i].setPitch(pitchQuantize(random(24) + 48, scale, 0));
+      osc1[i].setPitch(pitchQuantize(random(24) + 48, scale, 0));
+    }
+  }
+}
+
+/* Mix a set of voices through a filter into the left and right blocks */
+void renderVoices(Osc * oscs, SVF &filter, int16_t * oscBuf, int32_t * mixBuf, int16_t * left, int16_t * right, size_t n) {
+  for (size_t i=0; i<n; i++) mixBuf[i] = 0;
+  for (int v=0; v<voicesPerCore; v++) {
+    oscs[v].next(oscBuf, n);
+    for (size_t i=0; i<n; i++) mixBuf[i] += oscBuf[i]>>2;
+  }
+  filter.nextLPF(mixBuf, left, n);
+  for (size_t i=0; i<n; i++) right[i] = left[i];
+}
+
+/* Render half of the voices on core 0 */
+void audioUpdateBlock(int16_t * left, int16_t * right, size_t n) {
+  renderVoices(osc0, filter0, oscBuf0, mixBuf0, left, right, n);
+}
+
+/* Render the other half of the voices on core 1 */
+void audioUpdateBlockCore1(int16_t * left, int16_t * right, size_t n) {
+  renderVoices(osc1, filter1, oscBuf1, mixBuf1, left, right, n);
+}
@@ -8,9 +8,8 @@
 #include "SVF.h"
 #include "Env.h"
 
-int16_t waveTable [TABLE_SIZE]; // empty wavetable
-Osc aOsc1(waveTable);
-Osc modOsc(waveTable);
+Osc aOsc1;
+Osc modOsc;
 SVF filter;
 Env modEnv;
 int16_t vol = 1000; // 0 - 1024, 10 bit
@@ -22,7 +21,8 @@ float modVal, modIndex = 0.5;
 
 void setup() {
   Serial.begin(115200);
-  Osc::sinGen(waveTable); // fill the wavetable
+  aOsc1.setTable(Osc::getTable(OSC_SIN)); // a shared standard table, in flash on ESP32
+  modOsc.setTable(Osc::getTable(OSC_SIN));
   aOsc1.setPitch(69);
   filter.setFreq(6000);
   modEnv.setAttack(400);
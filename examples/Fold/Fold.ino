@@ -3,8 +3,7 @@
 #include "Osc.h"
 #include "FX.h"
 
-int16_t waveTable[TABLE_SIZE]; // empty wavetable
-Osc osc1(waveTable);
+Osc osc1;
 FX effects1;
 int16_t vol = 1000; // 0 - 1024, 10 bit
 float foldAmnt = 1.0;
@@ -15,7 +14,7 @@ unsigned long foldTime = msNow;
 void setup() {
   Serial.begin(115200);
   delay(200);
-  Osc::triGen(waveTable); // fill the wavetable
+  osc1.setTable(Osc::getTable(OSC_TRI)); // a shared standard table, in flash on ESP32
   osc1.setPitch(69);
   // seti2sPins(25, 27, 12, 21); // bck, ws, data_out, data_in // change ESP32 defaults
   audioStart();
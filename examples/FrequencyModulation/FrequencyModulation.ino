@@ -2,10 +2,8 @@
 #include "M16.h"
 #include "Osc.h"
 
-int16_t sineTable[TABLE_SIZE]; // empty wavetable
-
-Osc aOsc1(sineTable);
-Osc aOsc2(sineTable);
+Osc aOsc1;
+Osc aOsc2;
 
 float modIndex = 0.2;
 unsigned long msNow = millis();
@@ -13,7 +11,8 @@ unsigned long pitchTime = msNow;
 
 void setup() {
   Serial.begin(115200);
-  Osc::sinGen(sineTable); // fill wavetable
+  aOsc1.setTable(Osc::getTable(OSC_SIN)); // a shared standard table, in flash on ESP32
+  aOsc2.setTable(Osc::getTable(OSC_SIN));
   audioStart();
 }
 
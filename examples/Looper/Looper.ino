@@ -0,0 +1,60 @@
+// M16 Looper Example
+// Record four seconds of notes into a long delay, then loop them
+// The delay buffer is placed in PSRAM on ESP32 boards that have it
+#include "M16.h"
+#include "LongDel.h"
+#include "Osc.h"
+#include "Env.h"
+
+LongDel looper;
+Osc osc1;
+Env ampEnv1;
+
+unsigned long msNow, noteTime, envTime, loopTime;
+int scale [] = {0, 2, 4, 5, 7, 9, 0, 0, 0, 0, 0};
+
+void setup() {
+  Serial.begin(115200);
+  delay(200);
+  looper.setMaxDelayTime(4000); // ms
+  Serial.print("Looper buffer size: ");Serial.println(looper.getBufferSize());
+  looper.setTime(4000); // ms up to buffer size
+  looper.setFeedbackLevel(0.7); // 0 - 1
+  osc1.setTable(Osc::getTable(OSC_TRI)); // a shared standard table, in flash on ESP32
+  ampEnv1.setAttack(10);
+  ampEnv1.setRelease(300);
+  audioStart();
+  loopTime = millis() + 8000;
+}
+
+void loop() {
+  #if IS_ESP8266()
+    audioUpdate(); //for ESP8266
+  #endif 
+  
+  msNow = millis();
+
+  if (msNow > noteTime && !looper.getHold()) {
+    noteTime = msNow + 250 * (random(3) + 1);
+    osc1.setPitch(pitchQuantize(random(25) + 48, scale, 0));
+    ampEnv1.start();
+  }
+
+  if (msNow > envTime) {
+    envTime = msNow + 1;
+    ampEnv1.next();
+  }
+
+  if (msNow > loopTime) {
+    loopTime = msNow + 8000;
+    looper.setHold(!looper.getHold()); // alternate between recording and looping
+    Serial.println(looper.getHold() ? "Looping" : "Recording");
+  }
+}
+
+void audioUpdate() {
+  int16_t oscVal = (osc1.next() * ampEnv1.getValue())>>16;
+  int16_t leftVal = (oscVal + looper.next(oscVal))>>1;
+  int16_t rightVal = leftVal;
+  i2s_write_samples(leftVal, rightVal);
+}
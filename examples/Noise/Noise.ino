@@ -4,13 +4,10 @@
 #include "Osc.h"
 #include "Env.h"
 
-int16_t whiteTable [TABLE_SIZE]; // empty wavetable
-int16_t pinkTable [TABLE_SIZE]; 
-int16_t brownTable [TABLE_SIZE]; 
 int16_t crackleTable [TABLE_SIZE]; 
-Osc whiteOsc(whiteTable); //instantiate oscillator and assign a table
-Osc pinkOsc(pinkTable);
-Osc brownOsc(brownTable);
+Osc whiteOsc; //instantiate oscillators, shared tables are assigned in setup()
+Osc pinkOsc;
+Osc brownOsc;
 Osc crackleOsc(crackleTable);
 
 Env ampEnvW, ampEnvP, ampEnvB, ampEnvC; // envelopes
@@ -22,9 +19,9 @@ byte color = 0;
 
 void setup() {
   Serial.begin(115200);
-  Osc::noiseGen(whiteTable); // fill wavetable
-  Osc::pinkNoiseGen(pinkTable);
-  Osc::brownNoiseGen(brownTable);
+  whiteOsc.setTable(Osc::getTable(OSC_NOISE)); // shared noise tables, generated once
+  pinkOsc.setTable(Osc::getTable(OSC_PINK_NOISE));
+  brownOsc.setTable(Osc::getTable(OSC_BROWN_NOISE));
   Osc::crackleGen(crackleTable);
   whiteOsc.setNoise(true);
   pinkOsc.setNoise(true);
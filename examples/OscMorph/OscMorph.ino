@@ -3,9 +3,8 @@
 #include "M16.h"
 #include "Osc.h"
 
-int16_t sawTable[TABLE_SIZE]; // empty wavetable
-int16_t triTable[TABLE_SIZE]; // empty wavetable
-Osc aOsc1(sawTable);
+int16_t * triTable; // a shared table from Osc::getTable()
+Osc aOsc1;
 int16_t vol = 1000; // 0 - 1024, 10 bit
 float morphVal = 0;
 bool morphUp = true;
@@ -15,8 +14,8 @@ unsigned long morphTime = msNow;
 
 void setup() {
   Serial.begin(115200);
-  Osc::sawGen(sawTable); // fill the wavetable
-  Osc::triGen(triTable); // fill the wavetable
+  aOsc1.setTable(Osc::getTable(OSC_SAW)); // a shared standard table, in flash on ESP32
+  triTable = Osc::getTable(OSC_TRI);
   aOsc1.setPitch(60);
   audioStart();
 }
@@ -6,8 +6,7 @@
 #include "SVF.h"
 #include "FX.h"
 
-int16_t noiseTable [TABLE_SIZE]; // empty wavetable
-Osc aOsc1(noiseTable);
+Osc aOsc1;
 Env ampEnv1;
 Arp arp1;
 SVF filter;
@@ -22,7 +21,7 @@ float feedback = 0.9;
 void setup() {
   Serial.begin(115200);
   delay(200);
-  Osc::noiseGen(noiseTable); aOsc1.setNoise(true); // fill wavetable and set noise flag
+  aOsc1.setTable(Osc::getTable(OSC_NOISE)); aOsc1.setNoise(true); // shared noise table and set noise flag
   ampEnv1.setAttack(0);
   ampEnv1.setRelease(2);
   int newSet [] = {48, 52, 55, 58, 60, 64};
@@ -34,6 +33,7 @@ void setup() {
   arp1.start();
   aOsc1.setPitch(arp1.next());
   filter.setFreq(3500);
+  effect1.initPluckBuffer(); // allocate the pluck buffer here, not on the audio task
   audioStart();
 }
 
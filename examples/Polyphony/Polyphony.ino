@@ -5,7 +5,7 @@
 #include "SVF.h"
 #include "FX.h"
 
-int16_t waveTable[TABLE_SIZE]; // empty array
+int16_t * waveTable; // a shared table from Osc::getTable()
 const int poly = 2; // change polyphony as desired, each MCU type will handle particular amounts
 Osc osc[poly];
 Env env[poly];
@@ -22,7 +22,7 @@ int scale [] = {0, 2, 4, 0, 7, 9, 0, 0, 0, 0, 0};
 void setup() {
   Serial.begin(115200);
   // tone
-  Osc::sawGen(waveTable);
+  waveTable = Osc::getTable(OSC_SAW);
   for (int i=0; i<poly; i++) {
     osc[i].setTable(waveTable);
     osc[i].setPitch(60);
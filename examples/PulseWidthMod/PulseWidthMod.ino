@@ -3,10 +3,8 @@
 #include "Osc.h"
 #include "SVF.h"
 
-int16_t waveTable [TABLE_SIZE]; // empty wavetable
-int16_t lfoTable [TABLE_SIZE]; // empty wavetable
-Osc aOsc1(waveTable);
-Osc LFO1(lfoTable); // use an oscillator as an LFO
+Osc aOsc1;
+Osc LFO1; // use an oscillator as an LFO
 SVF filter;
 int16_t vol = 500; // 0 - 1024, 10 bit
 unsigned long msNow = millis();
@@ -17,8 +15,8 @@ float pVal = 0.5;
   
 void setup() {
   Serial.begin(115200);
-  Osc::triGen(lfoTable); // fill wavetable
-  Osc::sqrGen(waveTable); // fill wavetable, try other waves e.g. sinGen, sawGen, triGen
+  LFO1.setTable(Osc::getTable(OSC_TRI)); // a shared standard table, in flash on ESP32
+  aOsc1.setTable(Osc::getTable(OSC_SQR));
   aOsc1.setPitch(57);
   filter.setFreq(1500);
   LFO1.setFreq(0.1); 
@@ -5,8 +5,7 @@
 #include "SVF.h"
 #include "FX.h"
 
-int16_t waveTable [TABLE_SIZE]; // empty array
-Osc osc1(waveTable);
+Osc osc1;
 Env ampEnv1;
 SVF filter1;
 FX effect1;
@@ -23,7 +22,7 @@ float leftPan, rightPan;
 void setup() {
   Serial.begin(115200);
   // tone
-  Osc::sawGen(waveTable);
+  osc1.setTable(Osc::getTable(OSC_SAW)); // a shared standard table, in flash on ESP32
   osc1.setPitch(60);
   ampEnv1.setAttack(30); 
   ampEnv1.setRelease(300);
@@ -2,11 +2,8 @@
 #include "M16.h"
 #include "Osc.h"
 
-int16_t sineWave[TABLE_SIZE]; // empty wavetable
-int16_t squareWave[TABLE_SIZE]; // empty wavetable
-int16_t triangleWave[TABLE_SIZE]; // empty wavetable
-Osc osc1(squareWave); // experiment with different waveform combinations
-Osc osc2(triangleWave);
+Osc osc1; // experiment with different waveform combinations
+Osc osc2;
 
 unsigned long msNow = millis();
 unsigned long modTime = msNow;
@@ -14,9 +11,8 @@ float freqRatio = 0;
 
 void setup() {
   Serial.begin(115200);
-  Osc::sinGen(sineWave); // fill
-  Osc::sqrGen(squareWave); // fill
-  Osc::triGen(triangleWave); // fill
+  osc1.setTable(Osc::getTable(OSC_SQR)); // a shared standard table, in flash on ESP32
+  osc2.setTable(Osc::getTable(OSC_TRI));
   audioStart();
 }
 
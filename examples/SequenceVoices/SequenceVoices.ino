@@ -7,7 +7,7 @@
 #include "Seq.h"
 #include "FX.h"
 
-int16_t sawTable [TABLE_SIZE]; // empty array
+int16_t * sawTable; // a shared table from Osc::getTable()
 
 unsigned long msNow = millis();
 unsigned long stepTime = msNow;
@@ -38,7 +38,7 @@ void seqGen() {
 void setup() {
   Serial.begin(115200);
   delay(200);
-  Osc::sawGen(sawTable);
+  sawTable = Osc::getTable(OSC_SAW);
   for (int i=0; i<voices; i++) {
     oscillators[i].setTable(sawTable);
     oscillators[i].setPitch(60);
@@ -2,8 +2,7 @@
 #include "M16.h" 
 #include "Osc.h"
 
-int16_t waveTable[TABLE_SIZE]; // empty wavetable
-Osc aOsc1(waveTable);
+Osc aOsc1;
 int16_t vol = 1000; // 0 - 1024, 10 bit
 unsigned long msNow = millis();
 unsigned long pitchTime = msNow;
@@ -11,7 +10,7 @@ unsigned long pitchTime = msNow;
 void setup() {
   Serial.begin(115200);
   delay(200);
-  Osc::sinGen(waveTable); // fill the wavetable
+  aOsc1.setTable(Osc::getTable(OSC_SIN)); // a shared standard table, in flash on ESP32
   aOsc1.setPitch(69);
   // seti2sPins(25, 27, 12, 21); // bck, ws, data_out, data_in // change ESP32 defaults
   audioStart();
@@ -6,8 +6,7 @@
 #include "Osc.h"
 #include "SVF.h"
 
-int16_t waveTable [TABLE_SIZE]; // empty wavetable
-Osc aOsc1(waveTable);
+Osc aOsc1;
 SVF filter;
 int16_t vol = 1000; // 0 - 1024, 10 bit
 unsigned long msNow, pitchTime;
@@ -15,7 +14,7 @@ int noteCnt = 0;
 
 void setup() {
   Serial.begin(115200);
-  Osc::sawGen(waveTable); // fill the wavetable
+  aOsc1.setTable(Osc::getTable(OSC_SAW)); // a shared standard table, in flash on ESP32
   aOsc1.setPitch(69);
   filter.setFreq(5000);
   audioStart();
@@ -0,0 +1,56 @@
+// M16 timed events example
+// Post notes from loop() ahead of time, so they start on an exact sample
+#include "M16.h"
+#include "Osc.h"
+#include "Env.h"
+#include "EventQueue.h"
+
+Osc osc1;
+Env ampEnv;
+EventQueue events;
+int pitches[] = {48, 55, 60, 63, 67, 60, 58, 55};
+int noteIndex = 0;
+uint32_t nextNoteTime = 0;
+const uint32_t noteSamples = SAMPLE_RATE / 4; // eighth notes at 120 bpm
+uint16_t envBuf[dmaBufferLength];
+int16_t oscBuf[dmaBufferLength];
+
+void playNote(int pitch, float level) {
+  osc1.setPitch(pitch);
+  ampEnv.setMaxLevel(level);
+  ampEnv.start();
+}
+
+void setup() {
+  Serial.begin(115200);
+  delay(200);
+  osc1.setTable(Osc::getTable(OSC_SAW));
+  ampEnv.setSampleMode(true); // timed in samples, so notes start exactly on the event
+  ampEnv.setAttack(2);
+  ampEnv.setDecay(120);
+  ampEnv.setSustain(0);
+  audioStart();
+  nextNoteTime = events.now() + SAMPLE_RATE / 10;
+}
+
+void loop() {
+  // loop() can be slow or busy, notes only need posting before they are due
+  while ((int32_t)(nextNoteTime - events.now()) < SAMPLE_RATE / 10) {
+    events.post(nextNoteTime, playNote, pitches[noteIndex], (noteIndex % 4 == 0) ? 1.0 : 0.6);
+    noteIndex = (noteIndex + 1) % 8;
+    nextNoteTime += noteSamples;
+  }
+  delay(20);
+}
+
+void render(int16_t * left, int16_t * right, size_t n) {
+  osc1.next(oscBuf, n);
+  ampEnv.next(envBuf, n);
+  for (size_t i=0; i<n; i++) {
+    left[i] = right[i] = (oscBuf[i] * envBuf[i])>>16;
+  }
+}
+
+void audioUpdateBlock(int16_t * left, int16_t * right, size_t n) {
+  events.process(render, left, right, n);
+}
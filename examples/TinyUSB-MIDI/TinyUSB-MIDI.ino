@@ -18,9 +18,8 @@
 #include "SVF.h"
 #include "Del.h"
 
-int16_t sineWave [TABLE_SIZE]; // empty wavetable
-int16_t sawtoothWave [TABLE_SIZE]; // empty wavetable
-Osc osc1(sineWave);
+int16_t * sawtoothWave; // a shared table from Osc::getTable()
+Osc osc1;
 Env ampEnv1;
 SVF filter1;
 Del delay1(500); // max delay time in ms
@@ -67,8 +66,8 @@ void handleCC(byte channel, byte controller, byte value) {
 void setup() {
   Serial.begin(115200);
   // audio
-  Osc::sinGen(sineWave); // fill
-  Osc::sawGen(sawtoothWave); // fill
+  osc1.setTable(Osc::getTable(OSC_SIN)); // a shared standard table, in flash on ESP32
+  sawtoothWave = Osc::getTable(OSC_SAW);
   osc1.setSpread(0.0001); // make more complex
   ampEnv1.setAttack(5);
   ampEnv1.setSustain(0.5);
@@ -0,0 +1,52 @@
+// M16 Example - voice pool
+// Notes are allocated to free voices, and idle voices cost no CPU
+#include "M16.h"
+#include "Voice.h"
+
+int16_t * waveTable; // a shared table from Osc::getTable()
+const int poly = 8; // voices only use CPU while their envelope is active
+Voice voices[poly];
+VoicePool pool(voices, poly);
+int32_t mixBuf[dmaBufferLength];
+
+unsigned long msNow = millis();
+unsigned long noteTime = msNow;
+int noteDelta = 250;
+int scale [] = {0, 2, 4, 0, 7, 9, 0, 0, 0, 0, 0};
+
+void setup() {
+  Serial.begin(115200);
+  waveTable = Osc::getTable(OSC_SAW);
+  for (int i=0; i<poly; i++) {
+    voices[i].osc.setTable(waveTable);
+    voices[i].env.setAttack(30);
+    voices[i].env.setRelease(800);
+    voices[i].filter.setRes(0);
+    voices[i].filter.setFreq(3000);
+  }
+  pool.setStealMode(VOICE_STEAL_QUIETEST); // or VOICE_STEAL_OLDEST
+  audioStart();
+}
+
+void loop() {
+  msNow = millis();
+
+  if (msNow - noteTime > noteDelta || msNow - noteTime < 0) {
+    noteTime = msNow;
+    if (random(10) < 5) {
+      int p = pitchQuantize(random(36) + 48, scale, 0);
+      Voice * v = pool.noteOn(p, random(60) + 60);
+      v->filter.setFreq(min(3000.0f, mtof(p + 24)));
+      Serial.println("Active voices " + String(pool.getActiveCount()));
+    }
+  }
+}
+
+/* The envelopes of active voices are advanced once per block */
+void audioUpdateBlock(int16_t * left, int16_t * right, size_t n) {
+  pool.next(mixBuf, n);
+  for (size_t i=0; i<n; i++) {
+    left[i] = clip16(mixBuf[i] >> 1);
+    right[i] = left[i];
+  }
+}
@@ -4,9 +4,8 @@
 #include "Osc.h"
 #include "FX.h"
 
-int16_t sineTable[TABLE_SIZE]; // empty wavetable
-Osc aOsc1(sineTable);
-Osc lfo1(sineTable);
+Osc aOsc1;
+Osc lfo1;
 FX effect1;
 int16_t vol = 1000; // 0 - 1024, 10 bit
 unsigned long msNow = millis();
@@ -29,7 +28,8 @@ void generateTransferFunction() {
 
 void setup() {
   Serial.begin(115200);
-  Osc::sinGen(sineTable); // fill the wavetable
+  aOsc1.setTable(Osc::getTable(OSC_SIN)); // a shared standard table, in flash on ESP32
+  lfo1.setTable(Osc::getTable(OSC_SIN));
   aOsc1.setPitch(69);
   lfo1.setFreq(0.5);
   generateTransferFunction();
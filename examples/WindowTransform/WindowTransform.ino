@@ -4,12 +4,9 @@
 #include "M16.h"
 #include "Osc.h"
 
-int16_t sineWave[TABLE_SIZE]; // empty wavetable
-// int16_t squareWave [TABLE_SIZE]; // empty wavetable
-// int16_t triangleWave [TABLE_SIZE]; // empty wavetable
-int16_t sawtoothWave[TABLE_SIZE]; // empty wavetable
-Osc osc1(sineWave); // experiment with different waveform combinations
-Osc lfo(sineWave);
+int16_t * sawtoothWave; // a shared table from Osc::getTable()
+Osc osc1; // experiment with different waveform combinations
+Osc lfo;
 
 unsigned long msNow, windowTime;
 float windowSize = 0;
@@ -17,10 +14,11 @@ bool expanding = true;
 
 void setup() {
   Serial.begin(115200);
-  Osc::sinGen(sineWave); // fill
-  // Osc::sqrGen(squareWave); // try other waveshapes
-  // Osc::triGen(triangleWave); 
-  Osc::sawGen(sawtoothWave); // fill
+  osc1.setTable(Osc::getTable(OSC_SIN)); // a shared standard table, in flash on ESP32
+  lfo.setTable(Osc::getTable(OSC_SIN));
+  // osc1.setTable(Osc::getTable(OSC_SQR)); // try other waveshapes
+  // osc1.setTable(Osc::getTable(OSC_TRI));
+  sawtoothWave = Osc::getTable(OSC_SAW);
   osc1.setPitch(48);
   lfo.setFreq(0.1); // Hertz
   // osc1.setSpread(0.005); // make more complex
@@ -0,0 +1,400 @@
+/*
+ * bench.cpp
+ *
+ * Host benchmark and regression harness for the M16 DSP classes
+ *
+ * by Andrew R. Brown 2025
+ *
+ * Runs each class and mode over the same test signal, reporting ns/sample and samples/s,
+ * and compares the output against golden WAV files so that optimisations can be checked
+ * for bit exactness, or for error within a tolerance.
+ *
+ *   m16bench                    time every test and check against golden/
+ *   m16bench --write            write the golden WAVs from this build
+ *   m16bench --tolerance 2      allow outputs to differ from golden by up to 2
+ *   m16bench --golden dir       read or write golden WAVs in dir
+ *   m16bench Bob                run only tests whose names contain "Bob"
+ *
+ * Exits with 1 if any output differs from golden by more than the tolerance.
+ * Build with the Makefile in this directory, which uses the Arduino shim in shim/.
+ *
+ * This file is part of the M16 audio library host tools.
+ *
+ * M16 is licensed under a Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International License.
+ */
+
+#include "M16.h"
+#include "Osc.h"
+#include "Env.h"
+#include "SVF.h"
+#include "SVF2.h"
+#include "SVFBank.h"
+#include "Bob.h"
+#include "Del.h"
+#include "LongDel.h"
+#include "APF.h"
+#include "Samp.h"
+#include "EventQueue.h"
+#include "FX.h"
+#include "FDN.h"
+#include "Noise.h"
+
+#include <string>
+#include <vector>
+
+const size_t benchSamples = SAMPLE_RATE; // one second of audio per timed run
+const size_t goldenSamples = 8192; // the start of each output kept in the golden WAV
+const int benchRuns = 5; // timed runs per test, the fastest is reported
+
+int32_t input[benchSamples]; // the same test signal for every filter and effect
+int32_t inputRight[benchSamples];
+int16_t waveTable[TABLE_SIZE];
+
+/** A test renders n samples of one or two channels from freshly made objects */
+struct Test {
+  const char * name;
+  const char * file;
+  int channels;
+  void (*run)(int16_t * left, int16_t * right, size_t n);
+};
+
+/** Fill the test signal, a saw with a little noise, as in the Benchmark example */
+void makeInput() {
+  uint32_t seed = 12345;
+  for (size_t i=0; i<benchSamples; i++) {
+    seed = seed * 1664525 + 1013904223;
+    int32_t saw = (int32_t)((i * 97) % 2048) * 16 - 16384;
+    input[i] = saw + ((int32_t)(seed >> 20) - 2048);
+    inputRight[i] = -input[i];
+  }
+}
+
+/** Restart the global xorshift96() used by rand(), so every run of a test is identical */
+void resetRandom() {
+  randX = 132456789;
+  randY = 362436069;
+  randZ = 521288629;
+}
+
+void testOsc(int16_t * left, int16_t *, size_t n) {
+  Osc osc(waveTable);
+  osc.setPitch(60);
+  for (size_t i=0; i<n; i++) left[i] = osc.next();
+}
+
+void testOscBlock(int16_t * left, int16_t *, size_t n) {
+  Osc osc(waveTable);
+  osc.setPitch(60);
+  for (size_t i=0; i<n; i+=dmaBufferLength) osc.next(left + i, min((size_t)dmaBufferLength, n - i));
+}
+
+void testOscUnison(int16_t * left, int16_t * right, size_t n) {
+  Osc osc(waveTable);
+  osc.setPitch(48);
+  osc.setUnison(8, 0.3);
+  osc.setUnisonSpread(1);
+  for (size_t i=0; i<n; i+=dmaBufferLength) osc.nextUnison(left + i, right + i, min((size_t)dmaBufferLength, n - i));
+}
+
+void testEnv(int16_t * left, int16_t *, size_t n) {
+  Env env;
+  env.setSampleMode(true);
+  env.setAttack(10);
+  env.setDecay(30);
+  env.start();
+  uint16_t buf[dmaBufferLength];
+  for (size_t i=0; i<n; i+=dmaBufferLength) {
+    size_t len = min((size_t)dmaBufferLength, n - i);
+    env.next(buf, len);
+    for (size_t j=0; j<len; j++) left[i + j] = buf[j] >> 1;
+  }
+}
+
+void testSVF(int16_t * left, int16_t *, size_t n) {
+  SVF filter;
+  filter.setRes(0.5);
+  filter.setFreq(1200);
+  for (size_t i=0; i<n; i++) left[i] = filter.nextLPF(input[i]);
+}
+
+void testSVFBlock(int16_t * left, int16_t *, size_t n) {
+  SVF filter;
+  filter.setRes(0.5);
+  filter.setFreq(1200);
+  for (size_t i=0; i<n; i+=dmaBufferLength) filter.nextLPF(input + i, left + i, min((size_t)dmaBufferLength, n - i));
+}
+
+void testSVF2(int16_t * left, int16_t *, size_t n) {
+  SVF2 filter;
+  filter.setRes(0.5);
+  filter.setFreq(1200);
+  for (size_t i=0; i<n; i+=dmaBufferLength) filter.nextLPF(input + i, left + i, min((size_t)dmaBufferLength, n - i));
+}
+
+/** Four filters of the same input, keeping the output of the highest one */
+void testSVFBank(int16_t * left, int16_t *, size_t n) {
+  SVFBank<4> bank;
+  static int32_t bankIn[4 * dmaBufferLength];
+  static int16_t bankOut[4 * dmaBufferLength];
+  bank.setRes(0.5);
+  for (int v=0; v<4; v++) bank.setFreq(v, 600 * (v + 1));
+  for (size_t i=0; i<n; i+=dmaBufferLength) {
+    size_t len = min((size_t)dmaBufferLength, n - i);
+    for (int v=0; v<4; v++) memcpy(bankIn + v * dmaBufferLength, input + i, len * sizeof(int32_t));
+    bank.nextLPF(bankIn, bankOut, len);
+    memcpy(left + i, bankOut + 3 * dmaBufferLength, len * sizeof(int16_t));
+  }
+}
+
+void testBob(int16_t * left, int factor, size_t n) {
+  Bob filter;
+  filter.setRes(0.5);
+  filter.setFreq(1200);
+  filter.setOversample(factor);
+  for (size_t i=0; i<n; i+=dmaBufferLength) filter.next(input + i, left + i, min((size_t)dmaBufferLength, n - i));
+}
+
+void testBob1(int16_t * left, int16_t *, size_t n) { testBob(left, 1, n); }
+void testBob2(int16_t * left, int16_t *, size_t n) { testBob(left, 2, n); }
+void testBob4(int16_t * left, int16_t *, size_t n) { testBob(left, 4, n); }
+
+/** Sweep the cutoff from 20 Hz to 20 kHz at high resonance over the golden samples, then hold it there
+* The filter must stay stable at every factor.
+*/
+void testBobSweep(int16_t * left, int factor, size_t n) {
+  Bob filter;
+  filter.setRes(0.9);
+  filter.setOversample(factor);
+  int32_t buf[dmaBufferLength];
+  for (size_t i=0; i<n; i+=dmaBufferLength) {
+    size_t len = min((size_t)dmaBufferLength, n - i);
+    filter.setFreq(20.0f * pow(1000.0f, min(1.0f, (float)i / goldenSamples)));
+    for (size_t j=0; j<len; j++) buf[j] = input[i + j] >> 2;
+    filter.next(buf, left + i, len);
+  }
+}
+
+void testBobSweep1(int16_t * left, int16_t *, size_t n) { testBobSweep(left, 1, n); }
+void testBobSweep2(int16_t * left, int16_t *, size_t n) { testBobSweep(left, 2, n); }
+void testBobSweep4(int16_t * left, int16_t *, size_t n) { testBobSweep(left, 4, n); }
+
+void testDel(int16_t * left, int16_t *, size_t n) {
+  Del delay(500, 250, 0.5, true);
+  for (size_t i=0; i<n; i++) left[i] = delay.next(input[i]);
+}
+
+void testLongDel(int16_t * left, int16_t *, size_t n) {
+  LongDel delay(500, 123.4);
+  delay.setFeedback(true);
+  delay.setFeedbackLevel(0.5);
+  for (size_t i=0; i<n; i+=dmaBufferLength) delay.next(input + i, left + i, min((size_t)dmaBufferLength, n - i));
+}
+
+void testAPF(int16_t * left, int16_t *, size_t n) {
+  APF filter(30, 0.6);
+  for (size_t i=0; i<n; i++) left[i] = filter.next(input[i] >> 1);
+}
+
+/** Interpolated playback of the wave table as a looped sample, at a speed between table steps */
+void testSamp(int16_t * left, int16_t *, size_t n) {
+  Samp samp(waveTable, TABLE_SIZE);
+  samp.setLoopingOn();
+  samp.setSpeed(0.7317);
+  samp.start();
+  for (size_t i=0; i<n; i+=dmaBufferLength) samp.next(left + i, min((size_t)dmaBufferLength, n - i));
+}
+
+Osc * eventOsc = nullptr; // played by renderEventOsc(), retuned by events
+
+void renderEventOsc(int16_t * left, int16_t *, size_t n) {
+  eventOsc->next(left, n);
+}
+
+void setEventPitch(int pitch, float) {
+  eventOsc->setPitch(pitch);
+}
+
+/** Pitch changes posted at sample times that fall inside blocks, counted as the audio task does */
+void testEventQueue(int16_t * left, int16_t * right, size_t n) {
+  Osc osc(waveTable);
+  osc.setPitch(60);
+  eventOsc = &osc;
+  audioSampleCount = 0;
+  EventQueue events;
+  for (int e=0; e<16; e++) events.post(37 + e * 517, setEventPitch, 60 + (e * 7) % 13);
+  for (size_t i=0; i<n; i+=dmaBufferLength) {
+    size_t len = min((size_t)dmaBufferLength, n - i);
+    events.process(renderEventOsc, left + i, right + i, len);
+    audioSampleCount = audioSampleCount + len;
+  }
+  eventOsc = nullptr;
+}
+
+void testReverb(int16_t * left, int16_t * right, size_t n) {
+  FX effect;
+  effect.setReverbSize(8);
+  effect.setReverbLength(0.6);
+  for (size_t i=0; i<n; i+=dmaBufferLength) {
+    effect.reverbStereo(input + i, inputRight + i, left + i, right + i, min((size_t)dmaBufferLength, n - i));
+  }
+}
+
+void testChorus(int16_t * left, int16_t *, size_t n) {
+  FX effect;
+  for (size_t i=0; i<n; i++) left[i] = effect.chorus(input[i]);
+}
+
+void testFDN(int16_t * left, int16_t * right, size_t n) {
+  FDN<8> reverb;
+  reverb.init(); // as a sketch would in setup()
+  for (size_t i=0; i<n; i+=dmaBufferLength) {
+    reverb.next(input + i, inputRight + i, left + i, right + i, min((size_t)dmaBufferLength, n - i));
+  }
+}
+
+void testPink(int16_t * left, int16_t *, size_t n) {
+  Noise noise(1234);
+  noise.setType(NOISE_PINK);
+  for (size_t i=0; i<n; i+=dmaBufferLength) noise.next(left + i, min((size_t)dmaBufferLength, n - i));
+}
+
+const Test tests[] = {
+  {"Osc next()", "osc", 1, testOsc},
+  {"Osc next(block)", "osc_block", 1, testOscBlock},
+  {"Osc nextUnison(block) x8", "osc_unison", 2, testOscUnison},
+  {"Env next(block)", "env", 1, testEnv},
+  {"SVF nextLPF()", "svf", 1, testSVF},
+  {"SVF nextLPF(block)", "svf_block", 1, testSVFBlock},
+  {"SVF2 nextLPF(block)", "svf2", 1, testSVF2},
+  {"SVFBank<4> nextLPF(block)", "svfbank", 1, testSVFBank},
+  {"Bob next(block) x1", "bob1", 1, testBob1},
+  {"Bob next(block) x2", "bob2", 1, testBob2},
+  {"Bob next(block) x4", "bob4", 1, testBob4},
+  {"Bob sweep x1", "bob_sweep1", 1, testBobSweep1},
+  {"Bob sweep x2", "bob_sweep2", 1, testBobSweep2},
+  {"Bob sweep x4", "bob_sweep4", 1, testBobSweep4},
+  {"Del next()", "del", 1, testDel},
+  {"LongDel next(block)", "longdel", 1, testLongDel},
+  {"APF next()", "apf", 1, testAPF},
+  {"Samp next(block) interpolated", "samp", 1, testSamp},
+  {"EventQueue process(block)", "eventqueue", 1, testEventQueue},
+  {"FX reverbStereo(block)", "fx_reverb", 2, testReverb},
+  {"FX chorus()", "fx_chorus", 1, testChorus},
+  {"FDN<8> next(block)", "fdn8", 2, testFDN},
+  {"Noise pink next(block)", "noise_pink", 1, testPink},
+};
+
+void put16(FILE * f, uint16_t v) { fputc(v & 0xFF, f); fputc(v >> 8, f); }
+void put32(FILE * f, uint32_t v) { put16(f, v & 0xFFFF); put16(f, v >> 16); }
+
+/** Write interleaved 16 bit samples as a WAV file */
+bool writeWav(const std::string & path, const int16_t * data, size_t frames, int channels) {
+  FILE * f = fopen(path.c_str(), "wb");
+  if (!f) return false;
+  uint32_t bytes = frames * channels * 2;
+  fwrite("RIFF", 1, 4, f); put32(f, 36 + bytes); fwrite("WAVE", 1, 4, f);
+  fwrite("fmt ", 1, 4, f); put32(f, 16); put16(f, 1); put16(f, channels);
+  put32(f, SAMPLE_RATE); put32(f, SAMPLE_RATE * channels * 2); put16(f, channels * 2); put16(f, 16);
+  fwrite("data", 1, 4, f); put32(f, bytes);
+  for (size_t i=0; i<frames * channels; i++) put16(f, (uint16_t)data[i]);
+  fclose(f);
+  return true;
+}
+
+/** Read the samples of a 16 bit WAV file written by writeWav() */
+bool readWav(const std::string & path, std::vector<int16_t> & data, int & channels) {
+  FILE * f = fopen(path.c_str(), "rb");
+  if (!f) return false;
+  uint8_t header[44];
+  bool ok = fread(header, 1, 44, f) == 44 && memcmp(header, "RIFF", 4) == 0 && memcmp(header + 36, "data", 4) == 0;
+  if (ok) {
+    channels = header[22] | (header[23] << 8);
+    uint32_t bytes = header[40] | (header[41] << 8) | (header[42] << 16) | ((uint32_t)header[43] << 24);
+    data.resize(bytes / 2);
+    for (size_t i=0; i<data.size(); i++) {
+      uint8_t b[2];
+      if (fread(b, 1, 2, f) != 2) { ok = false; break; }
+      data[i] = (int16_t)(b[0] | (b[1] << 8));
+    }
+  }
+  fclose(f);
+  return ok;
+}
+
+int main(int argc, char ** argv) {
+  bool write = false;
+  int tolerance = 0;
+  std::string goldenDir = "golden";
+  std::string filter;
+  for (int a=1; a<argc; a++) {
+    std::string arg = argv[a];
+    if (arg == "--write") {
+      write = true;
+    } else if (arg == "--tolerance" && a + 1 < argc) {
+      tolerance = atoi(argv[++a]);
+    } else if (arg == "--golden" && a + 1 < argc) {
+      goldenDir = argv[++a];
+    } else filter = arg;
+  }
+  makeInput();
+  Osc::sawGen(waveTable);
+  static int16_t left[benchSamples], right[benchSamples];
+  std::vector<int16_t> frames(goldenSamples * 2);
+  std::vector<int16_t> golden;
+  int failures = 0;
+  printf("M16 host benchmark, %d Hz, %zu samples per run\n", SAMPLE_RATE, benchSamples);
+  for (const Test & t : tests) {
+    if (!filter.empty() && std::string(t.name).find(filter) == std::string::npos) continue;
+    uint64_t best = UINT64_MAX;
+    for (int r=0; r<benchRuns; r++) {
+      resetRandom();
+      uint64_t start = hostNanos();
+      t.run(left, right, benchSamples);
+      best = min(best, hostNanos() - start);
+    }
+    for (size_t i=0; i<goldenSamples; i++) { // interleave the start of the output
+      frames[i * t.channels] = left[i];
+      if (t.channels == 2) frames[i * 2 + 1] = right[i];
+    }
+    size_t count = goldenSamples * t.channels;
+    std::string path = goldenDir + "/" + t.file + ".wav";
+    double ns = (double)best / benchSamples;
+    printf("%-28s %9.1f ns/sample %12.0f samples/s  ", t.name, ns, 1e9 / ns);
+    size_t clipped = 0; // runaway filters and feedback sit at the limits
+    for (size_t i=0; i<benchSamples; i++) {
+      if (abs(left[i]) >= MAX_16 || (t.channels == 2 && abs(right[i]) >= MAX_16)) clipped++;
+    }
+    if (clipped > 0) printf("clipped %zu  ", clipped);
+    if (write) {
+      if (writeWav(path, frames.data(), goldenSamples, t.channels)) {
+        printf("wrote %s\n", path.c_str());
+      } else {
+        printf("could not write %s\n", path.c_str());
+        failures++;
+      }
+      continue;
+    }
+    int goldenChannels = 0;
+    if (!readWav(path, golden, goldenChannels) || goldenChannels != t.channels || golden.size() != count) {
+      printf("no golden %s\n", path.c_str());
+      failures++;
+      continue;
+    }
+    int maxError = 0;
+    double sumSquares = 0;
+    for (size_t i=0; i<count; i++) {
+      int error = abs(frames[i] - golden[i]);
+      maxError = max(maxError, error);
+      sumSquares += (double)error * error;
+    }
+    if (maxError == 0) {
+      printf("exact\n");
+    } else {
+      bool pass = maxError <= tolerance;
+      printf("%s max error %d rms %.2f\n", pass ? "ok" : "FAIL", maxError, sqrt(sumSquares / count));
+      if (!pass) failures++;
+    }
+  }
+  if (failures > 0) printf("%d failed\n", failures);
+  return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,94 @@
+/*
+ * Arduino.h
+ *
+ * A minimal stand in for the Arduino core, so the M16 classes can be built and run on a desktop
+ * for benchmarks and output checks. Compiled as an ESP32 target with the I2S and FreeRTOS calls
+ * stubbed out, audio is never started; the DSP classes are called directly.
+ *
+ * by Andrew R. Brown 2025
+ *
+ * This file is part of the M16 audio library host tools.
+ *
+ * M16 is licensed under a Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International License.
+ */
+
+#ifndef M16_HOST_ARDUINO_H_
+#define M16_HOST_ARDUINO_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <algorithm>
+#include <chrono>
+
+using std::min;
+using std::max;
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define IRAM_ATTR
+#define PROGMEM
+#define HEX 16
+#define SERIAL_8N1 0
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+
+/** Nanoseconds since the first call, the time base for millis(), micros() and cycle counts */
+inline uint64_t hostNanos() {
+  static const auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+inline unsigned long millis() { return hostNanos() / 1000000; }
+inline unsigned long micros() { return hostNanos() / 1000; }
+inline void delay(unsigned long) {}
+inline void yield() {}
+inline void noInterrupts() {}
+inline void interrupts() {}
+inline long random(long maxVal) { return maxVal > 0 ? rand() % maxVal : 0; }
+inline long random(long minVal, long maxVal) { return maxVal > minVal ? minVal + rand() % (maxVal - minVal) : minVal; }
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+/** Serial prints to stdout */
+struct HardwareSerial {
+  void begin(long, int = 0, int = 0, int = 0) {}
+  void setRxBufferSize(size_t) {}
+  template<class F> void onReceive(F) {}
+  int available() { return 0; }
+  int read() { return -1; }
+  size_t write(uint8_t b) { return fwrite(&b, 1, 1, stdout); }
+  void print(const char * s) { fputs(s, stdout); }
+  void print(float v, int digits = 2) { printf("%.*f", digits, v); }
+  void print(double v, int digits = 2) { printf("%.*f", digits, v); }
+  void print(int v, int base = 10) { printf(base == HEX ? "%X" : "%d", v); }
+  void print(long v, int base = 10) { printf(base == HEX ? "%lX" : "%ld", v); }
+  void print(unsigned int v, int base = 10) { printf(base == HEX ? "%X" : "%u", v); }
+  void print(unsigned long v, int base = 10) { printf(base == HEX ? "%lX" : "%lu", v); }
+  template<class T> void println(T v) { print(v); println(); }
+  template<class T> void println(T v, int base) { print(v, base); println(); }
+  void println() { fputc('\n', stdout); }
+};
+static HardwareSerial Serial, Serial2;
+
+/** Cycle counts are nanoseconds on the host, as if the CPU ran at 1000 MHz */
+struct EspClass {
+  uint32_t getCycleCount() { return (uint32_t)hostNanos(); }
+  uint32_t getCpuFreqMHz() { return 1000; }
+};
+static EspClass ESP;
+
+#ifdef ESP32
+#include "freertos/FreeRTOS.h"
+inline bool psramFound() { return false; }
+typedef int esp_err_t;
+#define ESP_OK 0
+#endif
+
+#endif /* M16_HOST_ARDUINO_H_ */
@@ -0,0 +1,20 @@
+// I2S driver calls for the M16 host build, audio is never started
+#pragma once
+typedef int i2s_port_t;
+typedef int i2s_mode_t;
+#define I2S_NUM_0 0
+#define I2S_MODE_MASTER 1
+#define I2S_MODE_TX 2
+#define I2S_MODE_RX 4
+#define I2S_BITS_PER_SAMPLE_16BIT 16
+#define I2S_CHANNEL_FMT_RIGHT_LEFT 0
+#define I2S_COMM_FORMAT_STAND_I2S 0
+#define ESP_INTR_FLAG_LEVEL1 0
+typedef struct { int bck_io_num, ws_io_num, data_out_num, data_in_num; } i2s_pin_config_t;
+typedef struct { i2s_mode_t mode; int sample_rate; int bits_per_sample; int channel_format; int communication_format;
+  int intr_alloc_flags; int dma_buf_count; int dma_buf_len; int use_apll; bool tx_desc_auto_clear; int fixed_mclk; } i2s_config_t;
+inline int i2s_driver_install(i2s_port_t, const i2s_config_t *, int, void *) { return 0; }
+inline int i2s_set_pin(i2s_port_t, const i2s_pin_config_t *) { return 0; }
+inline int i2s_start(i2s_port_t) { return 0; }
+inline int i2s_write(i2s_port_t, const void *, size_t n, size_t * written, uint32_t) { *written = n; return 0; }
+inline int i2s_read(i2s_port_t, void *, size_t n, size_t * bytesRead, uint32_t) { *bytesRead = n; return 0; }
@@ -0,0 +1,6 @@
+// PSRAM allocation for the M16 host build, from the heap
+#pragma once
+#define MALLOC_CAP_SPIRAM 1
+#define MALLOC_CAP_INTERNAL 2
+#define MALLOC_CAP_8BIT 4
+inline void * heap_caps_malloc(size_t bytes, uint32_t) { return malloc(bytes); }
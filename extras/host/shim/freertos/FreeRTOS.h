@@ -0,0 +1,19 @@
+// FreeRTOS task calls for the M16 host build, tasks are never started
+#pragma once
+typedef void * TaskHandle_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+#define configMAX_PRIORITIES 25
+#define tskIDLE_PRIORITY 0
+#define portMAX_DELAY 0xffffffff
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdMS_TO_TICKS(x) (x)
+inline BaseType_t xTaskCreatePinnedToCore(void (*)(void *), const char *, uint32_t, void *, UBaseType_t, TaskHandle_t *, BaseType_t) { return pdTRUE; }
+inline BaseType_t xTaskCreate(void (*)(void *), const char *, uint32_t, void *, UBaseType_t, TaskHandle_t *) { return pdTRUE; }
+inline void vTaskDelay(TickType_t) {}
+inline void vTaskDelete(TaskHandle_t) {}
+inline uint32_t ulTaskNotifyTake(BaseType_t, TickType_t) { return 0; }
+inline BaseType_t xTaskNotifyGive(TaskHandle_t) { return pdTRUE; }
+inline BaseType_t xPortGetCoreID() { return 0; }
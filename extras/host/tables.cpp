@@ -0,0 +1,89 @@
+/*
+ * tables.cpp
+ *
+ * Writes WaveTables.h, the standard wave tables that Osc::getTable() reads from flash on ESP32
+ *
+ * by Andrew R. Brown 2025
+ *
+ * The tables are made with the same Osc generators a sketch would call, so they match
+ * what getTable() generates on ESP8266. Run "make tables" after changing a generator.
+ *
+ * This file is part of the M16 audio library host tools.
+ *
+ * M16 is licensed under a Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International License.
+ */
+
+#define M16_NO_FLASH_TABLES // generate, rather than read the tables being written
+#include "M16.h"
+#include "Osc.h"
+
+#include <stdio.h>
+
+struct FlashTable {
+  const char * name;
+  const char * shapeName;
+  int shape;
+  int size;
+  void (*gen)(int16_t *, int);
+};
+
+static void sawMip(int16_t * table, int) { Osc::sawMipGen(table); }
+static void sqrMip(int16_t * table, int) { Osc::sqrMipGen(table); }
+static void triMip(int16_t * table, int) { Osc::triMipGen(table); }
+
+static const FlashTable flashTables[] = {
+  {"oscFlashSin", "OSC_SIN", OSC_SIN, TABLE_SIZE, Osc::sinGen},
+  {"oscFlashCos", "OSC_COS", OSC_COS, TABLE_SIZE, Osc::cosGen},
+  {"oscFlashTri", "OSC_TRI", OSC_TRI, TABLE_SIZE, Osc::triGen},
+  {"oscFlashSaw", "OSC_SAW", OSC_SAW, TABLE_SIZE, Osc::sawGen},
+  {"oscFlashSqr", "OSC_SQR", OSC_SQR, TABLE_SIZE, Osc::sqrGen},
+  {"oscFlashSawMip", "OSC_SAW_MIP", OSC_SAW_MIP, MIPMAP_SIZE, sawMip},
+  {"oscFlashSqrMip", "OSC_SQR_MIP", OSC_SQR_MIP, MIPMAP_SIZE, sqrMip},
+  {"oscFlashTriMip", "OSC_TRI_MIP", OSC_TRI_MIP, MIPMAP_SIZE, triMip},
+  {"oscFlashSin256", "OSC_SIN", OSC_SIN, 256, Osc::sinGen}, // LFO and FX chorus size
+  {"oscFlashTri256", "OSC_TRI", OSC_TRI, 256, Osc::triGen},
+};
+static const int numFlashTables = sizeof(flashTables) / sizeof(flashTables[0]);
+
+int main(int argc, char ** argv) {
+  const char * path = (argc > 1) ? argv[1] : "../../WaveTables.h";
+  FILE * f = fopen(path, "w");
+  if (f == nullptr) {
+    fprintf(stderr, "can't write %s\n", path);
+    return 1;
+  }
+  fprintf(f, "/*\n * WaveTables.h\n *\n");
+  fprintf(f, " * Standard wave tables as constants, which ESP32 reads directly from flash\n *\n");
+  fprintf(f, " * by Andrew R. Brown 2025\n *\n");
+  fprintf(f, " * Generated by extras/host/tables.cpp (make tables) with the Osc generators, do not edit.\n");
+  fprintf(f, " * Used by Osc::getTable() on ESP32 when M16_TABLE_BITS is %d, ESP8266 generates them into RAM.\n *\n", TABLE_BITS);
+  fprintf(f, " * This file is part of the M16 audio library. Relies on M16.h\n *\n");
+  fprintf(f, " * M16 is licensed under a Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International License.\n */\n\n");
+  fprintf(f, "#ifndef WAVETABLES_H_\n#define WAVETABLES_H_\n\n");
+  fprintf(f, "#if M16_TABLE_BITS == %d\n\n", TABLE_BITS);
+  static int16_t table[MIPMAP_SIZE];
+  for (int t=0; t<numFlashTables; t++) {
+    const FlashTable &ft = flashTables[t];
+    ft.gen(table, ft.size);
+    fprintf(f, "const int16_t %s[%d] = {", ft.name, ft.size);
+    for (int i=0; i<ft.size; i++) {
+      fprintf(f, "%s%d", (i == 0) ? "\n  " : (i % 16 == 0) ? ",\n  " : ", ", table[i]);
+    }
+    fprintf(f, "\n};\n\n");
+  }
+  fprintf(f, "/** Return a standard table held in flash, or NULL if there is none of that shape and size */\n");
+  fprintf(f, "inline\nconst int16_t * oscFlashTable(int shape, int size) {\n");
+  for (int t=0; t<numFlashTables; t++) {
+    const FlashTable &ft = flashTables[t];
+    if (ft.shape >= OSC_SAW_MIP) {
+      fprintf(f, "  if (shape == %s) return %s;\n", ft.shapeName, ft.name);
+    } else fprintf(f, "  if (shape == %s && size == %d) return %s;\n", ft.shapeName, ft.size, ft.name);
+  }
+  fprintf(f, "  return NULL;\n}\n\n");
+  fprintf(f, "#else // other table sizes are generated\n\n");
+  fprintf(f, "inline\nconst int16_t * oscFlashTable(int, int) {\n  return NULL;\n}\n\n");
+  fprintf(f, "#endif\n\n#endif /* WAVETABLES_H_ */\n");
+  fclose(f);
+  printf("wrote %s\n", path);
+  return 0;
+}